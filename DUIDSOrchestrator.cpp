@@ -2,6 +2,23 @@
 // Concrete implementation of the IDUIDSOrchestratorService.
 
 #include "HexademicSixLattice.h" // Includes Hexademic core types and interfaces
+#include "Hexademic6DUIDSCurve.h" // For FHexademic6DUIDSCurve
+#include "DUIDSOrderedIndex.h"    // For FDUIDSOrderedIndex
+#include "DUIDSOrchestratorShard.h" // For FDUIDSOrchestratorShard
+#include "Hexademic6FlatMap.h"    // For THexademic6FlatMap, FHexademic6PackedKey
+#include "Hexademic6AccessTracker.h" // For FHexademic6AccessTracker
+#include "Hexademic6CrossReferenceGraph.h" // For FHexademic6CrossReferenceGraph
+#include "Hexademic6NodeCache.h"   // For FHexademic6NodeCache, FHexademic6CacheStats
+#include "Hexademic6RecordCodec.h" // For FHexademic6RecordCodec
+#include "Hexademic6RecordArena.h" // For FHexademic6RecordArena, FHexademicRecordLocation
+#include "Hexademic6SegmentFile.h" // For FHexademic6Segment
+#include "Hexademic6WriteAheadLog.h" // For FHexademic6WriteAheadLog, FHexademic6Snapshot
+#include "Async/Async.h"         // For Async
+#include "Async/ParallelFor.h"   // For ParallelFor
+#include "HAL/PlatformMisc.h"    // For FPlatformMisc::Prefetch
+#include "HAL/IConsoleManager.h" // For TAutoConsoleVariable
+#include "Misc/ScopeExit.h"      // For ON_SCOPE_EXIT
+#include "Misc/ScopeLock.h"      // For FScopeLock
 #include "Logging/LogMacros.h"   // For UE_LOG
 #include "HAL/PlatformTime.h"    // For FPlatformTime::Seconds()
 #include "Misc/Guid.h"           // For FGuid
@@ -10,13 +27,155 @@
 // Define a log category for Hexademic Lattice operations (if not already defined in Hexademic6Module.cpp)
 // DEFINE_LOG_CATEGORY_STATIC(LogHexademicLattice, Log, All);
 
+static TAutoConsoleVariable<int32> CVarHexademicWALSnapshotMegabytes(
+    TEXT("Hexademic.WAL.SnapshotMegabytes"),
+    256,
+    TEXT("Write-ahead log growth (MiB) that triggers a background snapshot, bounding replay at recovery. 0 disables."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarHexademicWALSnapshotIntervalSeconds(
+    TEXT("Hexademic.WAL.SnapshotIntervalSeconds"),
+    300.0f,
+    TEXT("Maximum time between background snapshots while the write-ahead log is growing. 0 disables."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicCacheBudgetMegabytes(
+    TEXT("Hexademic.Cache.BudgetMegabytes"),
+    64,
+    TEXT("Memory budget (MiB) of the decoded node and sliced attribute cache, split evenly over the orchestrator's shards."),
+    ECVF_Default);
+
+namespace DUIDSOrchestratorPrivate
+{
+    template<typename ShardsType>
+    FORCEINLINE auto& ShardForIndex(ShardsType& Shards, const FDUIDSIndex& Index)
+    {
+        return Shards[FDUIDSOrchestratorShard::GetShardIndex(GetTypeHash(Index))];
+    }
+
+    template<typename ShardsType>
+    FORCEINLINE auto& ShardForMemory(ShardsType& Shards, const FGuid& MemoryID)
+    {
+        return Shards[FDUIDSOrchestratorShard::GetShardIndex(GetTypeHash(MemoryID))];
+    }
+
+    // Lattice order a record was stored under, read from its uncompressed frame header.
+    FORCEINLINE bool ReadRecordOrder(TConstArrayView<uint8> Record, ECognitiveLatticeOrder& OutOrder)
+    {
+        FHexademic6RecordFrameHeader Header;
+        if (!FHexademic6RecordCodec::ReadFrameHeader(Record, Header))
+        {
+            return false;
+        }
+        OutOrder = Header.Order;
+        return true;
+    }
+
+    // A mounted segment's record is only reachable while its key still maps to the memory the
+    // segment stored it for and no record removal has shadowed it since. Segments are read-only,
+    // so re-indexing, migration and removal cannot touch them; this check is what retires their
+    // entries. Key's shard must be locked.
+    FORCEINLINE bool IsSegmentEntryLive(const FDUIDSOrchestratorShard& Shard, const FHexademic6SegmentEntry& Entry)
+    {
+        const FDUIDSIndex Key = Entry.GetKey();
+        const FGuid* Owner = Shard.IndexToMemoryMap.Find(Key);
+        return Owner && *Owner == Entry.MemoryID && !Shard.RemovedSegmentRecords.Contains(Key);
+    }
+
+    // True while Key is mapped to a memory. Takes Key's shard lock, so it must not be called
+    // under GraphLock (see FDUIDSOrchestratorShard).
+    FORCEINLINE bool IsKeyLive(const FDUIDSOrchestratorShards& Shards, const FDUIDSIndex& Key)
+    {
+        const FDUIDSOrchestratorShard& Shard = ShardForIndex(Shards, Key);
+        FReadScopeLock ReadLock(Shard.Lock);
+        return Shard.IndexToMemoryMap.Contains(Key);
+    }
+
+    // Appends the ascending union of the sorted runs Keys[RunStarts[i], RunStarts[i + 1]) to
+    // OutKeys: a k-way merge over a heap of run heads, O(n log k) for k runs.
+    void MergeSortedRuns(TConstArrayView<FDUIDSIndex> Keys, TConstArrayView<int32> RunStarts, TArray<FDUIDSIndex>& OutKeys)
+    {
+        struct FRunHead
+        {
+            int32 Position;
+            int32 End;
+        };
+        const auto HeadLess = [Keys](const FRunHead& A, const FRunHead& B) { return Keys[A.Position] < Keys[B.Position]; };
+        TArray<FRunHead, TInlineAllocator<FDUIDSOrchestratorShard::NumShards>> Heads;
+        for (int32 Run = 0; Run + 1 < RunStarts.Num(); ++Run)
+        {
+            if (RunStarts[Run] < RunStarts[Run + 1])
+            {
+                Heads.HeapPush({ RunStarts[Run], RunStarts[Run + 1] }, HeadLess);
+            }
+        }
+        OutKeys.Reserve(OutKeys.Num() + Keys.Num());
+        while (Heads.Num() > 1)
+        {
+            FRunHead Head;
+            Heads.HeapPop(Head, HeadLess, EAllowShrinking::No);
+            OutKeys.Add(Keys[Head.Position]);
+            if (++Head.Position < Head.End)
+            {
+                Heads.HeapPush(Head, HeadLess);
+            }
+        }
+        if (Heads.Num() == 1)
+        {
+            OutKeys.Append(Keys.GetData() + Heads[0].Position, Heads[0].End - Heads[0].Position);
+        }
+    }
+
+    // Holds every shard's Lock for reading, taken in ascending shard order.
+    class FAllShardsReadScope
+    {
+    public:
+        explicit FAllShardsReadScope(const FDUIDSOrchestratorShards& InShards)
+            : Shards(InShards)
+        {
+            for (const FDUIDSOrchestratorShard& Shard : Shards)
+            {
+                Shard.Lock.ReadLock();
+            }
+        }
+
+        ~FAllShardsReadScope()
+        {
+            for (int32 ShardIndex = FDUIDSOrchestratorShard::NumShards - 1; ShardIndex >= 0; --ShardIndex)
+            {
+                Shards[ShardIndex].Lock.ReadUnlock();
+            }
+        }
+
+    private:
+        const FDUIDSOrchestratorShards& Shards;
+    };
+
+    // Batches below this many decodes are not worth spreading over the task graph.
+    constexpr int32 MinParallelDecodes = 8;
+
+    // Leading bytes of a record body prefetched ahead of a batched decode. The headers have
+    // already been read by then; the body is what the decoder streams next.
+    constexpr int32 MaxPrefetchedBodyBytes = 4 * PLATFORM_CACHE_LINE_SIZE;
+
+    // Cross references of stored records shadow those of mounted segments.
+    constexpr uint8 SegmentReferencePriority = 1;
+    constexpr uint8 StoredReferencePriority = 2;
+}
+
 FDUIDSOrchestrator::FDUIDSOrchestrator()
 {
+    SetCacheBudget((int64)CVarHexademicCacheBudgetMegabytes.GetValueOnAnyThread() << 20);
     UE_LOG(LogHexademicLattice, Log, TEXT("FDUIDSOrchestrator constructed."));
 }
 
 FDUIDSOrchestrator::~FDUIDSOrchestrator()
 {
+    if (PendingSnapshot.IsValid())
+    {
+        PendingSnapshot.Wait();
+    }
+    WriteAheadLog.Reset(); // Commits and syncs whatever is still pending
     UE_LOG(LogHexademicLattice, Log, TEXT("FDUIDSOrchestrator destructed."));
 }
 
@@ -25,104 +184,483 @@ FDUIDSIndex FDUIDSOrchestrator::GenerateIndex(const FHexademicMemoryNode& Memory
     // Generates a DUIDS index for a given memory node.
     // This calls the inlined UpdateDUIDSIndex on the memory's LatticePosition
     // and then uses the result.
-    FDUIDSIndex NewIndex = Memory.LatticePosition.DUIDSLocation;
+    FDUIDSIndex NewIndex = GenerateIndexFromCoordinate(Memory.LatticePosition, Memory.LatticePosition.LatticeOrder);
     // Potentially add more unique identifiers based on EventType or EventData hash
     // NewIndex.Cutter = FCRC::MemCrc32(Memory.EventType.GetCharArray().GetData(), Memory.EventType.Len() * sizeof(TCHAR)) % 65536;
-    
-    IndexToMemoryMap.Add(NewIndex, Memory.MemoryID);
-    MemoryToIndexMap.Add(Memory.MemoryID, NewIndex);
 
-    UE_LOG(LogHexademicLattice, Verbose, TEXT("Generated DUIDS Index %s for Memory %s."), *NewIndex.ToDecimalString(), *Memory.MemoryID.ToString());
+    ApplyIndexPut(NewIndex, Memory.MemoryID);
+    MaybeBeginSnapshot();
+
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Generated DUIDS Index %s for Memory %s."), *FHexademic6PackedKey(NewIndex).ToHexString(), *Memory.MemoryID.ToString());
     return NewIndex;
 }
 
 TOptional<FHexademicMemoryNode> FDUIDSOrchestrator::RetrieveByIndex(const FDUIDSIndex& Index, bool bDecompress)
 {
-    // Retrieves a memory node using its DUIDS index.
-    if (FGuid* MemoryIDPtr = IndexToMemoryMap.Find(Index))
+    // Retrieves a memory node using its DUIDS index. Hot nodes come from the shard's cache;
+    // otherwise decompression runs under the shard's shared lock, so retrievals only wait for
+    // writers to the same shard.
+    FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+    TOptional<FHexademicMemoryNode> RetrievedMemory;
+    ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order6;
+    {
+        FScopeLock CacheScope(&Shard.CacheLock);
+        FHexademicMemoryNode CachedMemory;
+        if (Shard.Cache.FindNode(Index, CachedMemory))
+        {
+            Order = CachedMemory.LatticePosition.LatticeOrder;
+            RetrievedMemory = MoveTemp(CachedMemory);
+        }
+    }
+    if (!RetrievedMemory.IsSet())
     {
-        if (TArray<uint8>* CompressedData = CompressedMemoryStorage.Find(Index))
+        FReadScopeLock ReadLock(Shard.Lock);
+        if (FindMemoryIDLocked(Shard, Index))
         {
-            FHexademicMemoryNode RetrievedMemory = DecompressMemoryData(*CompressedData);
-            RetrievedMemory.QuickAccessIndex = Index; // Restore quick access index
-            
-            if (bDecompress)
+            const TConstArrayView<uint8> CompressedData = FindRecordLocked(Shard, Index);
+            FHexademic6RecordFrameHeader Header;
+            if (FHexademic6RecordCodec::ReadFrameHeader(CompressedData, Header))
             {
-                RetrievedMemory.DecompressForAccess(); // Call inlined method
+                Order = Header.Order;
+                RetrievedMemory = DecompressMemoryData(Shard, CompressedData);
+                // Cached under the read lock, so a writer's invalidation cannot slip in between.
+                FScopeLock CacheScope(&Shard.CacheLock);
+                Shard.Cache.AddNode(Index, RetrievedMemory.GetValue(), Header.RawSize);
             }
-            TrackMemoryAccess(Index); // Track access
-            UE_LOG(LogHexademicLattice, Log, TEXT("Retrieved Memory %s by DUIDS Index %s. Decompressed: %s"), *RetrievedMemory.MemoryID.ToString(), *Index.ToDecimalString(), bDecompress ? TEXT("True") : TEXT("False"));
-            return RetrievedMemory;
         }
     }
-    UE_LOG(LogHexademicLattice, Warning, TEXT("Memory not found for DUIDS Index %s."), *Index.ToDecimalString());
+    if (RetrievedMemory.IsSet())
+    {
+        RetrievedMemory->QuickAccessIndex = Index; // Restore quick access index
+
+        if (bDecompress)
+        {
+            RetrievedMemory->DecompressForAccess(); // Call inlined method
+        }
+        RecordAccess(Index, Order); // Track access
+        UE_LOG(LogHexademicLattice, Verbose, TEXT("Retrieved Memory %s by DUIDS Index %s. Decompressed: %s"), *RetrievedMemory->MemoryID.ToString(), *FHexademic6PackedKey(Index).ToHexString(), bDecompress ? TEXT("True") : TEXT("False"));
+        return RetrievedMemory;
+    }
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Memory not found for DUIDS Index %s."), *FHexademic6PackedKey(Index).ToHexString());
     return TOptional<FHexademicMemoryNode>();
 }
 
+int32 FDUIDSOrchestrator::RetrieveByIndices(TConstArrayView<FDUIDSIndex> Indices, TArrayView<FHexademicMemoryNode> OutMemories, TArrayView<bool> OutFound, bool bDecompress)
+{
+    // Batched RetrieveByIndex. OutMemories[i] and OutFound[i] receive the result for Indices[i];
+    // nodes are decoded straight into the caller's elements, so their buffers are reused.
+    // Keys are grouped by shard and sorted, so each shard's cache and lock are taken once per
+    // batch. Records are located first and the head of each compressed body prefetched, then
+    // decoded in parallel while every touched shard is read-locked; writers to those shards
+    // wait for the batch.
+    check(OutMemories.Num() >= Indices.Num() && OutFound.Num() >= Indices.Num());
+    struct FBatchItem
+    {
+        FDUIDSIndex Key;
+        int32 Slot;
+        int32 ShardIndex;
+        ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order6;
+        TConstArrayView<uint8> Record;
+        uint32 RawSize = 0;
+        bool bFound = false;
+    };
+    TArray<FBatchItem> Items;
+    Items.Reserve(Indices.Num());
+    for (int32 Slot = 0; Slot < Indices.Num(); ++Slot)
+    {
+        OutFound[Slot] = false;
+        FBatchItem& Item = Items.AddDefaulted_GetRef();
+        Item.Key = Indices[Slot];
+        Item.Slot = Slot;
+        Item.ShardIndex = FDUIDSOrchestratorShard::GetShardIndex(GetTypeHash(Item.Key));
+    }
+    Items.Sort([](const FBatchItem& A, const FBatchItem& B)
+    {
+        return A.ShardIndex != B.ShardIndex ? A.ShardIndex < B.ShardIndex : A.Key < B.Key;
+    });
+
+    // Cache hits, one CacheLock per shard.
+    TArray<int32, TInlineAllocator<FDUIDSOrchestratorShard::NumShards>> MissShards;
+    int32 NumMisses = 0;
+    for (int32 RunStart = 0, RunEnd = 0; RunStart < Items.Num(); RunStart = RunEnd)
+    {
+        FDUIDSOrchestratorShard& Shard = Shards[Items[RunStart].ShardIndex];
+        const int32 MissesBefore = NumMisses;
+        FScopeLock CacheScope(&Shard.CacheLock);
+        for (RunEnd = RunStart; RunEnd < Items.Num() && Items[RunEnd].ShardIndex == Items[RunStart].ShardIndex; ++RunEnd)
+        {
+            FBatchItem& Item = Items[RunEnd];
+            Item.bFound = Shard.Cache.FindNode(Item.Key, OutMemories[Item.Slot]);
+            if (Item.bFound)
+            {
+                Item.Order = OutMemories[Item.Slot].LatticePosition.LatticeOrder;
+            }
+            else
+            {
+                ++NumMisses;
+            }
+        }
+        if (NumMisses > MissesBefore)
+        {
+            MissShards.Add(Items[RunStart].ShardIndex);
+        }
+    }
+
+    if (NumMisses > 0)
+    {
+        // Shards are locked in ascending order, as FAllShardsReadScope does.
+        for (const int32 ShardIndex : MissShards)
+        {
+            Shards[ShardIndex].Lock.ReadLock();
+        }
+        ON_SCOPE_EXIT
+        {
+            for (int32 LockIndex = MissShards.Num() - 1; LockIndex >= 0; --LockIndex)
+            {
+                Shards[MissShards[LockIndex]].Lock.ReadUnlock();
+            }
+        };
+
+        // Locate every record first and prefetch the start of its body, so the decodes below do
+        // not begin with a miss. Reading the headers here already brought them in.
+        TArray<int32> Decodes;
+        Decodes.Reserve(NumMisses);
+        for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+        {
+            FBatchItem& Item = Items[ItemIndex];
+            if (Item.bFound)
+            {
+                continue;
+            }
+            const FDUIDSOrchestratorShard& Shard = Shards[Item.ShardIndex];
+            if (!FindMemoryIDLocked(Shard, Item.Key))
+            {
+                continue;
+            }
+            Item.Record = FindRecordLocked(Shard, Item.Key);
+            FHexademic6RecordFrameHeader Header;
+            FHexademic6RecordSliceHeader Slices;
+            if (FHexademic6RecordCodec::ReadFrameHeader(Item.Record, Header) && FHexademic6RecordCodec::ReadSliceHeader(Item.Record, Slices))
+            {
+                const int32 BodyEnd = FMath::Min(Item.Record.Num(), (int32)Slices.BodyOffset + DUIDSOrchestratorPrivate::MaxPrefetchedBodyBytes);
+                for (int32 Offset = (int32)Slices.BodyOffset; Offset < BodyEnd; Offset += PLATFORM_CACHE_LINE_SIZE)
+                {
+                    FPlatformMisc::Prefetch(Item.Record.GetData(), Offset);
+                }
+                Item.Order = Header.Order;
+                Item.RawSize = Header.RawSize;
+                Decodes.Add(ItemIndex);
+            }
+        }
+
+        ParallelFor(Decodes.Num(), [this, &Items, &Decodes, OutMemories](int32 DecodeIndex)
+        {
+            FBatchItem& Item = Items[Decodes[DecodeIndex]];
+            Item.bFound = Shards[Item.ShardIndex].RecordCodec.Decompress(Item.Record, OutMemories[Item.Slot]);
+        }, Decodes.Num() < DUIDSOrchestratorPrivate::MinParallelDecodes ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+        // Still under the read locks, so no invalidation can be missed (see InvalidateCachesForIndex).
+        for (int32 DecodeStart = 0, DecodeEnd = 0; DecodeStart < Decodes.Num(); DecodeStart = DecodeEnd)
+        {
+            const int32 ShardIndex = Items[Decodes[DecodeStart]].ShardIndex;
+            FDUIDSOrchestratorShard& Shard = Shards[ShardIndex];
+            FScopeLock CacheScope(&Shard.CacheLock);
+            for (DecodeEnd = DecodeStart; DecodeEnd < Decodes.Num() && Items[Decodes[DecodeEnd]].ShardIndex == ShardIndex; ++DecodeEnd)
+            {
+                const FBatchItem& Item = Items[Decodes[DecodeEnd]];
+                if (Item.bFound)
+                {
+                    Shard.Cache.AddNode(Item.Key, OutMemories[Item.Slot], Item.RawSize);
+                }
+            }
+        }
+    }
+
+    // Finish the found nodes and record their accesses in one go.
+    TArray<FDUIDSIndex> AccessedKeys;
+    TArray<ECognitiveLatticeOrder> AccessedOrders;
+    AccessedKeys.Reserve(Items.Num());
+    AccessedOrders.Reserve(Items.Num());
+    for (const FBatchItem& Item : Items)
+    {
+        if (Item.bFound)
+        {
+            OutFound[Item.Slot] = true;
+            OutMemories[Item.Slot].QuickAccessIndex = Item.Key;
+            AccessedKeys.Add(Item.Key);
+            AccessedOrders.Add(Item.Order);
+        }
+    }
+    if (bDecompress)
+    {
+        ParallelFor(Indices.Num(), [OutMemories, OutFound](int32 Slot)
+        {
+            if (OutFound[Slot])
+            {
+                OutMemories[Slot].DecompressForAccess();
+            }
+        }, Indices.Num() < DUIDSOrchestratorPrivate::MinParallelDecodes ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+    }
+    AccessTracker.RecordAccesses(AccessedKeys, AccessedOrders, FPlatformTime::Seconds());
+
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Retrieved %d of %d memories by DUIDS index (%d from cache). Decompressed: %s"),
+        AccessedKeys.Num(), Indices.Num(), Indices.Num() - NumMisses, bDecompress ? TEXT("True") : TEXT("False"));
+    return AccessedKeys.Num();
+}
+
 TArray<FDUIDSIndex> FDUIDSOrchestrator::QueryRange(const FDUIDSIndex& StartIndex, const FDUIDSIndex& EndIndex)
 {
-    // Queries for all DUIDS indices within a specified range.
-    // This assumes FDUIDSIndex implements operator< for sorting.
+    // Queries for all DUIDS indices within a specified range (inclusive) in ascending order.
+    // Each shard's ordered index is maintained incrementally by GenerateIndex, so this is
+    // O(log n + k) per shard plus the merge. Keys whose records live in mounted segments are
+    // indexed like any other, so the shards' indices cover every live key.
+    TArray<FDUIDSIndex> ResultIndices;
+    GatherRange(StartIndex, EndIndex, ResultIndices);
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Queried %d DUIDS indices between %s and %s."), ResultIndices.Num(), *FHexademic6PackedKey(StartIndex).ToHexString(), *FHexademic6PackedKey(EndIndex).ToHexString());
+    return ResultIndices;
+}
+
+TArray<FDUIDSIndex> FDUIDSOrchestrator::QueryRangeReverse(const FDUIDSIndex& StartIndex, const FDUIDSIndex& EndIndex, int32 MaxResults)
+{
+    // Same range as QueryRange, walked from EndIndex downwards. MaxResults <= 0 means unlimited.
+    // Each shard contributes at most MaxResults keys, which is enough for the merged top.
+    TArray<FDUIDSIndex> ResultIndices;
+    for (const FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        int32 Taken = 0;
+        Shard.OrderedIndex.ForEachInRangeReverse(StartIndex, EndIndex, [&ResultIndices, &Taken, MaxResults](const FDUIDSIndex& Index)
+        {
+            ResultIndices.Add(Index);
+            return MaxResults <= 0 || ++Taken < MaxResults;
+        });
+    }
+    ResultIndices.Sort([](const FDUIDSIndex& A, const FDUIDSIndex& B) { return B < A; });
+    if (MaxResults > 0 && ResultIndices.Num() > MaxResults)
+    {
+        ResultIndices.SetNum(MaxResults);
+    }
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Queried %d DUIDS indices from %s down to %s."), ResultIndices.Num(), *FHexademic6PackedKey(EndIndex).ToHexString(), *FHexademic6PackedKey(StartIndex).ToHexString());
+    return ResultIndices;
+}
+
+int32 FDUIDSOrchestrator::CountRange(const FDUIDSIndex& StartIndex, const FDUIDSIndex& EndIndex) const
+{
+    // Number of indexed memories within the range, without materializing the keys.
+    // Shards hold disjoint keys, so their counts add up.
+    int32 Count = 0;
+    for (const FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        Count += Shard.OrderedIndex.CountRange(StartIndex, EndIndex);
+    }
+    return Count;
+}
+
+void FDUIDSOrchestrator::GatherRange(const FDUIDSIndex& StartIndex, const FDUIDSIndex& EndIndex, TArray<FDUIDSIndex>& OutIndices) const
+{
+    // Ascending union of every shard's index. Shards hold disjoint keys, so it is duplicate-free,
+    // and each shard's keys come out of its index already sorted, so the runs are merged rather
+    // than re-sorted.
+    TArray<FDUIDSIndex> Runs;
+    TArray<int32, TInlineAllocator<FDUIDSOrchestratorShard::NumShards + 1>> RunStarts;
+    for (const FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        RunStarts.Add(Runs.Num());
+        FReadScopeLock ReadLock(Shard.Lock);
+        Shard.OrderedIndex.GetRange(StartIndex, EndIndex, Runs);
+    }
+    RunStarts.Add(Runs.Num());
+    DUIDSOrchestratorPrivate::MergeSortedRuns(Runs, RunStarts, OutIndices);
+}
+
+TArray<FDUIDSIndex> FDUIDSOrchestrator::QueryNeighborhood(const FHexademic6DCoordinate& Center, int32 Radius, int32 MaxRanges)
+{
+    // Returns every indexed memory of Center's order whose coordinate lies within Radius (per
+    // axis) of Center. With Morton keys the box maps onto a handful of contiguous DUIDS ranges
+    // inside that order's key prefix; keys from over-approximated ranges are filtered by
+    // decoding them.
     TArray<FDUIDSIndex> ResultIndices;
-    TArray<FDUIDSIndex> AllIndices;
-    IndexToMemoryMap.GetKeys(AllIndices);
-    AllIndices.Sort(); // Sort to allow range querying
+    if (FHexademic6DUIDSCurve::GetEncodingMode() != EDUIDSEncodingMode::Morton)
+    {
+        UE_LOG(LogHexademicLattice, Warning, TEXT("QueryNeighborhood requires Hexademic.DUIDS.Encoding=1 (Morton)."));
+        return ResultIndices;
+    }
 
-    for (const FDUIDSIndex& Index : AllIndices)
+    const ECognitiveLatticeOrder Order = Center.LatticeOrder;
+    const FHexademic6DCoordinate Min(Center.X - Radius, Center.Y - Radius, Center.Z - Radius, Center.W - Radius, Center.U - Radius, Center.V - Radius, Order);
+    const FHexademic6DCoordinate Max(Center.X + Radius, Center.Y + Radius, Center.Z + Radius, Center.W + Radius, Center.U + Radius, Center.V + Radius, Order);
+
+    TArray<FDUIDSIndexRange> Ranges;
+    FHexademic6DUIDSCurve::DecomposeBox(Min, Max, Order, Ranges, MaxRanges);
+
+    const uint32 MinCell[6] = { FHexademic6DUIDSCurve::QuantizeAxis(Min.X, Order), FHexademic6DUIDSCurve::QuantizeAxis(Min.Y, Order), FHexademic6DUIDSCurve::QuantizeAxis(Min.Z, Order),
+                                FHexademic6DUIDSCurve::QuantizeAxis(Min.W, Order), FHexademic6DUIDSCurve::QuantizeAxis(Min.U, Order), FHexademic6DUIDSCurve::QuantizeAxis(Min.V, Order) };
+    const uint32 MaxCell[6] = { FHexademic6DUIDSCurve::QuantizeAxis(Max.X, Order), FHexademic6DUIDSCurve::QuantizeAxis(Max.Y, Order), FHexademic6DUIDSCurve::QuantizeAxis(Max.Z, Order),
+                                FHexademic6DUIDSCurve::QuantizeAxis(Max.W, Order), FHexademic6DUIDSCurve::QuantizeAxis(Max.U, Order), FHexademic6DUIDSCurve::QuantizeAxis(Max.V, Order) };
+
+    for (const FDUIDSIndexRange& Range : Ranges)
     {
-        if (Index < StartIndex) continue;
-        if (EndIndex < Index) break; // Optimization for sorted list
-        ResultIndices.Add(Index);
+        for (const FDUIDSIndex& Index : QueryRange(Range.Start, Range.End))
+        {
+            uint32 Cells[6];
+            FHexademic6DUIDSCurve::DecodeCells(FHexademic6DUIDSCurve::FromDUIDSIndex(Index), Cells);
+            bool bInside = FHexademic6DUIDSCurve::GetKeyOrder(Index) == Order;
+            for (int32 Axis = 0; Axis < 6 && bInside; ++Axis)
+            {
+                bInside = Cells[Axis] >= MinCell[Axis] && Cells[Axis] <= MaxCell[Axis];
+            }
+            if (bInside)
+            {
+                ResultIndices.Add(Index);
+            }
+        }
     }
-    UE_LOG(LogHexademicLattice, Log, TEXT("Queried %d DUIDS indices between %s and %s."), ResultIndices.Num(), *StartIndex.ToDecimalString(), *EndIndex.ToDecimalString());
+    UE_LOG(LogHexademicLattice, Log, TEXT("Queried %d DUIDS indices within radius %d of (X=%d, Y=%d, Z=%d, W=%d, U=%d, V=%d) using %d range scans."),
+        ResultIndices.Num(), Radius, Center.X, Center.Y, Center.Z, Center.W, Center.U, Center.V, Ranges.Num());
     return ResultIndices;
 }
 
 void FDUIDSOrchestrator::CompressMemoryNode(FHexademicMemoryNode& Memory, uint8 CompressionLevel)
 {
-    // Compresses a memory node and stores its compressed data.
     Memory.CompressForStorage(); // Calls the inlined method
-    TArray<uint8> CompressedData = CompressMemoryData(Memory, CompressionLevel);
-    CompressedMemoryStorage.Add(Memory.QuickAccessIndex, CompressedData);
-    UE_LOG(LogHexademicLattice, Log, TEXT("Compressed Memory %s to level %d. Stored %d bytes."), *Memory.MemoryID.ToString(), CompressionLevel, CompressedData.Num());
+    const int32 RecordSize = StoreCompressedRecord(Memory, CompressionLevel);
+    if (RecordSize == INDEX_NONE)
+    {
+        return;
+    }
+    MaybeBeginSnapshot();
+    UE_LOG(LogHexademicLattice, Log, TEXT("Compressed Memory %s to level %d. Stored %d bytes."), *Memory.MemoryID.ToString(), CompressionLevel, RecordSize);
+}
+
+int32 FDUIDSOrchestrator::StoreCompressedRecord(const FHexademicMemoryNode& Memory, uint8 CompressionLevel)
+{
+    // Compresses a memory node straight into the record arena of its lattice order, under its
+    // QuickAccessIndex. Only the owning shard is locked, so nodes of different shards compress
+    // in parallel.
+    const ECognitiveLatticeOrder Order = Memory.LatticePosition.LatticeOrder;
+    FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Memory.QuickAccessIndex);
+    FWriteScopeLock WriteLock(Shard.Lock);
+    FHexademic6RecordArena& Arena = Shard.RecordArenas[(uint8)Order];
+    const int32 RecordSize = Shard.RecordCodec.CompressTo(Memory, CompressionLevel, [&Arena](int32 MaxRecordSize) { return Arena.Reserve(MaxRecordSize); });
+    if (RecordSize == INDEX_NONE)
+    {
+        Arena.CancelReservation();
+        return INDEX_NONE;
+    }
+    FHexademicRecordLocation Location;
+    Location.Order = Order;
+    Location.Handle = Arena.Commit(RecordSize);
+    StoreRecordLocationLocked(Shard, Memory.QuickAccessIndex, Location);
+    LogRecordPutLocked(Shard, Memory.QuickAccessIndex, Order, Arena.Get(Location.Handle));
+    return RecordSize;
+}
+
+bool FDUIDSOrchestrator::RelocateRecord(const FDUIDSIndex& PreviousIndex, const FHexademicMemoryNode& Memory)
+{
+    // Moves a stored record to the memory's new key and lattice order once it has been
+    // re-indexed. The frame header and the body both carry the order and position, so the
+    // record is re-encoded, at the level it was stored with. The new record is stored before
+    // the old one is removed; the two shards are locked one after the other, never together.
+    using namespace DUIDSOrchestratorPrivate;
+    FHexademic6RecordFrameHeader Header;
+    {
+        const FDUIDSOrchestratorShard& PreviousShard = ShardForIndex(Shards, PreviousIndex);
+        FReadScopeLock ReadLock(PreviousShard.Lock);
+        if (!FHexademic6RecordCodec::ReadFrameHeader(FindRetiredRecordLocked(PreviousShard, PreviousIndex, Memory.MemoryID), Header))
+        {
+            return false;
+        }
+    }
+    if (StoreCompressedRecord(Memory, Header.Level) == INDEX_NONE)
+    {
+        return false;
+    }
+    if (!(PreviousIndex == Memory.QuickAccessIndex))
+    {
+        // A record in a mounted segment cannot be deleted. Re-indexing already took its key out
+        // of the live map, which fails IsSegmentEntryLive; the removal also tombstones the key,
+        // so the record stays hidden even if the key is later indexed again.
+        FDUIDSOrchestratorShard& PreviousShard = ShardForIndex(Shards, PreviousIndex);
+        FWriteScopeLock WriteLock(PreviousShard.Lock);
+        RemoveRecordLocked(PreviousShard, PreviousIndex);
+    }
+    MaybeBeginSnapshot();
+    return true;
+}
+
+void FDUIDSOrchestrator::DeferSnapshots()
+{
+    // Lets a caller run a batch of mutations without starting a snapshot partway through, which
+    // would read-lock every shard and copy their state inside the caller's time slice.
+    ++SnapshotDeferrals;
+}
+
+void FDUIDSOrchestrator::ResumeSnapshots()
+{
+    if (--SnapshotDeferrals == 0)
+    {
+        MaybeBeginSnapshot();
+    }
 }
 
 void FDUIDSOrchestrator::DecompressMemoryNode(FHexademicMemoryNode& Memory)
 {
-    // Decompresses a memory node.
-    Memory.DecompressForAccess(); // Calls the inlined method
-    if (TArray<uint8>* CompressedData = CompressedMemoryStorage.Find(Memory.QuickAccessIndex))
+    // Restores the whole node from its stored record, as RetrieveByIndex would return it. The
+    // record does not carry the key it is stored under, so QuickAccessIndex is kept. Without a
+    // readable record Memory is left as it is.
+    const FDUIDSIndex Index = Memory.QuickAccessIndex;
+    const FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+    FHexademicMemoryNode Decompressed;
+    bool bDecompressed = false;
     {
-        FHexademicMemoryNode Decompressed = DecompressMemoryData(*CompressedData);
-        Memory.EventData = Decompressed.EventData; // Restore original data
-        Memory.EmotionalColor = Decompressed.EmotionalColor;
-        // ... restore other fields as needed based on compression
-        UE_LOG(LogHexademicLattice, Log, TEXT("Decompressed Memory %s."), *Memory.MemoryID.ToString());
+        FReadScopeLock ReadLock(Shard.Lock);
+        const TConstArrayView<uint8> CompressedData = FindRecordLocked(Shard, Index);
+        bDecompressed = CompressedData.Num() > 0 && Shard.RecordCodec.Decompress(CompressedData, Decompressed);
     }
+    if (!bDecompressed)
+    {
+        UE_LOG(LogHexademicLattice, Warning, TEXT("No readable record to decompress Memory %s from (DUIDS Index %s)."), *Memory.MemoryID.ToString(), *FHexademic6PackedKey(Index).ToHexString());
+        return;
+    }
+    Memory = MoveTemp(Decompressed);
+    Memory.QuickAccessIndex = Index;
+    Memory.DecompressForAccess(); // Calls the inlined method
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Decompressed Memory %s."), *Memory.MemoryID.ToString());
 }
 
 float FDUIDSOrchestrator::GetCompressionRatio(ECognitiveLatticeOrder Order) const
 {
-    // Placeholder: Returns the average compression ratio for memories in a given order.
-    // This would require tracking original vs. compressed sizes for each memory.
-    UE_LOG(LogHexademicLattice, Log, TEXT("Getting compression ratio for Order %d. (Placeholder)"), (uint8)Order);
-    // For demonstration, return a fixed value
-    return 0.75f; // 75% compression
+    // Stored bytes (frame header included) over serialized node bytes for every record of Order.
+    int64 RawBytes = 0;
+    int64 StoredBytes = 0;
+    for (const FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        RawBytes += Shard.RawBytesByOrder[(uint8)Order];
+        StoredBytes += Shard.StoredBytesByOrder[(uint8)Order];
+    }
+    return RawBytes > 0 ? (float)((double)StoredBytes / (double)RawBytes) : 1.0f;
 }
 
 TOptional<float> FDUIDSOrchestrator::GetMemoryResonance(const FDUIDSIndex& Index)
 {
     // Retrieves memory resonance directly from cache or by partial decompression.
-    if (float* Resonance = ResonanceCache.Find(Index))
     {
-        return *Resonance;
+        FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+        FScopeLock CacheScope(&Shard.CacheLock);
+        FHexademic6CachedSlices Cached;
+        if (Shard.Cache.FindSlices(Index, Cached))
+        {
+            return Cached.ResonanceStrength;
+        }
     }
-    // Placeholder for partial decompression or fetching from the main memory storage
-    UE_LOG(LogHexademicLattice, Verbose, TEXT("Getting memory resonance for %s. (Not in cache, requires partial fetch)"), *Index.ToDecimalString());
-    if (TOptional<FHexademicMemoryNode> Memory = RetrieveByIndex(Index, false)) // Retrieve without full decompression
+    // Cache miss: read the uncompressed slice header of the record instead of decompressing it.
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Getting memory resonance for %s. (Not in cache, reading record header)"), *FHexademic6PackedKey(Index).ToHexString());
+    FHexademic6RecordSliceHeader Slices;
+    if (ReadRecordSlices(Index, Slices)) // Also caches them for future access
     {
-        UpdateCachesForMemory(Index, Memory.GetValue()); // Update cache for future access
-        return Memory->ResonanceStrength;
+        return Slices.ResonanceStrength;
     }
     return TOptional<float>();
 }
@@ -130,99 +668,275 @@ TOptional<float> FDUIDSOrchestrator::GetMemoryResonance(const FDUIDSIndex& Index
 TOptional<FVector> FDUIDSOrchestrator::GetEmotionalSignature(const FDUIDSIndex& Index)
 {
     // Retrieves emotional signature directly from cache or by partial decompression.
-    if (FVector* Signature = EmotionalSignatureCache.Find(Index))
     {
-        return *Signature;
+        FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+        FScopeLock CacheScope(&Shard.CacheLock);
+        FHexademic6CachedSlices Cached;
+        if (Shard.Cache.FindSlices(Index, Cached))
+        {
+            return Cached.EmotionalSignature;
+        }
     }
-    // Placeholder for partial decompression or fetching from the main memory storage
-    UE_LOG(LogHexademicLattice, Verbose, TEXT("Getting emotional signature for %s. (Not in cache, requires partial fetch)"), *Index.ToDecimalString());
-    if (TOptional<FHexademicMemoryNode> Memory = RetrieveByIndex(Index, false))
+    // Cache miss: read the uncompressed slice header of the record instead of decompressing it.
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Getting emotional signature for %s. (Not in cache, reading record header)"), *FHexademic6PackedKey(Index).ToHexString());
+    FHexademic6RecordSliceHeader Slices;
+    if (ReadRecordSlices(Index, Slices)) // Also caches them for future access
     {
-        UpdateCachesForMemory(Index, Memory.GetValue());
-        return FVector(Memory->EmotionalValence, Memory->EmotionalIntensity, Memory->MythicDepth); // Example vector
+        return Slices.GetEmotionalSignature();
     }
     return TOptional<FVector>();
 }
 
 TArray<FDUIDSIndex> FDUIDSOrchestrator::GetCrossReferences(const FDUIDSIndex& Index)
 {
-    // Retrieves cross-references for a memory, potentially without full decompression.
-    UE_LOG(LogHexademicLattice, Log, TEXT("Getting cross-references for %s. (Requires partial fetch)"), *Index.ToDecimalString());
-    if (TOptional<FHexademicMemoryNode> Memory = RetrieveByIndex(Index, false))
+    // Retrieves cross-references from the uncompressed slice area of the record.
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Getting cross-references for %s."), *FHexademic6PackedKey(Index).ToHexString());
+    TArray<FDUIDSIndex> CrossReferences;
+    ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order6;
+    bool bFound = false;
+    {
+        const FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+        FReadScopeLock ReadLock(Shard.Lock);
+        const TConstArrayView<uint8> Record = FindRecordLocked(Shard, Index);
+        bFound = FindMemoryIDLocked(Shard, Index) && DUIDSOrchestratorPrivate::ReadRecordOrder(Record, Order)
+            && FHexademic6RecordCodec::ReadCrossReferences(Record, CrossReferences);
+    }
+    if (bFound)
     {
-        return Memory->CrossReferences;
+        RecordAccess(Index, Order);
     }
-    return TArray<FDUIDSIndex>();
+    return CrossReferences;
 }
 
-void FDUIDSOrchestrator::TrackMemoryAccess(const FDUIDSIndex& Index)
+TArray<FDUIDSIndex> FDUIDSOrchestrator::GetCrossReferencesWithinHops(const FDUIDSIndex& Index, int32 MaxHops)
 {
-    // Tracks when a memory is accessed, updating counts and timestamps.
-    AccessCounts.FindOrAdd(Index)++;
-    LastAccessTimes.Add(Index, FPlatformTime::Seconds());
-    UE_LOG(LogHexademicLattice, Verbose, TEXT("Tracked access for DUIDS Index %s. Count: %d"), *Index.ToDecimalString(), AccessCounts[Index]);
+    // Every memory reachable through at most MaxHops cross references, nearest first. Walks the
+    // cross-reference graph; no record is read. The graph keeps nodes for keys that were since
+    // retired by re-indexing or removal, so those are dropped once GraphLock is released.
+    TArray<FDUIDSIndex> Result;
+    {
+        FReadScopeLock GraphScope(GraphLock);
+        TArray<int32> Nodes;
+        CrossReferenceGraph.GatherWithinHops(CrossReferenceGraph.FindNode(Index), MaxHops, Nodes);
+        Result.Reserve(Nodes.Num());
+        for (const int32 Node : Nodes)
+        {
+            Result.Add(CrossReferenceGraph.GetKey(Node));
+        }
+    }
+    Result.RemoveAll([this](const FDUIDSIndex& Key) { return !DUIDSOrchestratorPrivate::IsKeyLive(Shards, Key); });
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Found %d memories within %d cross-reference hops of %s."), Result.Num(), MaxHops, *FHexademic6PackedKey(Index).ToHexString());
+    return Result;
 }
 
-TArray<FDUIDSIndex> FDUIDSOrchestrator::GetMostAccessed(int32 Count, ECognitiveLatticeOrder Order)
+bool FDUIDSOrchestrator::IsCrossReferenceReachable(const FDUIDSIndex& From, const FDUIDSIndex& To, int32 MaxHops) const
 {
-    // Returns the DUIDS indices of the most frequently accessed memories within a given order.
-    TArray<FDUIDSIndex> MostAccessedIndices;
-    TArray<FDUIDSIndex> AllIndices;
-    AccessCounts.GetKeys(AllIndices);
+    // A retired key's node stays in the graph, with edges from memories that still list it.
+    if (!DUIDSOrchestratorPrivate::IsKeyLive(Shards, To))
+    {
+        return false;
+    }
+    FReadScopeLock GraphScope(GraphLock);
+    return CrossReferenceGraph.IsReachable(CrossReferenceGraph.FindNode(From), CrossReferenceGraph.FindNode(To), MaxHops);
+}
 
-    // Filter by order (assuming DUIDSIndex can be mapped to an order, or memory itself can)
-    // For simplicity, this example just takes from all accessed, then sorts.
-    AllIndices.Sort([this](const FDUIDSIndex& A, const FDUIDSIndex& B)
+TArray<FDUIDSIndex> FDUIDSOrchestrator::FindCrossReferencePath(const FDUIDSIndex& From, const FDUIDSIndex& To) const
+{
+    // Cheapest chain of cross references from From to To, both included; empty if there is none.
+    // A hop costs 1, plus up to 1 more the weaker the resonance of the memory it reaches, so of
+    // equally long chains the most resonant one wins. As in IsCrossReferenceReachable, a retired
+    // To keeps its node while live memories still reference it.
+    TArray<FDUIDSIndex> Path;
+    if (!DUIDSOrchestratorPrivate::IsKeyLive(Shards, To))
     {
-        return AccessCounts.FindOrAdd(A) > AccessCounts.FindOrAdd(B); // Sort descending by count
-    });
+        return Path;
+    }
+    FReadScopeLock GraphScope(GraphLock);
+    const FHexademic6CrossReferenceGraph& Graph = CrossReferenceGraph;
+    TArray<int32> Nodes;
+    const float Cost = Graph.FindCheapestPath(Graph.FindNode(From), Graph.FindNode(To), [&Graph](int32 Source, int32 Target)
+    {
+        return 2.0f - FMath::Clamp(Graph.GetWeight(Target), 0.0f, 1.0f);
+    }, Nodes);
+    if (Cost >= 0.0f)
+    {
+        Path.Reserve(Nodes.Num());
+        for (const int32 Node : Nodes)
+        {
+            Path.Add(Graph.GetKey(Node));
+        }
+    }
+    return Path;
+}
 
-    for (int32 i = 0; i < FMath::Min(Count, AllIndices.Num()); ++i)
+void FDUIDSOrchestrator::TrackMemoryAccess(const FDUIDSIndex& Index)
+{
+    // Tracks when a memory is accessed. The order comes from the record's frame header; the
+    // internal read paths already have it and call RecordAccess directly.
+    ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order6;
+    bool bFound = false;
     {
-        MostAccessedIndices.Add(AllIndices[i]);
+        const FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+        FReadScopeLock ReadLock(Shard.Lock);
+        bFound = DUIDSOrchestratorPrivate::ReadRecordOrder(FindRecordLocked(Shard, Index), Order);
     }
+    if (bFound)
+    {
+        RecordAccess(Index, Order);
+    }
+}
+
+void FDUIDSOrchestrator::RecordAccess(const FDUIDSIndex& Index, ECognitiveLatticeOrder Order)
+{
+    // A thread-local append; counts, heavy hitters and access windows are updated lazily by
+    // the tracker. Accesses are not logged: access statistics are approximate and reach disk with
+    // the next snapshot.
+    AccessTracker.RecordAccess(Index, Order, FPlatformTime::Seconds());
+}
+
+TArray<FDUIDSIndex> FDUIDSOrchestrator::GetMostAccessed(int32 Count, ECognitiveLatticeOrder Order)
+{
+    // Returns the DUIDS indices of the most frequently accessed memories within a given order,
+    // read off the order's space-saving summary in O(Count). Any memory accessed more than
+    // 1/Hexademic.Access.TopKCapacity of the order's accesses is guaranteed to be included.
+    TArray<FDUIDSIndex> MostAccessedIndices;
+    AccessTracker.GetMostAccessed(Order, Count, MostAccessedIndices);
     UE_LOG(LogHexademicLattice, Log, TEXT("Retrieved %d most accessed DUIDS indices for Order %d."), MostAccessedIndices.Num(), (uint8)Order);
     return MostAccessedIndices;
 }
 
 TMap<FDUIDSIndex, int32> FDUIDSOrchestrator::GetAccessPatterns(float TimeWindow)
 {
-    // Returns access patterns (index to count) within a specified time window.
+    // Returns access patterns (index to access count within the window) for memories accessed
+    // within a specified time window. Reads the tracker's bucketed counters, so the cost does
+    // not depend on how many memories were ever accessed; the bucket the window start falls in
+    // is counted pro rata (see FHexademic6AccessWindow and Hexademic.Access.WindowTiers).
     TMap<FDUIDSIndex, int32> Patterns;
-    double CurrentTime = FPlatformTime::Seconds();
-    for (const auto& Pair : LastAccessTimes)
-    {
-        if ((CurrentTime - Pair.Value) <= TimeWindow)
-        {
-            Patterns.Add(Pair.Key, AccessCounts.FindOrAdd(Pair.Key));
-        }
-    }
+    AccessTracker.GetAccessedSince(FPlatformTime::Seconds() - TimeWindow, Patterns);
     UE_LOG(LogHexademicLattice, Log, TEXT("Retrieved %d access patterns within %f seconds."), Patterns.Num(), TimeWindow);
     return Patterns;
 }
 
 void FDUIDSOrchestrator::OptimizeIndices(ECognitiveLatticeOrder Order)
 {
-    // Placeholder: Optimizes the internal index structure for a given order.
-    // This could involve re-balancing, defragmentation, or re-clustering.
-    UE_LOG(LogHexademicLattice, Log, TEXT("Optimizing DUIDS indices for Order %d. (Placeholder)"), (uint8)Order);
+    // Optimizes the internal index structure: repacks each shard's ordered index into full
+    // blocks, which removes the slack left behind by splits and removals. Shards are locked one
+    // at a time, so the rest of the store stays available.
+    // Fragmentation is averaged over shards weighted by block count, as in GetIndexFragmentation.
+    double EmptyBefore = 0.0;
+    double EmptyAfter = 0.0;
+    int32 BlocksBefore = 0;
+    int32 BlocksAfter = 0;
+    int64 AllocatedBefore = 0;
+    int64 AllocatedAfter = 0;
+    int32 NumCompacted = 0;
+    for (FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        FWriteScopeLock WriteLock(Shard.Lock);
+        EmptyBefore += (double)Shard.OrderedIndex.GetFragmentation() * Shard.OrderedIndex.NumBlocks();
+        BlocksBefore += Shard.OrderedIndex.NumBlocks();
+        Shard.OrderedIndex.Compact();
+        EmptyAfter += (double)Shard.OrderedIndex.GetFragmentation() * Shard.OrderedIndex.NumBlocks();
+        BlocksAfter += Shard.OrderedIndex.NumBlocks();
+
+        // Repack the order's record arena once a quarter of its written bytes belong to replaced records.
+        FHexademic6RecordArena& Arena = Shard.RecordArenas[(uint8)Order];
+        if (Arena.GetDeadRatio() > 0.25f)
+        {
+            TArray<FHexademicRecordHandle*> LiveHandles;
+            for (THexademic6FlatMap<FHexademicRecordLocation>::FEntry& Entry : Shard.CompressedMemoryStorage)
+            {
+                if (Entry.Value.Order == Order)
+                {
+                    LiveHandles.Add(&Entry.Value.Handle);
+                }
+            }
+            AllocatedBefore += Arena.GetAllocatedBytes();
+            Arena.Compact(LiveHandles);
+            AllocatedAfter += Arena.GetAllocatedBytes();
+            ++NumCompacted;
+        }
+    }
+    UE_LOG(LogHexademicLattice, Log, TEXT("Optimized DUIDS indices for Order %d. Fragmentation %f -> %f over %d blocks."),
+        (uint8)Order, BlocksBefore > 0 ? EmptyBefore / BlocksBefore : 0.0, BlocksAfter > 0 ? EmptyAfter / BlocksAfter : 0.0, BlocksAfter);
+    if (NumCompacted > 0)
+    {
+        UE_LOG(LogHexademicLattice, Log, TEXT("Compacted %d record arenas for Order %d: %lld -> %lld bytes allocated."),
+            NumCompacted, (uint8)Order, AllocatedBefore, AllocatedAfter);
+    }
 }
 
 void FDUIDSOrchestrator::RebuildIndexForOrder(ECognitiveLatticeOrder Order)
 {
-    // Placeholder: Rebuilds the DUIDS index entirely for a specific lattice order.
+    // Rebuilds Order's entries in each shard's ordered DUIDS index from its authoritative index
+    // map; entries of other orders are kept as they are. Morton keys carry their order in their
+    // prefix. Axis-sliced keys do not, so their record's frame header is read instead, and keys
+    // without a readable record count as Order's, which drops stale entries of them.
     // This is a costly operation typically done during maintenance.
-    UE_LOG(LogHexademicLattice, Log, TEXT("Rebuilding DUIDS index for Order %d. (Placeholder)"), (uint8)Order);
-    // You'd iterate through all memories in that order and regenerate/re-add their DUIDS indices.
+    const bool bMorton = FHexademic6DUIDSCurve::GetEncodingMode() == EDUIDSEncodingMode::Morton;
+    int32 NumEntries = 0;
+    for (FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        FWriteScopeLock WriteLock(Shard.Lock);
+        const auto IsOrderKey = [this, &Shard, Order, bMorton](const FDUIDSIndex& Key)
+        {
+            if (bMorton)
+            {
+                return FHexademic6DUIDSCurve::GetKeyOrder(Key) == Order;
+            }
+            ECognitiveLatticeOrder KeyOrder;
+            return !DUIDSOrchestratorPrivate::ReadRecordOrder(FindRecordLocked(Shard, Key), KeyOrder) || KeyOrder == Order;
+        };
+
+        TArray<FHexademic6PackedKey> PackedIndices;
+        for (const THexademic6FlatMap<FGuid>::FEntry& Entry : Shard.IndexToMemoryMap)
+        {
+            if (IsOrderKey(Entry.Key.Unpack()))
+            {
+                PackedIndices.Add(Entry.Key);
+            }
+        }
+        PackedIndices.Sort(); // Packed keys order like the keys they pack, in two compares
+
+        // Kept entries first, rebuilt ones after: two sorted runs over disjoint keys.
+        TArray<FDUIDSIndex> Runs;
+        Runs.Reserve(Shard.OrderedIndex.Num() + PackedIndices.Num());
+        Shard.OrderedIndex.ForEach([&Runs, &IsOrderKey](const FDUIDSIndex& Key)
+        {
+            if (!IsOrderKey(Key))
+            {
+                Runs.Add(Key);
+            }
+            return true;
+        });
+        const int32 RunStarts[3] = { 0, Runs.Num(), Runs.Num() + PackedIndices.Num() };
+        for (const FHexademic6PackedKey& Key : PackedIndices)
+        {
+            Runs.Add(Key.Unpack());
+        }
+        TArray<FDUIDSIndex> AllIndices;
+        DUIDSOrchestratorPrivate::MergeSortedRuns(Runs, RunStarts, AllIndices);
+        Shard.OrderedIndex.BuildFromSorted(AllIndices);
+        NumEntries += PackedIndices.Num();
+    }
+    UE_LOG(LogHexademicLattice, Log, TEXT("Rebuilt DUIDS index for Order %d with %d entries."), (uint8)Order, NumEntries);
 }
 
 float FDUIDSOrchestrator::GetIndexFragmentation(ECognitiveLatticeOrder Order) const
 {
-    // Placeholder: Calculates a metric for the fragmentation of the DUIDS index.
+    // Share of empty slots across every shard's ordered index blocks.
     // Lower fragmentation means more efficient sequential access.
-    UE_LOG(LogHexademicLattice, Log, TEXT("Getting DUIDS index fragmentation for Order %d. (Placeholder)"), (uint8)Order);
-    // For demonstration, return a fixed value
-    return FMath::RandRange(0.0f, 1.0f);
+    double EmptyBlocks = 0.0;
+    int32 NumBlocks = 0;
+    for (const FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        EmptyBlocks += (double)Shard.OrderedIndex.GetFragmentation() * Shard.OrderedIndex.NumBlocks();
+        NumBlocks += Shard.OrderedIndex.NumBlocks();
+    }
+    const float Fragmentation = NumBlocks > 0 ? (float)(EmptyBlocks / NumBlocks) : 0.0f;
+    UE_LOG(LogHexademicLattice, Log, TEXT("DUIDS index fragmentation for Order %d: %f"), (uint8)Order, Fragmentation);
+    return Fragmentation;
 }
 
 // =============================================================================
@@ -231,57 +945,731 @@ float FDUIDSOrchestrator::GetIndexFragmentation(ECognitiveLatticeOrder Order) co
 
 FDUIDSIndex FDUIDSOrchestrator::GenerateIndexFromCoordinate(const FHexademic6DCoordinate& Coord, ECognitiveLatticeOrder Order)
 {
-    // This helper maps directly to FHexademic6DCoordinate's UpdateDUIDSIndex,
+    // In axis-sliced mode this maps directly to FHexademic6DCoordinate's UpdateDUIDSIndex,
     // ensuring consistency. The DUIDSLocation should already be set on the Coord.
+    // In Morton mode the key is the coordinate's 6D Z-order code, so DUIDS order follows locality.
+    if (FHexademic6DUIDSCurve::GetEncodingMode() == EDUIDSEncodingMode::Morton)
+    {
+        FHexademic6DCoordinate OrderedCoord = Coord;
+        OrderedCoord.LatticeOrder = Order;
+        return FHexademic6DUIDSCurve::Encode(OrderedCoord);
+    }
     FDUIDSIndex Index = Coord.DUIDSLocation;
     return Index;
 }
 
-void FDUIDSOrchestrator::UpdateCachesForMemory(const FDUIDSIndex& Index, const FHexademicMemoryNode& Memory)
+void FDUIDSOrchestrator::ApplyIndexPut(const FDUIDSIndex& Index, const FGuid& MemoryID)
 {
-    // Populates sliced data caches for fast retrieval.
-    ResonanceCache.Add(Index, Memory.ResonanceStrength);
-    EmotionalSignatureCache.Add(Index, FVector(Memory.EmotionalValence, Memory.EmotionalIntensity, Memory.MythicDepth));
-    UE_LOG(LogHexademicLattice, Verbose, TEXT("Updated caches for DUIDS Index %s."), *Index.ToDecimalString());
+    // Re-indexing a memory retires its previous key so the ordered index never holds stale entries.
+    // The memory's MemoryLock is held throughout, so concurrent re-indexings of one memory run
+    // one after the other and the key they leave mapped is the one MemoryToIndexMap names. Key
+    // shards are locked one after another inside it, never together (see FDUIDSOrchestratorShard).
+    using namespace DUIDSOrchestratorPrivate;
+    FDUIDSIndex PreviousIndex;
+    bool bRetirePrevious = false;
+    FDUIDSOrchestratorShard& MemoryShard = ShardForMemory(Shards, MemoryID);
+    FWriteScopeLock MemoryScope(MemoryShard.MemoryLock);
+    if (FDUIDSIndex* Existing = MemoryShard.MemoryToIndexMap.Find(MemoryID))
+    {
+        bRetirePrevious = !(*Existing == Index);
+        PreviousIndex = *Existing;
+        *Existing = Index;
+    }
+    else
+    {
+        MemoryShard.MemoryToIndexMap.Add(MemoryID, Index);
+    }
+    if (bRetirePrevious)
+    {
+        FDUIDSOrchestratorShard& PreviousShard = ShardForIndex(Shards, PreviousIndex);
+        FWriteScopeLock WriteLock(PreviousShard.Lock);
+        const FGuid* Owner = PreviousShard.IndexToMemoryMap.Find(PreviousIndex);
+        if (Owner && *Owner == MemoryID)
+        {
+            PreviousShard.IndexToMemoryMap.Remove(PreviousIndex);
+            PreviousShard.OrderedIndex.Remove(PreviousIndex);
+            InvalidateCachesForIndex(PreviousIndex);
+        }
+    }
+
+    FDUIDSOrchestratorShard& Shard = ShardForIndex(Shards, Index);
+    FWriteScopeLock WriteLock(Shard.Lock);
+    Shard.IndexToMemoryMap.Add(Index, MemoryID);
+    Shard.OrderedIndex.Add(Index);
+    InvalidateCachesForIndex(Index);
+
+    uint8 Prefix[FHexademic6WriteAheadLog::KeySize + sizeof(FGuid)];
+    FHexademic6WriteAheadLog::WriteKey(Prefix, Index);
+    FMemory::Memcpy(Prefix + FHexademic6WriteAheadLog::KeySize, &MemoryID, sizeof(FGuid));
+    LogMutation(EHexademic6WalRecordType::IndexPut, Prefix);
+}
+
+void FDUIDSOrchestrator::StoreRecordLocationLocked(FDUIDSOrchestratorShard& Shard, const FDUIDSIndex& Index, const FHexademicRecordLocation& Location)
+{
+    // Keep the per-order size accounting exact when a record is replaced.
+    if (const FHexademicRecordLocation* Previous = Shard.CompressedMemoryStorage.Find(Index))
+    {
+        ReleaseRecordLocked(Shard, *Previous);
+    }
+    FHexademic6RecordFrameHeader Header;
+    if (FHexademic6RecordCodec::ReadFrameHeader(Shard.RecordArenas[(uint8)Location.Order].Get(Location.Handle), Header))
+    {
+        Shard.RawBytesByOrder[(uint8)Location.Order] += Header.RawSize;
+        Shard.StoredBytesByOrder[(uint8)Location.Order] += Location.Handle.Length;
+    }
+    Shard.CompressedMemoryStorage.Add(Index, Location);
+    InvalidateCachesForIndex(Index);
+    UpdateCrossReferenceGraph(Index, Shard.RecordArenas[(uint8)Location.Order].Get(Location.Handle));
+}
+
+void FDUIDSOrchestrator::RemoveRecordLocked(FDUIDSOrchestratorShard& Shard, const FDUIDSIndex& Index)
+{
+    // A mounted segment may hold an older record under the key, which would resurface once the
+    // arena record is gone; it is shadowed for as long as the segment stays mounted.
+    bool bInSegment = false;
+    {
+        FReadScopeLock SegmentsScope(SegmentsLock);
+        for (const TUniquePtr<FHexademic6Segment>& Segment : MountedSegments)
+        {
+            bInSegment |= Segment->FindEntry(Index) != nullptr;
+        }
+    }
+    if (bInSegment)
+    {
+        Shard.RemovedSegmentRecords.Add(Index);
+    }
+    FHexademicRecordLocation Location;
+    if (Shard.CompressedMemoryStorage.RemoveAndCopyValue(Index, Location))
+    {
+        ReleaseRecordLocked(Shard, Location);
+    }
+    else if (!bInSegment)
+    {
+        return;
+    }
+    InvalidateCachesForIndex(Index);
+    {
+        FWriteScopeLock GraphScope(GraphLock);
+        CrossReferenceGraph.RemoveReferences(Index, DUIDSOrchestratorPrivate::StoredReferencePriority);
+    }
+
+    uint8 Prefix[FHexademic6WriteAheadLog::KeySize];
+    FHexademic6WriteAheadLog::WriteKey(Prefix, Index);
+    LogMutation(EHexademic6WalRecordType::RecordRemove, Prefix);
+}
+
+void FDUIDSOrchestrator::UpdateCrossReferenceGraph(const FDUIDSIndex& Index, TConstArrayView<uint8> Record)
+{
+    // Called with Index's shard locked for writing. GraphLock is only ever taken after shard
+    // locks, never before.
+    FHexademic6RecordSliceHeader Slices;
+    TArray<FDUIDSIndex> References;
+    if (FHexademic6RecordCodec::ReadSliceHeader(Record, Slices) && FHexademic6RecordCodec::ReadCrossReferences(Record, References))
+    {
+        FWriteScopeLock GraphScope(GraphLock);
+        CrossReferenceGraph.SetReferences(Index, References, Slices.ResonanceStrength, DUIDSOrchestratorPrivate::StoredReferencePriority);
+    }
+}
+
+void FDUIDSOrchestrator::ReleaseRecordLocked(FDUIDSOrchestratorShard& Shard, const FHexademicRecordLocation& Location)
+{
+    FHexademic6RecordArena& Arena = Shard.RecordArenas[(uint8)Location.Order];
+    FHexademic6RecordFrameHeader Header;
+    if (FHexademic6RecordCodec::ReadFrameHeader(Arena.Get(Location.Handle), Header))
+    {
+        Shard.RawBytesByOrder[(uint8)Location.Order] -= Header.RawSize;
+        Shard.StoredBytesByOrder[(uint8)Location.Order] -= Location.Handle.Length;
+    }
+    Arena.Free(Location.Handle);
+}
+
+void FDUIDSOrchestrator::UpdateCachesForMemory(const FDUIDSIndex& Index, const FHexademicMemoryNode& Memory)
+{
+    // Populates the cache with a decoded node and its sliced data for fast retrieval.
+    FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+    {
+        const int64 PayloadBytes = Memory.EventType.GetAllocatedSize() + Memory.EventData.GetAllocatedSize() + Memory.CrossReferences.GetAllocatedSize();
+        FScopeLock CacheScope(&Shard.CacheLock);
+        Shard.Cache.AddNode(Index, Memory, PayloadBytes);
+    }
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Updated caches for DUIDS Index %s."), *FHexademic6PackedKey(Index).ToHexString());
+}
+
+void FDUIDSOrchestrator::SetCacheBudget(int64 BudgetBytes)
+{
+    for (FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        FScopeLock CacheScope(&Shard.CacheLock);
+        Shard.Cache.SetBudget(BudgetBytes / FDUIDSOrchestratorShard::NumShards);
+    }
+}
+
+FHexademic6CacheStats FDUIDSOrchestrator::GetCacheStats() const
+{
+    FHexademic6CacheStats Stats;
+    for (const FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        FScopeLock CacheScope(&Shard.CacheLock);
+        Stats += Shard.Cache.GetStats();
+    }
+    return Stats;
+}
+
+TConstArrayView<uint8> FDUIDSOrchestrator::FindRecordLocked(const FDUIDSOrchestratorShard& Shard, const FDUIDSIndex& Index) const
+{
+    // In-memory records shadow mounted segments, and newer segments shadow older ones. Segment
+    // records of retired keys are skipped. The view stays valid while the caller holds the
+    // shard's lock.
+    if (const FHexademicRecordLocation* Location = Shard.CompressedMemoryStorage.Find(Index))
+    {
+        return Shard.RecordArenas[(uint8)Location->Order].Get(Location->Handle);
+    }
+    FReadScopeLock SegmentsScope(SegmentsLock);
+    for (int32 SegmentIndex = MountedSegments.Num() - 1; SegmentIndex >= 0; --SegmentIndex)
+    {
+        const FHexademic6SegmentEntry* Entry = MountedSegments[SegmentIndex]->FindEntry(Index);
+        if (Entry && DUIDSOrchestratorPrivate::IsSegmentEntryLive(Shard, *Entry))
+        {
+            return MountedSegments[SegmentIndex]->GetRecord(*Entry);
+        }
+    }
+    return TConstArrayView<uint8>();
+}
+
+TConstArrayView<uint8> FDUIDSOrchestrator::FindRetiredRecordLocked(const FDUIDSOrchestratorShard& Shard, const FDUIDSIndex& Index, const FGuid& MemoryID) const
+{
+    // FindRecordLocked for a key MemoryID was just re-indexed away from: its segment record no
+    // longer passes IsSegmentEntryLive, but is still the memory's own unless it was removed.
+    if (const FHexademicRecordLocation* Location = Shard.CompressedMemoryStorage.Find(Index))
+    {
+        return Shard.RecordArenas[(uint8)Location->Order].Get(Location->Handle);
+    }
+    if (Shard.RemovedSegmentRecords.Contains(Index))
+    {
+        return TConstArrayView<uint8>();
+    }
+    FReadScopeLock SegmentsScope(SegmentsLock);
+    for (int32 SegmentIndex = MountedSegments.Num() - 1; SegmentIndex >= 0; --SegmentIndex)
+    {
+        const FHexademic6SegmentEntry* Entry = MountedSegments[SegmentIndex]->FindEntry(Index);
+        if (Entry && Entry->MemoryID == MemoryID)
+        {
+            return MountedSegments[SegmentIndex]->GetRecord(*Entry);
+        }
+    }
+    return TConstArrayView<uint8>();
+}
+
+const FGuid* FDUIDSOrchestrator::FindMemoryIDLocked(const FDUIDSOrchestratorShard& Shard, const FDUIDSIndex& Index) const
+{
+    // The live map is authoritative: mounting a segment indexes its keys, so a key a segment
+    // still lists but the map no longer has was retired.
+    return Shard.IndexToMemoryMap.Find(Index);
+}
+
+// =============================================================================
+// SEGMENT PERSISTENCE
+// =============================================================================
+
+bool FDUIDSOrchestrator::SaveSegment(const FString& Path) const
+{
+    // Snapshots every visible record into one immutable segment. The store is only locked while
+    // the records are copied; the file is written after the locks are released.
+    TArray<FHexademic6SegmentRecordSource> Sources;
+    TArray64<uint8> RecordCopies;
+    TMap<uint32, TArray<uint8>> Dictionaries;
+    {
+        DUIDSOrchestratorPrivate::FAllShardsReadScope AllShards(Shards);
+        GatherSegmentSourcesLocked(Sources, RecordCopies);
+        GatherDictionariesLocked(Dictionaries);
+    }
+    return FHexademic6Segment::Write(Path, Sources, Dictionaries);
+}
+
+void FDUIDSOrchestrator::GatherSegmentSourcesLocked(TArray<FHexademic6SegmentRecordSource>& OutSources, TArray64<uint8>& OutRecordCopies) const
+{
+    // In-memory records first, then whatever live records the mounted segments still contribute.
+    // Arena records are copied so the sources stay valid once the shard locks are released;
+    // segment records point into their immutable mappings. Every shard must be read-locked.
+    int32 NumRecords = 0;
+    int64 CopyBytes = 0;
+    for (const FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        NumRecords += Shard.CompressedMemoryStorage.Num();
+        for (const THexademic6FlatMap<FHexademicRecordLocation>::FEntry& Entry : Shard.CompressedMemoryStorage)
+        {
+            CopyBytes += Entry.Value.Handle.Length;
+        }
+    }
+    OutSources.Reset(NumRecords);
+    OutRecordCopies.Reset(CopyBytes); // Reserved up front, so the views below stay valid
+
+    TSet<FDUIDSIndex> Written;
+    for (const FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        for (const THexademic6FlatMap<FHexademicRecordLocation>::FEntry& Entry : Shard.CompressedMemoryStorage)
+        {
+            const FGuid* MemoryID = Shard.IndexToMemoryMap.Find(Entry.Key);
+            if (!MemoryID)
+            {
+                continue;
+            }
+            const FDUIDSIndex Key = Entry.Key.Unpack();
+            const TConstArrayView<uint8> Record = Shard.RecordArenas[(uint8)Entry.Value.Order].Get(Entry.Value.Handle);
+            const int64 CopyOffset = OutRecordCopies.Num();
+            OutRecordCopies.Append(Record.GetData(), Record.Num());
+
+            FHexademic6SegmentRecordSource& Source = OutSources.AddDefaulted_GetRef();
+            Source.Key = Key;
+            Source.MemoryID = *MemoryID;
+            Source.Order = Entry.Value.Order;
+            Source.Record = TConstArrayView<uint8>(OutRecordCopies.GetData() + CopyOffset, Record.Num());
+            Written.Add(Key);
+        }
+    }
+
+    FReadScopeLock SegmentsScope(SegmentsLock);
+    for (int32 SegmentIndex = MountedSegments.Num() - 1; SegmentIndex >= 0; --SegmentIndex)
+    {
+        const FHexademic6Segment& Segment = *MountedSegments[SegmentIndex];
+        for (const FHexademic6SegmentEntry& Entry : Segment.GetEntries())
+        {
+            if (!DUIDSOrchestratorPrivate::IsSegmentEntryLive(DUIDSOrchestratorPrivate::ShardForIndex(Shards, Entry.GetKey()), Entry))
+            {
+                continue;
+            }
+            bool bAlreadyWritten = false;
+            Written.Add(Entry.GetKey(), &bAlreadyWritten);
+            if (!bAlreadyWritten)
+            {
+                FHexademic6SegmentRecordSource& Source = OutSources.AddDefaulted_GetRef();
+                Source.Key = Entry.GetKey();
+                Source.MemoryID = Entry.MemoryID;
+                Source.Order = (ECognitiveLatticeOrder)Entry.Order;
+                Source.Record = Segment.GetRecord(Entry);
+            }
+        }
+    }
+}
+
+void FDUIDSOrchestrator::GatherDictionariesLocked(TMap<uint32, TArray<uint8>>& OutDictionaries) const
+{
+    // Dictionary ids are content hashes, so shards that trained the same dictionary agree on it.
+    for (const FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        for (const TPair<uint32, TArray<uint8>>& Pair : Shard.RecordCodec.GetDictionaries())
+        {
+            if (!OutDictionaries.Contains(Pair.Key))
+            {
+                OutDictionaries.Add(Pair.Key, Pair.Value);
+            }
+        }
+    }
+}
+
+void FDUIDSOrchestrator::AddDictionaryToShards(uint32 DictionaryId, TConstArrayView<uint8> Dictionary)
+{
+    // Records from segments and the log may be read by any shard, so every codec gets a copy.
+    for (FDUIDSOrchestratorShard& Shard : Shards)
+    {
+        FWriteScopeLock WriteLock(Shard.Lock);
+        if (!Shard.RecordCodec.FindDictionary(DictionaryId))
+        {
+            Shard.RecordCodec.AddDictionary(DictionaryId, TArray<uint8>(Dictionary.GetData(), Dictionary.Num()));
+        }
+    }
+}
+
+bool FDUIDSOrchestrator::MountSegment(const FString& Path, bool bIndexKeys)
+{
+    // Maps a segment read-only. Its records are served from the mapping as-is; only the codec
+    // dictionaries it carries are copied, and the cross references in its records' uncompressed
+    // headers are added to the cross-reference graph. With bIndexKeys, every segment key whose
+    // key and memory are both still unindexed is indexed, which makes it reachable; keys already
+    // taken stay with their current memory. Recovery passes false and indexes from the snapshot.
+    TUniquePtr<FHexademic6Segment> Segment = FHexademic6Segment::Open(Path);
+    if (!Segment)
+    {
+        return false;
+    }
+    Segment->ForEachDictionary([this](uint32 DictionaryId, TConstArrayView<uint8> Dictionary)
+    {
+        AddDictionaryToShards(DictionaryId, Dictionary);
+    });
+    {
+        FHexademic6RecordSliceHeader Slices;
+        TArray<FDUIDSIndex> References;
+        FWriteScopeLock GraphScope(GraphLock);
+        for (const FHexademic6SegmentEntry& Entry : Segment->GetEntries())
+        {
+            const TConstArrayView<uint8> Record = Segment->GetRecord(Entry);
+            if (FHexademic6RecordCodec::ReadSliceHeader(Record, Slices) && FHexademic6RecordCodec::ReadCrossReferences(Record, References))
+            {
+                CrossReferenceGraph.SetReferences(Entry.GetKey(), References, Slices.ResonanceStrength, DUIDSOrchestratorPrivate::SegmentReferencePriority);
+            }
+        }
+    }
+    UE_LOG(LogHexademicLattice, Log, TEXT("Mounted DUIDS segment %s with %d records."), *Path, Segment->Num());
+    const FHexademic6Segment& Mounted = *Segment;
+    {
+        FWriteScopeLock SegmentsScope(SegmentsLock);
+        MountedSegments.Add(MoveTemp(Segment));
+    }
+
+    // The new segment's records shadow earlier removals of the same keys.
+    for (const FHexademic6SegmentEntry& Entry : Mounted.GetEntries())
+    {
+        const FDUIDSIndex Key = Entry.GetKey();
+        bool bUnindexed = false;
+        {
+            FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Key);
+            FWriteScopeLock WriteLock(Shard.Lock);
+            Shard.RemovedSegmentRecords.Remove(Key);
+            bUnindexed = !Shard.IndexToMemoryMap.Find(Key);
+        }
+        if (bIndexKeys && bUnindexed)
+        {
+            {
+                const FDUIDSOrchestratorShard& MemoryShard = DUIDSOrchestratorPrivate::ShardForMemory(Shards, Entry.MemoryID);
+                FReadScopeLock MemoryScope(MemoryShard.MemoryLock);
+                bUnindexed = !MemoryShard.MemoryToIndexMap.Contains(Entry.MemoryID);
+            }
+            if (bUnindexed)
+            {
+                ApplyIndexPut(Key, Entry.MemoryID);
+            }
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// DURABILITY
+// =============================================================================
+
+bool FDUIDSOrchestrator::EnableDurability(const FString& Directory)
+{
+    // Restores the newest snapshot and replays the log tail after it, then starts logging every
+    // mutation. Recovery cost is a segment mount plus the index maps plus the tail replay.
+    // Call it before storing memories and before other threads use the orchestrator; anything
+    // stored earlier becomes durable with the first snapshot.
+    if (WriteAheadLog)
+    {
+        UE_LOG(LogHexademicLattice, Warning, TEXT("Durability is already enabled in %s."), *DurabilityDirectory);
+        return false;
+    }
+    const double StartTime = FPlatformTime::Seconds();
+    DurabilityDirectory = Directory;
+
+    uint64 FirstGeneration = 0;
+    uint64 LastSequence = 0;
+    int32 NumRecovered = 0;
+    FHexademic6Snapshot Snapshot;
+    FString SegmentPath;
+    if (FHexademic6Snapshot::LoadLatest(Directory, Snapshot, SegmentPath))
+    {
+        if (!MountSegment(SegmentPath, false))
+        {
+            UE_LOG(LogHexademicLattice, Error, TEXT("Could not mount snapshot segment %s; recovery aborted."), *SegmentPath);
+            return false;
+        }
+        for (const TPair<FDUIDSIndex, FGuid>& Pair : Snapshot.IndexToMemory)
+        {
+            ApplyIndexPut(Pair.Key, Pair.Value);
+        }
+        for (const TPair<FDUIDSIndex, int32>& Pair : Snapshot.AccessCounts)
+        {
+            RestoreAccesses(Pair.Key, (uint32)FMath::Max(Pair.Value, 0));
+        }
+        FirstGeneration = Snapshot.WalGeneration;
+        LastSequence = Snapshot.Sequence;
+        NumRecovered = Snapshot.IndexToMemory.Num();
+    }
+
+    uint64 LastGeneration = 0;
+    LastSequence = FHexademic6WriteAheadLog::Replay(Directory, FirstGeneration, LastSequence,
+        [this](EHexademic6WalRecordType Type, TConstArrayView<uint8> Payload) { ApplyWalRecord(Type, Payload); }, LastGeneration);
+
+    // Never append to a recovered generation: its tail may have been torn.
+    WriteAheadLog = FHexademic6WriteAheadLog::Open(Directory, FMath::Max(FirstGeneration, LastGeneration + 1), LastSequence + 1);
+    if (!WriteAheadLog)
+    {
+        return false;
+    }
+    const double Now = FPlatformTime::Seconds();
+    LastSnapshotTime.store(Now);
+    UE_LOG(LogHexademicLattice, Log, TEXT("Recovered DUIDS store from %s (%d snapshot indices, log up to sequence %llu) in %.1f ms."),
+        *Directory, NumRecovered, LastSequence, (Now - StartTime) * 1000.0);
+    return true;
+}
+
+bool FDUIDSOrchestrator::BeginSnapshot()
+{
+    // Captures state under every shard's read lock and writes it on a worker. Capturing copies
+    // the maps and the arena records; mounted segment records are referenced, not copied. Once
+    // the snapshot is on disk, the log generations and snapshots it supersedes are deleted.
+    // Index and record mutations are logged under their shard's write lock, so the rotation
+    // splits the log exactly at the captured state. Access statistics are not logged; they are
+    // captured from the access tracker as they stand.
+    if (!WriteAheadLog || !SnapshotLock.TryLock())
+    {
+        return false;
+    }
+    ON_SCOPE_EXIT { SnapshotLock.Unlock(); };
+    if (PendingSnapshot.IsValid() && !PendingSnapshot.IsReady())
+    {
+        return false;
+    }
+
+    TUniquePtr<FHexademic6Snapshot> Snapshot = MakeUnique<FHexademic6Snapshot>();
+    {
+        DUIDSOrchestratorPrivate::FAllShardsReadScope AllShards(Shards);
+        Snapshot->WalGeneration = WriteAheadLog->Rotate(Snapshot->Sequence);
+        int32 NumIndices = 0;
+        for (const FDUIDSOrchestratorShard& Shard : Shards)
+        {
+            NumIndices += Shard.IndexToMemoryMap.Num();
+        }
+        Snapshot->IndexToMemory.Reserve(NumIndices);
+        for (const FDUIDSOrchestratorShard& Shard : Shards)
+        {
+            for (const THexademic6FlatMap<FGuid>::FEntry& Entry : Shard.IndexToMemoryMap)
+            {
+                Snapshot->IndexToMemory.Add(Entry.Key.Unpack(), Entry.Value);
+            }
+        }
+        AccessTracker.ForEachTracked([&Snapshot](const FDUIDSIndex& Key, uint32 Count)
+        {
+            Snapshot->AccessCounts.Add(Key, (int32)FMath::Min<uint32>(Count, MAX_int32));
+        });
+        GatherDictionariesLocked(Snapshot->Dictionaries);
+        GatherSegmentSourcesLocked(Snapshot->Records, Snapshot->RecordBytes);
+    }
+    LastSnapshotTime.store(FPlatformTime::Seconds());
+
+    FHexademic6WriteAheadLog* Log = WriteAheadLog.Get();
+    PendingSnapshot = Async(EAsyncExecution::ThreadPool, [Snapshot = MoveTemp(Snapshot), Directory = DurabilityDirectory, Log]()
+    {
+        if (!Snapshot->Write(Directory))
+        {
+            return false;
+        }
+        Log->DeleteGenerationsBefore(Snapshot->WalGeneration);
+        FHexademic6Snapshot::DeleteBefore(Directory, Snapshot->Sequence);
+        return true;
+    });
+    return true;
+}
+
+void FDUIDSOrchestrator::FlushWriteAheadLog()
+{
+    // Makes every mutation so far durable, whatever the sync policy.
+    if (WriteAheadLog)
+    {
+        WriteAheadLog->Flush(true);
+    }
+}
+
+void FDUIDSOrchestrator::RestoreAccesses(const FDUIDSIndex& Index, uint32 Count)
+{
+    // Recovered lifetime counts are credited to the order their record is stored under. They
+    // do not enter the access windows, which only cover this session.
+    ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order6;
+    {
+        const FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+        FReadScopeLock ReadLock(Shard.Lock);
+        DUIDSOrchestratorPrivate::ReadRecordOrder(FindRecordLocked(Shard, Index), Order);
+    }
+    AccessTracker.Restore(Index, Order, Count);
+}
+
+void FDUIDSOrchestrator::MaybeBeginSnapshot()
+{
+    // Called by mutators once they hold no shard lock, since a snapshot read-locks every shard.
+    // While snapshots are deferred, the last ResumeSnapshots makes the check instead.
+    if (!WriteAheadLog || SnapshotDeferrals.load() > 0)
+    {
+        return;
+    }
+    const int64 SnapshotBytes = (int64)CVarHexademicWALSnapshotMegabytes.GetValueOnAnyThread() << 20;
+    const float SnapshotInterval = CVarHexademicWALSnapshotIntervalSeconds.GetValueOnAnyThread();
+    const int64 LogBytes = WriteAheadLog->GetBytesSinceRotation();
+    if ((SnapshotBytes > 0 && LogBytes >= SnapshotBytes)
+        || (SnapshotInterval > 0.0f && LogBytes > 0 && FPlatformTime::Seconds() - LastSnapshotTime.load() >= SnapshotInterval))
+    {
+        BeginSnapshot();
+    }
+}
+
+void FDUIDSOrchestrator::LogMutation(EHexademic6WalRecordType Type, TConstArrayView<uint8> Prefix, TConstArrayView<uint8> Body)
+{
+    if (WriteAheadLog) // Null while durability is disabled, and during replay
+    {
+        WriteAheadLog->Append(Type, Prefix, Body);
+    }
+}
+
+void FDUIDSOrchestrator::LogRecordPutLocked(FDUIDSOrchestratorShard& Shard, const FDUIDSIndex& Index, ECognitiveLatticeOrder Order, TConstArrayView<uint8> Record)
+{
+    if (!WriteAheadLog)
+    {
+        return;
+    }
+    // A record is only replayable if its dictionary is, so a dictionary is logged before the
+    // first record that uses it.
+    FHexademic6RecordFrameHeader Header;
+    if (FHexademic6RecordCodec::ReadFrameHeader(Record, Header) && Header.DictionaryId != 0 && !Shard.LoggedDictionaries.Contains(Header.DictionaryId))
+    {
+        if (const TArray<uint8>* Dictionary = Shard.RecordCodec.FindDictionary(Header.DictionaryId))
+        {
+            LogMutation(EHexademic6WalRecordType::DictionaryPut, TConstArrayView<uint8>(reinterpret_cast<const uint8*>(&Header.DictionaryId), sizeof(uint32)), *Dictionary);
+            Shard.LoggedDictionaries.Add(Header.DictionaryId);
+        }
+    }
+    uint8 Prefix[FHexademic6WriteAheadLog::KeySize + 1];
+    FHexademic6WriteAheadLog::WriteKey(Prefix, Index);
+    Prefix[FHexademic6WriteAheadLog::KeySize] = (uint8)Order;
+    LogMutation(EHexademic6WalRecordType::RecordPut, Prefix, Record);
+}
+
+void FDUIDSOrchestrator::ApplyWalRecord(EHexademic6WalRecordType Type, TConstArrayView<uint8> Payload)
+{
+    // Replays one logged mutation. The log is detached during replay, so nothing is re-logged.
+    constexpr int32 KeySize = FHexademic6WriteAheadLog::KeySize;
+    switch (Type)
+    {
+    case EHexademic6WalRecordType::IndexPut:
+        if (Payload.Num() == KeySize + (int32)sizeof(FGuid))
+        {
+            FGuid MemoryID;
+            FMemory::Memcpy(&MemoryID, Payload.GetData() + KeySize, sizeof(FGuid));
+            ApplyIndexPut(FHexademic6WriteAheadLog::ReadKey(Payload.GetData()), MemoryID);
+            return;
+        }
+        break;
+    case EHexademic6WalRecordType::RecordPut:
+        if (Payload.Num() > KeySize + 1 && Payload[KeySize] < FHexademic6OrderIndexing::NumOrders)
+        {
+            const FDUIDSIndex Index = FHexademic6WriteAheadLog::ReadKey(Payload.GetData());
+            const ECognitiveLatticeOrder Order = (ECognitiveLatticeOrder)Payload[KeySize];
+            const TConstArrayView<uint8> Record = Payload.RightChop(KeySize + 1);
+            FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+            FWriteScopeLock WriteLock(Shard.Lock);
+            FHexademic6RecordArena& Arena = Shard.RecordArenas[(uint8)Order];
+            FMemory::Memcpy(Arena.Reserve(Record.Num()), Record.GetData(), Record.Num());
+            FHexademicRecordLocation Location;
+            Location.Order = Order;
+            Location.Handle = Arena.Commit(Record.Num());
+            StoreRecordLocationLocked(Shard, Index, Location);
+            return;
+        }
+        break;
+    case EHexademic6WalRecordType::Access: // Only found in logs written before accesses were buffered
+        if (Payload.Num() == KeySize + (int32)sizeof(double))
+        {
+            RestoreAccesses(FHexademic6WriteAheadLog::ReadKey(Payload.GetData()), 1);
+            return;
+        }
+        break;
+    case EHexademic6WalRecordType::DictionaryPut:
+        if (Payload.Num() >= (int32)sizeof(uint32))
+        {
+            uint32 DictionaryId;
+            FMemory::Memcpy(&DictionaryId, Payload.GetData(), sizeof(uint32));
+            AddDictionaryToShards(DictionaryId, Payload.RightChop(sizeof(uint32)));
+            return;
+        }
+        break;
+    case EHexademic6WalRecordType::RecordRemove:
+        if (Payload.Num() == KeySize)
+        {
+            const FDUIDSIndex Index = FHexademic6WriteAheadLog::ReadKey(Payload.GetData());
+            FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+            FWriteScopeLock WriteLock(Shard.Lock);
+            RemoveRecordLocked(Shard, Index);
+            return;
+        }
+        break;
+    }
+    UE_LOG(LogHexademicLattice, Warning, TEXT("Skipping malformed write-ahead log record of type %d."), (int32)Type);
+}
+
+// =============================================================================
+// SLICED ACCESS AND CODEC HELPERS
+// =============================================================================
+
+bool FDUIDSOrchestrator::ReadRecordSlices(const FDUIDSIndex& Index, FHexademic6RecordSliceHeader& OutSlices)
+{
+    // A hash lookup plus a fixed-size header read; the compressed body is never touched.
+    ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order6;
+    bool bFound = false;
+    {
+        const FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+        FReadScopeLock ReadLock(Shard.Lock);
+        const TConstArrayView<uint8> Record = FindRecordLocked(Shard, Index);
+        bFound = FindMemoryIDLocked(Shard, Index) && DUIDSOrchestratorPrivate::ReadRecordOrder(Record, Order)
+            && FHexademic6RecordCodec::ReadSliceHeader(Record, OutSlices);
+        if (bFound)
+        {
+            UpdateCachesForSlices(Index, OutSlices); // Under the read lock, like every cache fill
+        }
+    }
+    if (bFound)
+    {
+        RecordAccess(Index, Order);
+    }
+    return bFound;
+}
+
+void FDUIDSOrchestrator::UpdateCachesForSlices(const FDUIDSIndex& Index, const FHexademic6RecordSliceHeader& Slices)
+{
+    FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+    FHexademic6CachedSlices Cached;
+    Cached.ResonanceStrength = Slices.ResonanceStrength;
+    Cached.EmotionalSignature = Slices.GetEmotionalSignature();
+    FScopeLock CacheScope(&Shard.CacheLock);
+    Shard.Cache.AddSlices(Index, Cached);
 }
 
 void FDUIDSOrchestrator::InvalidateCachesForIndex(const FDUIDSIndex& Index)
 {
-    // Invalidates cached sliced data for a specific index, typically after modification.
-    ResonanceCache.Remove(Index);
-    EmotionalSignatureCache.Remove(Index);
-    UE_LOG(LogHexademicLattice, Verbose, TEXT("Invalidated caches for DUIDS Index %s."), *Index.ToDecimalString());
+    // Invalidates the cached node and sliced data for a specific index. Every record or index
+    // change calls it while holding the shard's write lock, and caches are only filled under
+    // the shard's read lock, so a stale decode can never be cached after its invalidation.
+    FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Index);
+    {
+        FScopeLock CacheScope(&Shard.CacheLock);
+        Shard.Cache.Invalidate(Index);
+    }
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Invalidated caches for DUIDS Index %s."), *FHexademic6PackedKey(Index).ToHexString());
 }
 
 TArray<uint8> FDUIDSOrchestrator::CompressMemoryData(const FHexademicMemoryNode& Memory, uint8 Level)
 {
-    // Placeholder: Compresses the actual EventData and other fields into a byte array.
-    // This would use a compression library (e.g., Zlib, LZ4, or custom).
-    UE_LOG(LogHexademicLattice, Log, TEXT("Compressing memory data for %s at level %d. (Placeholder)"), *Memory.MemoryID.ToString(), Level);
+    // Serializes the full node and compresses it with the codec selected by Level
+    // (see FHexademic6RecordCodec). The record is self-describing and round-trips losslessly.
     TArray<uint8> CompressedBytes;
-    FString DataToCompress = Memory.EventData + Memory.EventType; // Example data
-    
-    // Simulate compression: just copy some bytes or a dummy value
-    CompressedBytes.Add(Level); // Store compression level as first byte
-    for (int32 i = 0; i < FMath::Min(DataToCompress.Len(), 10); ++i)
     {
-        CompressedBytes.Add((uint8)DataToCompress[i]);
+        FDUIDSOrchestratorShard& Shard = DUIDSOrchestratorPrivate::ShardForIndex(Shards, Memory.QuickAccessIndex);
+        FWriteScopeLock WriteLock(Shard.Lock);
+        if (!Shard.RecordCodec.Compress(Memory, Level, CompressedBytes))
+        {
+            return TArray<uint8>();
+        }
     }
-    UE_LOG(LogHexademicLattice, Verbose, TEXT("Compressed %d bytes (simulated)."), CompressedBytes.Num());
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Compressed memory %s at level %d into %d bytes."), *Memory.MemoryID.ToString(), Level, CompressedBytes.Num());
     return CompressedBytes;
 }
 
-FHexademicMemoryNode FDUIDSOrchestrator::DecompressMemoryData(const TArray<uint8>& CompressedData)
+FHexademicMemoryNode FDUIDSOrchestrator::DecompressMemoryData(const FDUIDSOrchestratorShard& Shard, TConstArrayView<uint8> CompressedData) const
 {
-    // Placeholder: Decompresses a byte array back into an FHexademicMemoryNode.
-    UE_LOG(LogHexademicLattice, Log, TEXT("Decompressing memory data from %d bytes. (Placeholder)"), CompressedData.Num());
+    // Decompresses a record back into the node it was written from. A corrupt record yields a
+    // default node; the codec logs the failure. Decompression is const on the codec, so readers
+    // of one shard share it.
     FHexademicMemoryNode DecompressedMemory;
-    if (CompressedData.Num() > 0)
+    if (!Shard.RecordCodec.Decompress(CompressedData, DecompressedMemory))
     {
-        DecompressedMemory.CompressionLevel = CompressedData[0]; // Recover level
-        DecompressedMemory.EventData = TEXT("Decompressed Data (Simulated)");
-        DecompressedMemory.EventType = TEXT("Decompressed Event");
-        // ... restore other fields
+        return FHexademicMemoryNode();
     }
     return DecompressedMemory;
 }
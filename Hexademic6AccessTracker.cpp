@@ -0,0 +1,547 @@
+// Hexademic6AccessTracker.cpp
+// Count-min sketch, space-saving heavy hitters, access windows and the per-thread access
+// buffers feeding them.
+
+#include "Hexademic6AccessTracker.h"
+#include "HAL/IConsoleManager.h"   // For TAutoConsoleVariable
+#include "HAL/PlatformTLS.h"       // For FPlatformTLS
+#include "Logging/LogMacros.h"     // For UE_LOG
+#include "Misc/ScopeLock.h"        // For FScopeLock
+
+static TAutoConsoleVariable<int32> CVarHexademicAccessSketchWidth(
+    TEXT("Hexademic.Access.SketchWidth"),
+    16384,
+    TEXT("Counters per row of the access-frequency count-min sketch (rounded up to a power of two). Read when a tracker is created."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicAccessTopKCapacity(
+    TEXT("Hexademic.Access.TopKCapacity"),
+    256,
+    TEXT("Keys tracked per lattice order for most-accessed queries. Applied when a tracker is created or reset."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<FString> CVarHexademicAccessWindowTiers(
+    TEXT("Hexademic.Access.WindowTiers"),
+    TEXT("1x60,60x60,3600x24"),
+    TEXT("Access window tiers as <bucket seconds>x<bucket count>, finest first; each width must be a multiple of the previous one. Applied when a tracker is created or reset."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicAccessWindowKeysPerBucket(
+    TEXT("Hexademic.Access.WindowKeysPerBucket"),
+    64,
+    TEXT("Distinct keys counted per access window bucket. Applied when a tracker is created or reset."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicAccessFlushThreshold(
+    TEXT("Hexademic.Access.FlushThreshold"),
+    256,
+    TEXT("Accesses a thread buffers before merging them into the shared access statistics."),
+    ECVF_Default);
+
+// =============================================================================
+// FREQUENCY SKETCH
+// =============================================================================
+
+FHexademic6CountMinSketch::FHexademic6CountMinSketch(int32 InWidth)
+    : Width((int32)FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(InWidth, 64)))
+{
+    Counters.SetNumZeroed(Depth * Width);
+}
+
+uint64 FHexademic6CountMinSketch::HashKey(const FDUIDSIndex& Key)
+{
+    // Every key field packed into 64 bits through a 64-bit finalizer, so the two halves used
+    // for double hashing are independent enough.
+    uint64 Hash = ((uint64)Key.SubSection << 32) | ((uint64)Key.Section << 16) | ((uint64)Key.Division << 8) | (uint64)Key.MajorClass;
+    Hash ^= (((uint64)Key.Cutter << 8) | (uint64)Key.Edition) * 0x9e3779b97f4a7c15ull;
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdull;
+    Hash ^= Hash >> 33;
+    Hash *= 0xc4ceb9fe1a85ec53ull;
+    Hash ^= Hash >> 33;
+    return Hash | 1; // An odd step keeps the rows' probe sequences distinct
+}
+
+void FHexademic6CountMinSketch::Add(const FDUIDSIndex& Key, uint32 Count)
+{
+    const uint64 Hash = HashKey(Key);
+    uint32 Minimum = MAX_uint32;
+    for (int32 Row = 0; Row < Depth; ++Row)
+    {
+        Minimum = FMath::Min(Minimum, Counter(Hash, Row));
+    }
+    const uint32 Target = Minimum > MAX_uint32 - Count ? MAX_uint32 : Minimum + Count;
+    for (int32 Row = 0; Row < Depth; ++Row)
+    {
+        uint32& Cell = Counter(Hash, Row);
+        Cell = FMath::Max(Cell, Target);
+    }
+}
+
+uint32 FHexademic6CountMinSketch::Estimate(const FDUIDSIndex& Key) const
+{
+    const uint64 Hash = HashKey(Key);
+    uint32 Minimum = MAX_uint32;
+    for (int32 Row = 0; Row < Depth; ++Row)
+    {
+        Minimum = FMath::Min(Minimum, Counter(Hash, Row));
+    }
+    return Minimum;
+}
+
+void FHexademic6CountMinSketch::Reset()
+{
+    FMemory::Memzero(Counters.GetData(), Counters.Num() * sizeof(uint32));
+}
+
+void FHexademic6CountMinSketch::Halve()
+{
+    for (uint32& Cell : Counters)
+    {
+        Cell >>= 1;
+    }
+}
+
+// =============================================================================
+// HEAVY HITTERS
+// =============================================================================
+
+FHexademic6SpaceSaving::FHexademic6SpaceSaving(int32 InCapacity)
+    : Capacity(FMath::Max(InCapacity, 1))
+{
+}
+
+void FHexademic6SpaceSaving::Add(const FDUIDSIndex& Key, uint32 Count)
+{
+    if (const int32* Position = Positions.Find(Key))
+    {
+        Entries[*Position].Count += Count;
+        MoveUp(*Position);
+        return;
+    }
+    if (Entries.Num() < Capacity)
+    {
+        FEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.Key = Key;
+        Entry.Count = Count;
+        Positions.Add(Key, Entries.Num() - 1);
+        MoveUp(Entries.Num() - 1);
+        return;
+    }
+    // Full: the least counted key gives up its slot, and the newcomer inherits its count as
+    // the error bound.
+    FEntry& Victim = Entries.Last();
+    Positions.Remove(Victim.Key);
+    Victim.Key = Key;
+    Victim.Error = Victim.Count;
+    Victim.Count += Count;
+    Positions.Add(Key, Entries.Num() - 1);
+    MoveUp(Entries.Num() - 1);
+}
+
+void FHexademic6SpaceSaving::MoveUp(int32 Position)
+{
+    // Skewed streams mostly increment entries already near the top, so moves stay short.
+    const FEntry Moving = Entries[Position];
+    while (Position > 0 && Entries[Position - 1].Count < Moving.Count)
+    {
+        Entries[Position] = Entries[Position - 1];
+        Positions[Entries[Position].Key] = Position;
+        --Position;
+    }
+    Entries[Position] = Moving;
+    Positions[Moving.Key] = Position;
+}
+
+void FHexademic6SpaceSaving::Reset()
+{
+    Entries.Reset();
+    Positions.Reset();
+}
+
+void FHexademic6SpaceSaving::SetCapacity(int32 InCapacity)
+{
+    Capacity = FMath::Max(InCapacity, 1);
+    Reset();
+    Entries.Reserve(Capacity);
+    Positions.Reserve(Capacity);
+}
+
+// =============================================================================
+// ACCESS WINDOWS
+// =============================================================================
+
+bool FHexademic6AccessWindow::ParseTiers(const FString& Spec, TArray<FTier>& OutTiers)
+{
+    OutTiers.Reset();
+    TArray<FString> Entries;
+    Spec.ParseIntoArray(Entries, TEXT(","));
+    for (const FString& Entry : Entries)
+    {
+        FString Width;
+        FString Count;
+        if (!Entry.TrimStartAndEnd().Split(TEXT("x"), &Width, &Count) || !Width.IsNumeric() || !Count.IsNumeric())
+        {
+            return false;
+        }
+        FTier Tier;
+        Tier.BucketSeconds = FCString::Atod(*Width);
+        Tier.NumBuckets = FCString::Atoi(*Count);
+        if (Tier.BucketSeconds <= 0.0 || Tier.NumBuckets <= 0)
+        {
+            return false;
+        }
+        if (OutTiers.Num() > 0)
+        {
+            // Whole coarse buckets must cover whole fine buckets, or evicted counts would straddle two.
+            const double Ratio = Tier.BucketSeconds / OutTiers.Last().BucketSeconds;
+            if (Ratio < 1.0 || !FMath::IsNearlyEqual(Ratio, FMath::RoundToDouble(Ratio), 1e-6))
+            {
+                return false;
+            }
+        }
+        OutTiers.Add(Tier);
+    }
+    return OutTiers.Num() > 0;
+}
+
+FHexademic6AccessWindow::FHexademic6AccessWindow(TConstArrayView<FTier> InTiers, int32 InKeysPerBucket)
+    : KeysPerBucket(FMath::Max(InKeysPerBucket, 1))
+{
+    Tiers.Reserve(InTiers.Num());
+    for (const FTier& Tier : InTiers)
+    {
+        FTierState& State = Tiers.AddDefaulted_GetRef();
+        State.Width = Tier.BucketSeconds;
+        State.Buckets.SetNum(Tier.NumBuckets);
+        for (FBucket& Bucket : State.Buckets)
+        {
+            Bucket.Keys.SetCapacity(KeysPerBucket);
+        }
+    }
+}
+
+FHexademic6AccessWindow::FBucket* FHexademic6AccessWindow::FindBucket(int32 FirstTier, double Time)
+{
+    for (int32 TierIndex = FirstTier; TierIndex < Tiers.Num(); ++TierIndex)
+    {
+        FTierState& Tier = Tiers[TierIndex];
+        const int64 Number = (int64)FMath::FloorToDouble(Time / Tier.Width);
+        FBucket& Bucket = Tier.Buckets[(int32)(Number % Tier.Buckets.Num())];
+        if (Bucket.Number == Number)
+        {
+            return &Bucket;
+        }
+        if (Bucket.Number < Number)
+        {
+            Evict(TierIndex, Bucket);
+            Bucket.Number = Number;
+            Tier.NewestNumber = FMath::Max(Tier.NewestNumber, Number);
+            return &Bucket;
+        }
+        // The slot already moved past Time (an access merged late); a coarser bucket may still cover it.
+    }
+    return nullptr;
+}
+
+void FHexademic6AccessWindow::Evict(int32 TierIndex, FBucket& Bucket)
+{
+    if (Bucket.Total > 0)
+    {
+        if (FBucket* Target = FindBucket(TierIndex + 1, (double)Bucket.Number * Tiers[TierIndex].Width))
+        {
+            Target->Total += Bucket.Total;
+            for (const FHexademic6SpaceSaving::FEntry& Entry : Bucket.Keys.GetEntries())
+            {
+                Target->Keys.Add(Entry.Key, Entry.Count);
+            }
+        }
+    }
+    Bucket.Number = INDEX_NONE;
+    Bucket.Total = 0;
+    Bucket.Keys.Reset();
+}
+
+void FHexademic6AccessWindow::Add(const FDUIDSIndex& Key, uint32 Count, double Time)
+{
+    if (FBucket* Bucket = FindBucket(0, Time))
+    {
+        Bucket->Total += Count;
+        Bucket->Keys.Add(Key, Count);
+    }
+}
+
+double FHexademic6AccessWindow::GetShareSince(int32 TierIndex, const FBucket& Bucket, double MinTime) const
+{
+    // An access reaches tier i only once the finer tier's slot for it holds a bucket at least a
+    // ring newer, so it is older than the finer ring's reach from its newest bucket. The span
+    // a coarse bucket's accesses can occupy ends there, which matters for short windows: without
+    // the clamp, a 10 s window would count most of the current minute bucket.
+    const FTierState& Tier = Tiers[TierIndex];
+    const double Start = (double)Bucket.Number * Tier.Width;
+    double End = Start + Tier.Width;
+    if (TierIndex > 0 && Tiers[TierIndex - 1].NewestNumber != INDEX_NONE)
+    {
+        const FTierState& Finer = Tiers[TierIndex - 1];
+        End = FMath::Min(End, (double)(Finer.NewestNumber - Finer.Buckets.Num() + 1) * Finer.Width);
+    }
+    if (Start >= MinTime)
+    {
+        return 1.0;
+    }
+    return End > MinTime ? (End - MinTime) / (End - Start) : 0.0;
+}
+
+void FHexademic6AccessWindow::Query(double MinTime, TMap<FDUIDSIndex, int32>& OutCounts) const
+{
+    // Every access sits in exactly one bucket, so summing the overlapping buckets of all tiers
+    // never counts an access twice.
+    for (int32 TierIndex = 0; TierIndex < Tiers.Num(); ++TierIndex)
+    {
+        for (const FBucket& Bucket : Tiers[TierIndex].Buckets)
+        {
+            const double Share = Bucket.Total > 0 ? GetShareSince(TierIndex, Bucket, MinTime) : 0.0;
+            if (Share <= 0.0)
+            {
+                continue;
+            }
+            for (const FHexademic6SpaceSaving::FEntry& Entry : Bucket.Keys.GetEntries())
+            {
+                const int64 Accesses = Share < 1.0 ? (int64)FMath::RoundToDouble(Entry.Count * Share) : (int64)Entry.Count;
+                if (Accesses > 0)
+                {
+                    int32& Count = OutCounts.FindOrAdd(Entry.Key, 0);
+                    Count = (int32)FMath::Min<int64>((int64)Count + Accesses, MAX_int32);
+                }
+            }
+        }
+    }
+}
+
+uint64 FHexademic6AccessWindow::CountSince(double MinTime) const
+{
+    uint64 Total = 0;
+    for (int32 TierIndex = 0; TierIndex < Tiers.Num(); ++TierIndex)
+    {
+        for (const FBucket& Bucket : Tiers[TierIndex].Buckets)
+        {
+            const double Share = Bucket.Total > 0 ? GetShareSince(TierIndex, Bucket, MinTime) : 0.0;
+            Total += Share < 1.0 ? (uint64)FMath::RoundToDouble(Bucket.Total * Share) : Bucket.Total;
+        }
+    }
+    return Total;
+}
+
+double FHexademic6AccessWindow::GetSpanSeconds() const
+{
+    return Tiers.Num() > 0 ? Tiers.Last().Width * Tiers.Last().Buckets.Num() : 0.0;
+}
+
+void FHexademic6AccessWindow::Reset()
+{
+    for (FTierState& Tier : Tiers)
+    {
+        Tier.NewestNumber = INDEX_NONE;
+        for (FBucket& Bucket : Tier.Buckets)
+        {
+            Bucket.Number = INDEX_NONE;
+            Bucket.Total = 0;
+            Bucket.Keys.Reset();
+        }
+    }
+}
+
+// =============================================================================
+// ACCESS TRACKER
+// =============================================================================
+
+namespace Hexademic6AccessTrackerPrivate
+{
+    FHexademic6AccessWindow MakeWindow()
+    {
+        TArray<FHexademic6AccessWindow::FTier> Tiers;
+        const FString Spec = CVarHexademicAccessWindowTiers.GetValueOnAnyThread();
+        if (!FHexademic6AccessWindow::ParseTiers(Spec, Tiers))
+        {
+            UE_LOG(LogHexademicLattice, Warning, TEXT("Invalid Hexademic.Access.WindowTiers '%s'; using 1x60,60x60,3600x24."), *Spec);
+            FHexademic6AccessWindow::ParseTiers(TEXT("1x60,60x60,3600x24"), Tiers);
+        }
+        return FHexademic6AccessWindow(Tiers, CVarHexademicAccessWindowKeysPerBucket.GetValueOnAnyThread());
+    }
+}
+
+FHexademic6AccessTracker::FHexademic6AccessTracker()
+    : TlsSlot(FPlatformTLS::AllocTlsSlot())
+    , Sketch(CVarHexademicAccessSketchWidth.GetValueOnAnyThread())
+    , Window(Hexademic6AccessTrackerPrivate::MakeWindow())
+{
+    for (FHexademic6SpaceSaving& Summary : HeavyHitters)
+    {
+        Summary.SetCapacity(CVarHexademicAccessTopKCapacity.GetValueOnAnyThread());
+    }
+}
+
+FHexademic6AccessTracker::~FHexademic6AccessTracker()
+{
+    // Buffers are owned here, not by their threads, so nothing dangles once the slot is freed.
+    FPlatformTLS::FreeTlsSlot(TlsSlot);
+}
+
+FHexademic6AccessTracker::FThreadBuffer& FHexademic6AccessTracker::GetThreadBuffer()
+{
+    if (FThreadBuffer* Buffer = static_cast<FThreadBuffer*>(FPlatformTLS::GetTlsValue(TlsSlot)))
+    {
+        return *Buffer;
+    }
+    FThreadBuffer* Buffer = new FThreadBuffer();
+    Buffer->Events.Reserve(CVarHexademicAccessFlushThreshold.GetValueOnAnyThread());
+    {
+        FScopeLock RegistryScope(&RegistryLock);
+        ThreadBuffers.Emplace(Buffer);
+    }
+    FPlatformTLS::SetTlsValue(TlsSlot, Buffer);
+    return *Buffer;
+}
+
+void FHexademic6AccessTracker::RecordAccess(const FDUIDSIndex& Key, ECognitiveLatticeOrder Order, double Time)
+{
+    FThreadBuffer& Buffer = GetThreadBuffer();
+    bool bFull;
+    {
+        FScopeLock BufferScope(&Buffer.Lock);
+        Buffer.Events.Add({ Key, Time, Order });
+        bFull = Buffer.Events.Num() >= CVarHexademicAccessFlushThreshold.GetValueOnAnyThread();
+    }
+    if (bFull)
+    {
+        MergeBuffer(Buffer);
+    }
+}
+
+void FHexademic6AccessTracker::RecordAccesses(TConstArrayView<FDUIDSIndex> Keys, TConstArrayView<ECognitiveLatticeOrder> Orders, double Time)
+{
+    check(Keys.Num() == Orders.Num());
+    if (Keys.Num() == 0)
+    {
+        return;
+    }
+    FThreadBuffer& Buffer = GetThreadBuffer();
+    bool bFull;
+    {
+        FScopeLock BufferScope(&Buffer.Lock);
+        Buffer.Events.Reserve(Buffer.Events.Num() + Keys.Num());
+        for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); ++KeyIndex)
+        {
+            Buffer.Events.Add({ Keys[KeyIndex], Time, Orders[KeyIndex] });
+        }
+        bFull = Buffer.Events.Num() >= CVarHexademicAccessFlushThreshold.GetValueOnAnyThread();
+    }
+    if (bFull)
+    {
+        MergeBuffer(Buffer);
+    }
+}
+
+void FHexademic6AccessTracker::MergeBuffer(FThreadBuffer& Buffer)
+{
+    // The buffer and the scratch array trade allocations, so steady-state merges do not allocate.
+    FScopeLock MergeScope(&MergeLock);
+    {
+        FScopeLock BufferScope(&Buffer.Lock);
+        Swap(MergeScratch, Buffer.Events);
+    }
+    for (const FAccessEvent& Event : MergeScratch)
+    {
+        ApplyLifetimeLocked(Event.Key, Event.Order, 1);
+        Window.Add(Event.Key, 1, Event.Time);
+    }
+    MergeScratch.Reset();
+}
+
+void FHexademic6AccessTracker::ApplyLifetimeLocked(const FDUIDSIndex& Key, ECognitiveLatticeOrder Order, uint32 Count)
+{
+    Sketch.Add(Key, Count);
+    if ((uint8)Order < FHexademic6OrderIndexing::NumOrders)
+    {
+        HeavyHitters[(uint8)Order].Add(Key, Count);
+    }
+}
+
+void FHexademic6AccessTracker::Flush()
+{
+    TArray<FThreadBuffer*, TInlineAllocator<32>> Buffers;
+    {
+        FScopeLock RegistryScope(&RegistryLock);
+        for (const TUniquePtr<FThreadBuffer>& Buffer : ThreadBuffers)
+        {
+            Buffers.Add(Buffer.Get());
+        }
+    }
+    for (FThreadBuffer* Buffer : Buffers)
+    {
+        MergeBuffer(*Buffer);
+    }
+}
+
+void FHexademic6AccessTracker::Restore(const FDUIDSIndex& Key, ECognitiveLatticeOrder Order, uint32 Count)
+{
+    FScopeLock MergeScope(&MergeLock);
+    ApplyLifetimeLocked(Key, Order, Count);
+}
+
+uint32 FHexademic6AccessTracker::EstimateCount(const FDUIDSIndex& Key)
+{
+    Flush();
+    FScopeLock MergeScope(&MergeLock);
+    return Sketch.Estimate(Key);
+}
+
+void FHexademic6AccessTracker::GetMostAccessed(ECognitiveLatticeOrder Order, int32 Count, TArray<FDUIDSIndex>& OutKeys)
+{
+    if ((uint8)Order >= FHexademic6OrderIndexing::NumOrders || Count <= 0)
+    {
+        return;
+    }
+    Flush();
+    FScopeLock MergeScope(&MergeLock);
+    const TConstArrayView<FHexademic6SpaceSaving::FEntry> Entries = HeavyHitters[(uint8)Order].GetEntries();
+    const int32 NumKeys = FMath::Min(Count, Entries.Num());
+    OutKeys.Reserve(OutKeys.Num() + NumKeys);
+    for (int32 EntryIndex = 0; EntryIndex < NumKeys; ++EntryIndex)
+    {
+        OutKeys.Add(Entries[EntryIndex].Key);
+    }
+}
+
+void FHexademic6AccessTracker::GetAccessedSince(double MinTime, TMap<FDUIDSIndex, int32>& OutCounts)
+{
+    Flush();
+    FScopeLock MergeScope(&MergeLock);
+    Window.Query(MinTime, OutCounts);
+}
+
+void FHexademic6AccessTracker::ForEachTracked(TFunctionRef<void(const FDUIDSIndex& Key, uint32 Count)> Visitor)
+{
+    // Both structures only ever overestimate, so the smaller of the two is the tighter bound.
+    Flush();
+    FScopeLock MergeScope(&MergeLock);
+    for (const FHexademic6SpaceSaving& Summary : HeavyHitters)
+    {
+        for (const FHexademic6SpaceSaving::FEntry& Entry : Summary.GetEntries())
+        {
+            Visitor(Entry.Key, FMath::Min(Entry.Count, Sketch.Estimate(Entry.Key)));
+        }
+    }
+}
+
+void FHexademic6AccessTracker::Reset()
+{
+    Flush();
+    FScopeLock MergeScope(&MergeLock);
+    Sketch.Reset();
+    for (FHexademic6SpaceSaving& Summary : HeavyHitters)
+    {
+        Summary.SetCapacity(CVarHexademicAccessTopKCapacity.GetValueOnAnyThread());
+    }
+    Window = Hexademic6AccessTrackerPrivate::MakeWindow();
+}
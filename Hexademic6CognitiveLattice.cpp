@@ -2,6 +2,9 @@
 // Modified to integrate DUIDS, updated ECognitiveLatticeOrder, and int32 coordinates.
 
 #include "HexademicSixLattice.h"
+#include "Hexademic6OrderIndexing.h"
+#include "Hexademic6DUIDSCurve.h"
+#include "Hexademic6LatticeStore.h"
 #include "Misc/Guid.h"
 #include "Math/UnrealMathUtility.h"
 #include "HAL/PlatformTime.h"
@@ -40,50 +43,17 @@ void FHexademic6DCoordinate::GenerateFromArchetype(uint32 ArchetypeID, float Emo
 bool FHexademic6DCoordinate::IsValidForOrder(ECognitiveLatticeOrder Order) const
 {
     // Check if the coordinate values are within the conceptual bounds of the given order.
-    // The 'OrderSize' now corresponds to the fractal folding structure.
-    static const int32 OrderSizes[] = { 6, 12, 24, 48, 96, 192, TNumericLimits<int32>::Max() };
-    const int32 OrderSize = OrderSizes[static_cast<uint8>(Order)];
-
-    // For OrderInfinite, the max value is effectively unbounded for int32.
-    // For specific orders, check if coordinates are within the expected 'ring' size.
-    // This is a conceptual check, actual bounds might be relative to a center.
-    if (Order == ECognitiveLatticeOrder::OrderInfinite)
-    {
-        return true; // Unbounded
-    }
-    // Simple check: are absolute values within the OrderSize
-    return (FMath::Abs(X) < OrderSize && FMath::Abs(Y) < OrderSize && FMath::Abs(Z) < OrderSize && 
-            FMath::Abs(W) < OrderSize && FMath::Abs(U) < OrderSize && FMath::Abs(V) < OrderSize);
+    // Bounded orders require |axis| < OrderSize; OrderInfinite is unbounded.
+    return FHexademic6OrderIndexing::IsValidForOrder(*this, Order);
 }
 
-// NOTE: ToLinearIndex is now FORCEINLINE in the header. Its implementation was moved there.
+// NOTE: ToLinearIndex is now FORCEINLINE in the header and forwards to FHexademic6OrderIndexing::ToLinearIndex.
 
 void FHexademic6DCoordinate::FromLinearIndex(uint64 Index, ECognitiveLatticeOrder Order)
 {
-    // Placeholder: Convert linear index back to 6D coordinate based on the order.
-    // This method needs to align with the ToLinearIndex logic which might use DUIDS.
-    // If ToLinearIndex prioritizes DUIDS, FromLinearIndex might need a DUIDS-based conversion.
-    // For now, it's a direct inverse of the non-DUIDS linear conversion.
-    static const uint32 OrderSizes[] = { 6, 12, 24, 48, 96, 192, 65536 }; // 65536 for OrderInfinite to cap uint16 range for V
-    const uint32 OrderSize = OrderSizes[static_cast<uint8>(Order)];
-
-    LatticeOrder = Order;
-    if (OrderSize == 0) return;
-
-    // This inverse calculation needs to match the ToLinearIndex logic.
-    // If ToLinearIndex uses DUIDS for a "fast path", this FromLinearIndex needs to handle that.
-    // For now, assuming direct 6D mapping for fallback.
-    uint64 CurrentIndex = Index;
-    V = (int32)(CurrentIndex / FMath::Pow(OrderSize, 5));
-    CurrentIndex %= (uint64)FMath::Pow(OrderSize, 5);
-    U = (int32)(CurrentIndex / FMath::Pow(OrderSize, 4));
-    CurrentIndex %= (uint64)FMath::Pow(OrderSize, 4);
-    W = (int32)(CurrentIndex / FMath::Pow(OrderSize, 3));
-    CurrentIndex %= (uint64)FMath::Pow(OrderSize, 3);
-    Z = (int32)(CurrentIndex / FMath::Pow(OrderSize, 2));
-    CurrentIndex %= (uint64)FMath::Pow(OrderSize, 2);
-    Y = (int32)(CurrentIndex / OrderSize);
-    X = (int32)(CurrentIndex % OrderSize);
+    // Convert a linear index back to a 6D coordinate. The per-order strides are compile-time
+    // constants (see Hexademic6OrderIndexing.h), so this is pure integer math.
+    FHexademic6OrderIndexing::FromLinearIndex(Index, Order, *this);
 
     // After setting coordinates, update DUIDS index
     UpdateDUIDSIndex();
@@ -94,30 +64,11 @@ void FHexademic6DCoordinate::FromLinearIndex(uint64 Index, ECognitiveLatticeOrde
 
 FHexademic6DCoordinate FHexademic6DCoordinate::ProjectToOrder(ECognitiveLatticeOrder TargetOrder) const
 {
-    // Projects the current 6D coordinate to a different lattice order.
-    // This would involve scaling or remapping coordinates based on the new order's size.
-    static const int32 CurrentOrderSizes[] = { 6, 12, 24, 48, 96, 192, TNumericLimits<int32>::Max() };
-    static const int32 TargetOrderSizes[] = { 6, 12, 24, 48, 96, 192, TNumericLimits<int32>::Max() };
-
-    FHexademic6DCoordinate ProjectedCoord = *this;
-    ProjectedCoord.LatticeOrder = TargetOrder;
+    // Projects the current 6D coordinate to a different lattice order by rescaling each
+    // axis by TargetSize / CurrentSize (OrderInfinite counts as 65536).
+    FHexademic6DCoordinate ProjectedCoord;
+    FHexademic6OrderIndexing::ProjectToOrder(*this, LatticeOrder, TargetOrder, ProjectedCoord);
 
-    if (LatticeOrder != TargetOrder)
-    {
-        float CurrentSize = (LatticeOrder == ECognitiveLatticeOrder::OrderInfinite) ? 65536.0f : CurrentOrderSizes[static_cast<uint8>(LatticeOrder)];
-        float TargetSize = (TargetOrder == ECognitiveLatticeOrder::OrderInfinite) ? 65536.0f : TargetOrderSizes[static_cast<uint8>(TargetOrder)];
-
-        if (CurrentSize > KINDA_SMALL_NUMBER)
-        {
-            float ScaleFactor = TargetSize / CurrentSize;
-            ProjectedCoord.X = FMath::RoundToInt(X * ScaleFactor);
-            ProjectedCoord.Y = FMath::RoundToInt(Y * ScaleFactor);
-            ProjectedCoord.Z = FMath::RoundToInt(Z * ScaleFactor);
-            ProjectedCoord.W = FMath::RoundToInt(W * ScaleFactor);
-            ProjectedCoord.U = FMath::RoundToInt(U * ScaleFactor);
-            ProjectedCoord.V = FMath::RoundToInt(V * ScaleFactor);
-        }
-    }
     // Update DUIDS index for the projected coordinate
     ProjectedCoord.UpdateDUIDSIndex();
 
@@ -129,35 +80,23 @@ FHexademic6DCoordinate FHexademic6DCoordinate::ProjectToOrder(ECognitiveLatticeO
 FHexademic6DCoordinate FHexademic6DCoordinate::FromDUIDSIndex(const FDUIDSIndex& Index, ECognitiveLatticeOrder Order)
 {
     FHexademic6DCoordinate Coord;
-    Coord.DUIDSLocation = Index;
-    Coord.LatticeOrder = Order;
-
-    // Placeholder: This is a critical mapping from DUIDS decimal index back to 6D coordinates.
-    // The exact mapping would depend on your compression/indexing scheme.
-    // For a simple example, we can derive coordinates directly from DUIDS components.
-    
-    // Example (simplistic direct mapping - assumes DUIDS components span coordinate ranges):
-    // Max values for coordinate components are from the 24-bit range
-    Coord.X = (int32)Index.MajorClass * 1000000 + (int32)Index.Division * 10000;
-    Coord.Y = (int32)Index.Division * 100000 + (int32)Index.Section * 100;
-    Coord.Z = (int32)Index.Section * 1000 + (int32)(Index.SubSection % 1000);
-    Coord.W = (int32)(Index.SubSection >> 16); // Extract higher bits for W
-    Coord.U = (int32)(Index.SubSection & 0xFFFF); // Extract lower bits for U
-    Coord.V = (int32)Index.Cutter * 100 + (int32)Index.Edition; // Combine Cutter and Edition for V
-
-    // Ensure values are within a reasonable range for the chosen order, e.g., scale them.
-    // This is a very rough example and needs careful tuning based on your actual DUIDS design.
-    static const int32 OrderSizes[] = { 6, 12, 24, 48, 96, 192, TNumericLimits<int32>::Max() };
-    const int32 OrderSize = OrderSizes[static_cast<uint8>(Order)];
-    if (Order != ECognitiveLatticeOrder::OrderInfinite && OrderSize > 0)
+    if (FHexademic6DUIDSCurve::GetEncodingMode() == EDUIDSEncodingMode::Morton)
+    {
+        // Morton keys decode exactly for bounded orders and to the cell center for OrderInfinite.
+        Coord = FHexademic6DUIDSCurve::Decode(Index, Order);
+    }
+    else
     {
-        float ScaleFactor = (float)OrderSize / 8388607.0f; // Scale to current order's typical range
-        Coord.X = FMath::RoundToInt(Coord.X * ScaleFactor);
-        Coord.Y = FMath::RoundToInt(Coord.Y * ScaleFactor);
-        Coord.Z = FMath::RoundToInt(Coord.Z * ScaleFactor);
-        Coord.W = FMath::RoundToInt(Coord.W * ScaleFactor);
-        Coord.U = FMath::RoundToInt(Coord.U * ScaleFactor);
-        Coord.V = FMath::RoundToInt(Coord.V * ScaleFactor);
+        // Axis-sliced keys are the inverse of the bit slicing in UpdateDUIDSIndex / DUIDSIndexingCS.
+        // Bits that the slicing drops are restored as the midpoint of the truncated range.
+        Coord.DUIDSLocation = Index;
+        Coord.LatticeOrder = Order;
+        Coord.X = ((int32)(Index.MajorClass & 0xF) << 20) | (1 << 19);
+        Coord.Y = ((int32)(Index.Division & 0xFF) << 16) | (1 << 15);
+        Coord.Z = ((int32)(Index.Section & 0xFFF) << 8) | (1 << 7);
+        Coord.W = (int32)(Index.SubSection & 0xFFFFFF);
+        Coord.U = (int32)(Index.SubSection >> 24);
+        Coord.V = ((int32)Index.Cutter << 8) | (1 << 7);
     }
 
     UE_LOG(LogHexademicLattice, Verbose, TEXT("Converted DUIDS Index %s to 6D coordinate for Order %d: X=%d, Y=%d, Z=%d, W=%d, U=%d, V=%d"),
@@ -194,6 +133,30 @@ void FHexademicMemoryNode::UpdateResonanceFromNeighbors(const TArray<FHexademicM
     UE_LOG(LogHexademicLattice, Verbose, TEXT("Memory %s updated resonance from %d neighbors. New resonance: %f"), *MemoryID.ToString(), Neighbors.Num(), ResonanceStrength);
 }
 
+void FHexademicMemoryNode::UpdateResonanceFromNeighbors(const FHexademic6LatticeStore& Store, int32 MaxNeighbors)
+{
+    // Same resonance model as the array overload, but the neighbors come from the lattice store's
+    // per-order grid: a k-nearest query over a few grid cells instead of a caller-built copy.
+    TArray<FHexademicNodeHandle> NeighborHandles;
+    Store.QueryKNearest(LatticePosition, MaxNeighbors, NeighborHandles, MemoryID);
+
+    float TotalResonance = 0.0f;
+    for (const FHexademicNodeHandle& Handle : NeighborHandles)
+    {
+        TotalResonance += LatticePosition.CalculateResonanceWith(Store.GetColumns(Handle.Order).GetPosition(Store.GetRow(Handle), Handle.Order));
+    }
+
+    if (NeighborHandles.Num() > 0)
+    {
+        ResonanceStrength = FMath::Clamp(TotalResonance / NeighborHandles.Num(), 0.0f, 1.0f);
+    }
+    else
+    {
+        ResonanceStrength = 0.5f; // Default if no neighbors
+    }
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Memory %s updated resonance from %d indexed neighbors. New resonance: %f"), *MemoryID.ToString(), NeighborHandles.Num(), ResonanceStrength);
+}
+
 // NOTE: ShouldPromoteToHigherOrder is now FORCEINLINE in the header.
 // NOTE: ShouldDecayToLowerOrder is now FORCEINLINE in the header (no changes needed beyond DUIDS logic in header).
 // NOTE: DetermineOptimalOrder is now FORCEINLINE in the header.
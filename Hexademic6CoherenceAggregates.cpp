@@ -0,0 +1,149 @@
+// Hexademic6CoherenceAggregates.cpp
+// Influence deltas and the deterministic parallel recompute.
+
+#include "Hexademic6CoherenceAggregates.h"
+#include "Hexademic6LatticeStore.h" // For FHexademic6LatticeStore
+#include "Async/ParallelFor.h"      // For ParallelFor
+
+namespace Hexademic6CoherenceAggregatesPrivate
+{
+    // Memories per recompute chunk. Chunk boundaries depend only on the number of memories.
+    constexpr int32 ReductionChunkSize = 4096;
+
+    using FOrderSums = TStaticArray<FHexademic6InfluenceAggregate, FHexademic6OrderIndexing::NumOrders>;
+
+    FORCEINLINE void Accumulate(FHexademic6InfluenceAggregate& Aggregate, double Influence)
+    {
+        Aggregate.Sum += Influence;
+        Aggregate.SumSquares += Influence * Influence;
+        ++Aggregate.Count;
+    }
+
+    // Runs VisitRange(Begin, End, Sums) over fixed chunks of [0, Num) on worker threads and
+    // returns the chunk sums added up in chunk order.
+    template<typename VisitorType>
+    FOrderSums Reduce(int32 Num, const VisitorType& VisitRange)
+    {
+        const int32 NumChunks = FMath::DivideAndRoundUp(Num, ReductionChunkSize);
+        TArray<FOrderSums> Partials;
+        Partials.SetNum(NumChunks);
+        ParallelFor(NumChunks, [Num, &VisitRange, &Partials](int32 Chunk)
+        {
+            VisitRange(Chunk * ReductionChunkSize, FMath::Min((Chunk + 1) * ReductionChunkSize, Num), Partials[Chunk]);
+        }, NumChunks < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+        FOrderSums Total;
+        for (const FOrderSums& Partial : Partials)
+        {
+            for (int32 OrderIndex = 0; OrderIndex < FHexademic6OrderIndexing::NumOrders; ++OrderIndex)
+            {
+                Total[OrderIndex].Add(Partial[OrderIndex]);
+            }
+        }
+        return Total;
+    }
+}
+
+// =============================================================================
+// DELTAS
+// =============================================================================
+
+void FHexademic6CoherenceAggregates::Add(ECognitiveLatticeOrder Order, float Influence)
+{
+    Hexademic6CoherenceAggregatesPrivate::Accumulate(Orders[(uint8)Order], Influence);
+    ++NumDeltas;
+}
+
+void FHexademic6CoherenceAggregates::Remove(ECognitiveLatticeOrder Order, float Influence)
+{
+    FHexademic6InfluenceAggregate& Aggregate = Orders[(uint8)Order];
+    Aggregate.Sum -= Influence;
+    Aggregate.SumSquares -= (double)Influence * Influence;
+    if (--Aggregate.Count == 0)
+    {
+        Aggregate = FHexademic6InfluenceAggregate(); // Exact again once the order is empty
+    }
+    ++NumDeltas;
+}
+
+void FHexademic6CoherenceAggregates::Update(ECognitiveLatticeOrder Order, float OldInfluence, float NewInfluence)
+{
+    if (OldInfluence == NewInfluence)
+    {
+        return;
+    }
+    FHexademic6InfluenceAggregate& Aggregate = Orders[(uint8)Order];
+    Aggregate.Sum += (double)NewInfluence - OldInfluence;
+    Aggregate.SumSquares += (double)NewInfluence * NewInfluence - (double)OldInfluence * OldInfluence;
+    ++NumDeltas;
+}
+
+void FHexademic6CoherenceAggregates::Reset()
+{
+    for (FHexademic6InfluenceAggregate& Aggregate : Orders)
+    {
+        Aggregate = FHexademic6InfluenceAggregate();
+    }
+    NumDeltas = 0;
+}
+
+FHexademic6InfluenceAggregate FHexademic6CoherenceAggregates::GetGlobal() const
+{
+    FHexademic6InfluenceAggregate Global;
+    for (const FHexademic6InfluenceAggregate& Aggregate : Orders)
+    {
+        Global.Add(Aggregate);
+    }
+    return Global;
+}
+
+// =============================================================================
+// RECOMPUTE
+// =============================================================================
+
+void FHexademic6CoherenceAggregates::Recompute(const FHexademic6LatticeStore& Store)
+{
+    using namespace Hexademic6CoherenceAggregatesPrivate;
+
+    // Rows of every order are numbered consecutively, so chunks may span order boundaries.
+    int32 OrderStarts[FHexademic6OrderIndexing::NumOrders + 1];
+    OrderStarts[0] = 0;
+    for (int32 OrderIndex = 0; OrderIndex < FHexademic6OrderIndexing::NumOrders; ++OrderIndex)
+    {
+        OrderStarts[OrderIndex + 1] = OrderStarts[OrderIndex] + Store.Num(static_cast<ECognitiveLatticeOrder>(OrderIndex));
+    }
+    Orders = Reduce(OrderStarts[FHexademic6OrderIndexing::NumOrders], [&Store, &OrderStarts](int32 Begin, int32 End, FOrderSums& OutSums)
+    {
+        for (int32 OrderIndex = 0; OrderIndex < FHexademic6OrderIndexing::NumOrders; ++OrderIndex)
+        {
+            const int32 FirstRow = FMath::Max(Begin, OrderStarts[OrderIndex]) - OrderStarts[OrderIndex];
+            const int32 EndRow = FMath::Min(End, OrderStarts[OrderIndex + 1]) - OrderStarts[OrderIndex];
+            const FHexademic6OrderColumns& Columns = Store.GetColumns(static_cast<ECognitiveLatticeOrder>(OrderIndex));
+            const float* Resonance = Columns.ResonanceStrength.GetData();
+            const float* Weight = Columns.CognitiveWeight.GetData();
+            for (int32 Row = FirstRow; Row < EndRow; ++Row)
+            {
+                Accumulate(OutSums[OrderIndex], GetInfluence(Resonance[Row], Weight[Row]));
+            }
+        }
+    });
+    NumDeltas = 0;
+}
+
+void FHexademic6CoherenceAggregates::Recompute(TConstArrayView<FHexademicMemoryNode> Memories)
+{
+    using namespace Hexademic6CoherenceAggregatesPrivate;
+    Orders = Reduce(Memories.Num(), [Memories](int32 Begin, int32 End, FOrderSums& OutSums)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            const FHexademicMemoryNode& Memory = Memories[Index];
+            const int32 OrderIndex = (int32)Memory.LatticePosition.LatticeOrder;
+            if (OrderIndex < FHexademic6OrderIndexing::NumOrders)
+            {
+                Accumulate(OutSums[OrderIndex], GetInfluence(Memory.ResonanceStrength, Memory.CognitiveWeight));
+            }
+        }
+    });
+    NumDeltas = 0;
+}
@@ -0,0 +1,407 @@
+// Hexademic6CrossReferenceGraph.cpp
+// CSR maintenance, override compaction and the BFS and Dijkstra traversals.
+
+#include "Hexademic6CrossReferenceGraph.h"
+#include "Algo/Reverse.h"         // For Algo::Reverse
+#include "Async/ParallelFor.h"    // For ParallelFor
+#include "Templates/UniquePtr.h"  // For TUniquePtr
+#include <atomic>
+
+namespace Hexademic6CrossReferenceGraphPrivate
+{
+    // Overrides are compacted once they hold this many entries plus edges, or a quarter of the
+    // CSR's edges if that is more.
+    constexpr int32 MinCompactionThreshold = 1024;
+
+    // Frontiers below this size are expanded on the calling thread.
+    constexpr int32 MinParallelFrontier = 1024;
+    constexpr int32 FrontierChunkSize = 256;
+
+    // Traversals track visited nodes in a hash set until they visit this many, so a short walk
+    // in a large graph does not allocate and clear a bit per node.
+    constexpr int32 MaxSparseVisited = MinParallelFrontier;
+
+    struct FQueuedNode
+    {
+        float Cost;
+        int32 Node;
+
+        bool operator<(const FQueuedNode& Other) const { return Cost < Other.Cost; }
+    };
+}
+
+// Starts as a hash set and switches to a bit per node once it grows past MaxSparseVisited.
+// Only the bitset may be claimed in concurrently; MakeDense switches before a parallel expansion.
+class FHexademic6CrossReferenceGraph::FVisitedSet
+{
+public:
+    explicit FVisitedSet(int32 InNumNodes)
+        : NumNodes(InNumNodes)
+    {
+    }
+
+    // True if this call marked Node, false if it was already visited.
+    FORCEINLINE bool Claim(int32 Node)
+    {
+        if (!Words)
+        {
+            bool bAlreadyVisited;
+            Sparse.Add(Node, &bAlreadyVisited);
+            if (!bAlreadyVisited && Sparse.Num() > Hexademic6CrossReferenceGraphPrivate::MaxSparseVisited)
+            {
+                MakeDense();
+            }
+            return !bAlreadyVisited;
+        }
+        const uint64 Bit = 1ull << (Node & 63);
+        std::atomic<uint64>& Word = Words[Node >> 6];
+        return (Word.load(std::memory_order_relaxed) & Bit) == 0
+            && (Word.fetch_or(Bit, std::memory_order_relaxed) & Bit) == 0;
+    }
+
+    FORCEINLINE bool Contains(int32 Node) const
+    {
+        if (!Words)
+        {
+            return Sparse.Contains(Node);
+        }
+        return (Words[Node >> 6].load(std::memory_order_relaxed) & (1ull << (Node & 63))) != 0;
+    }
+
+    void MakeDense()
+    {
+        if (Words)
+        {
+            return;
+        }
+        Words = MakeUnique<std::atomic<uint64>[]>((NumNodes + 63) / 64);
+        for (const int32 Node : Sparse)
+        {
+            Words[Node >> 6].fetch_or(1ull << (Node & 63), std::memory_order_relaxed);
+        }
+        Sparse.Empty();
+    }
+
+private:
+    int32 NumNodes;
+    TSet<int32> Sparse;
+    TUniquePtr<std::atomic<uint64>[]> Words;
+};
+
+// =============================================================================
+// UPDATES
+// =============================================================================
+
+int32 FHexademic6CrossReferenceGraph::FindNode(const FDUIDSIndex& Key) const
+{
+    const int32* Node = NodeIds.Find(Key);
+    return Node ? *Node : INDEX_NONE;
+}
+
+int32 FHexademic6CrossReferenceGraph::FindOrAddNode(const FDUIDSIndex& Key)
+{
+    if (const int32* Node = NodeIds.Find(Key))
+    {
+        return *Node;
+    }
+    const int32 Node = Keys.Add(Key);
+    Weights.Add(0.0f);
+    Priorities.Add(0);
+    Overridden.Add(false);
+    NodeIds.Add(Key, Node);
+    return Node;
+}
+
+bool FHexademic6CrossReferenceGraph::ClaimNode(int32 Node, uint8 Priority)
+{
+    check(Priority > 0);
+    if (Priorities[Node] > Priority)
+    {
+        return false;
+    }
+    Priorities[Node] = Priority;
+    return true;
+}
+
+void FHexademic6CrossReferenceGraph::SetReferences(const FDUIDSIndex& Key, TConstArrayView<FDUIDSIndex> References, float Weight, uint8 Priority)
+{
+    const int32 Node = FindOrAddNode(Key);
+    if (!ClaimNode(Node, Priority))
+    {
+        return;
+    }
+    Weights[Node] = Weight;
+    TArray<int32> NewTargets;
+    NewTargets.Reserve(References.Num());
+    for (const FDUIDSIndex& Reference : References)
+    {
+        NewTargets.Add(FindOrAddNode(Reference));
+    }
+    SetOverride(Node, MoveTemp(NewTargets));
+
+    using namespace Hexademic6CrossReferenceGraphPrivate;
+    if (Overrides.Num() + NumOverrideEdges > FMath::Max(MinCompactionThreshold, Targets.Num() / 4))
+    {
+        Compact();
+    }
+}
+
+void FHexademic6CrossReferenceGraph::RemoveReferences(const FDUIDSIndex& Key, uint8 Priority)
+{
+    const int32 Node = FindNode(Key);
+    if (Node != INDEX_NONE && ClaimNode(Node, Priority))
+    {
+        SetOverride(Node, TArray<int32>());
+
+        using namespace Hexademic6CrossReferenceGraphPrivate;
+        if (Overrides.Num() + NumOverrideEdges > FMath::Max(MinCompactionThreshold, Targets.Num() / 4))
+        {
+            Compact();
+        }
+    }
+}
+
+void FHexademic6CrossReferenceGraph::SetOverride(int32 Node, TArray<int32>&& NewTargets)
+{
+    const int32 PreviousEdges = GetNeighbors(Node).Num();
+    NumLiveEdges += NewTargets.Num() - PreviousEdges;
+    if (Overridden[Node])
+    {
+        NumOverrideEdges -= PreviousEdges;
+    }
+    NumOverrideEdges += NewTargets.Num();
+    Overrides.Add(Node, MoveTemp(NewTargets));
+    Overridden[Node] = true;
+}
+
+void FHexademic6CrossReferenceGraph::Compact()
+{
+    // Nodes with no edges in either direction (retired keys nothing points at any more) are
+    // dropped, and the survivors are renumbered in their existing order.
+    TBitArray<> Referenced(false, Num());
+    for (int32 Node = 0; Node < Num(); ++Node)
+    {
+        for (const int32 Neighbor : GetNeighbors(Node))
+        {
+            Referenced[Neighbor] = true;
+        }
+    }
+    TArray<int32> NewIds;
+    NewIds.SetNumUninitialized(Num());
+    int32 NumKept = 0;
+    for (int32 Node = 0; Node < Num(); ++Node)
+    {
+        NewIds[Node] = (Referenced[Node] || GetNeighbors(Node).Num() > 0) ? NumKept++ : INDEX_NONE;
+    }
+
+    TArray<int32> NewOffsets;
+    TArray<int32> NewTargets;
+    NewOffsets.SetNumUninitialized(NumKept + 1);
+    NewTargets.Reserve(NumLiveEdges);
+    for (int32 Node = 0; Node < Num(); ++Node)
+    {
+        const int32 NewId = NewIds[Node];
+        if (NewId == INDEX_NONE)
+        {
+            NodeIds.Remove(Keys[Node]);
+            continue;
+        }
+        NewOffsets[NewId] = NewTargets.Num();
+        for (const int32 Neighbor : GetNeighbors(Node))
+        {
+            NewTargets.Add(NewIds[Neighbor]);
+        }
+        if (NewId != Node)
+        {
+            Keys[NewId] = Keys[Node];
+            Weights[NewId] = Weights[Node];
+            Priorities[NewId] = Priorities[Node];
+            NodeIds[Keys[NewId]] = NewId;
+        }
+    }
+    NewOffsets[NumKept] = NewTargets.Num();
+
+    Keys.SetNum(NumKept);
+    Weights.SetNum(NumKept);
+    Priorities.SetNum(NumKept);
+    Offsets = MoveTemp(NewOffsets);
+    Targets = MoveTemp(NewTargets);
+    Overrides.Reset();
+    Overridden.Init(false, NumKept);
+    NumOverrideEdges = 0;
+}
+
+void FHexademic6CrossReferenceGraph::Empty()
+{
+    Keys.Empty();
+    Weights.Empty();
+    Priorities.Empty();
+    NodeIds.Empty();
+    Offsets.Empty();
+    Targets.Empty();
+    Overridden.Empty();
+    Overrides.Empty();
+    NumOverrideEdges = 0;
+    NumLiveEdges = 0;
+}
+
+// =============================================================================
+// TRAVERSAL
+// =============================================================================
+
+void FHexademic6CrossReferenceGraph::ExpandFrontier(TConstArrayView<int32> Frontier, FVisitedSet& Visited, TArray<int32>& OutNext) const
+{
+    using namespace Hexademic6CrossReferenceGraphPrivate;
+    OutNext.Reset();
+    if (Frontier.Num() < MinParallelFrontier)
+    {
+        for (const int32 Node : Frontier)
+        {
+            for (const int32 Neighbor : GetNeighbors(Node))
+            {
+                if (Visited.Claim(Neighbor))
+                {
+                    OutNext.Add(Neighbor);
+                }
+            }
+        }
+    }
+    else
+    {
+        // Chunks claim nodes through the shared visited set, so each node lands in exactly one
+        // chunk; which one depends on timing, hence the sort below.
+        Visited.MakeDense();
+        const int32 NumChunks = FMath::DivideAndRoundUp(Frontier.Num(), FrontierChunkSize);
+        TArray<TArray<int32>> ChunkNext;
+        ChunkNext.SetNum(NumChunks);
+        ParallelFor(NumChunks, [this, Frontier, &Visited, &ChunkNext](int32 Chunk)
+        {
+            const int32 End = FMath::Min((Chunk + 1) * FrontierChunkSize, Frontier.Num());
+            TArray<int32>& Next = ChunkNext[Chunk];
+            for (int32 FrontierIndex = Chunk * FrontierChunkSize; FrontierIndex < End; ++FrontierIndex)
+            {
+                for (const int32 Neighbor : GetNeighbors(Frontier[FrontierIndex]))
+                {
+                    if (Visited.Claim(Neighbor))
+                    {
+                        Next.Add(Neighbor);
+                    }
+                }
+            }
+        });
+        for (const TArray<int32>& Next : ChunkNext)
+        {
+            OutNext.Append(Next);
+        }
+    }
+    OutNext.Sort();
+}
+
+void FHexademic6CrossReferenceGraph::GatherWithinHops(int32 Start, int32 MaxHops, TArray<int32>& OutNodes, TArray<int32>* OutHops) const
+{
+    OutNodes.Reset();
+    if (OutHops)
+    {
+        OutHops->Reset();
+    }
+    if (!Keys.IsValidIndex(Start) || MaxHops <= 0)
+    {
+        return;
+    }
+    FVisitedSet Visited(Num());
+    Visited.Claim(Start);
+    TArray<int32> Frontier;
+    TArray<int32> Next;
+    Frontier.Add(Start);
+    for (int32 Hop = 1; Hop <= MaxHops && Frontier.Num() > 0; ++Hop)
+    {
+        ExpandFrontier(Frontier, Visited, Next);
+        OutNodes.Append(Next);
+        if (OutHops)
+        {
+            const int32 First = OutHops->AddUninitialized(Next.Num());
+            for (int32 NodeIndex = 0; NodeIndex < Next.Num(); ++NodeIndex)
+            {
+                (*OutHops)[First + NodeIndex] = Hop;
+            }
+        }
+        Swap(Frontier, Next);
+    }
+}
+
+bool FHexademic6CrossReferenceGraph::IsReachable(int32 From, int32 To, int32 MaxHops) const
+{
+    if (!Keys.IsValidIndex(From) || !Keys.IsValidIndex(To))
+    {
+        return false;
+    }
+    if (From == To)
+    {
+        return true;
+    }
+    FVisitedSet Visited(Num());
+    Visited.Claim(From);
+    TArray<int32> Frontier;
+    TArray<int32> Next;
+    Frontier.Add(From);
+    for (int32 Hop = 1; Hop <= MaxHops && Frontier.Num() > 0; ++Hop)
+    {
+        ExpandFrontier(Frontier, Visited, Next);
+        if (Visited.Contains(To))
+        {
+            return true;
+        }
+        Swap(Frontier, Next);
+    }
+    return false;
+}
+
+float FHexademic6CrossReferenceGraph::FindCheapestPath(int32 From, int32 To, TFunctionRef<float(int32 Source, int32 Target)> EdgeCost, TArray<int32>& OutPath) const
+{
+    using namespace Hexademic6CrossReferenceGraphPrivate;
+    OutPath.Reset();
+    if (!Keys.IsValidIndex(From) || !Keys.IsValidIndex(To))
+    {
+        return -1.0f;
+    }
+    TArray<float> Costs;
+    TArray<int32> Previous;
+    Costs.Init(MAX_flt, Num());
+    Previous.Init(INDEX_NONE, Num());
+    TArray<FQueuedNode> Heap;
+    Costs[From] = 0.0f;
+    Heap.HeapPush({ 0.0f, From });
+    while (Heap.Num() > 0)
+    {
+        FQueuedNode Current;
+        Heap.HeapPop(Current, EAllowShrinking::No);
+        if (Current.Cost > Costs[Current.Node])
+        {
+            continue; // Stale entry, the node was reached more cheaply since
+        }
+        if (Current.Node == To)
+        {
+            break;
+        }
+        for (const int32 Neighbor : GetNeighbors(Current.Node))
+        {
+            const float Cost = Current.Cost + FMath::Max(EdgeCost(Current.Node, Neighbor), 0.0f);
+            if (Cost < Costs[Neighbor])
+            {
+                Costs[Neighbor] = Cost;
+                Previous[Neighbor] = Current.Node;
+                Heap.HeapPush({ Cost, Neighbor });
+            }
+        }
+    }
+    if (Costs[To] == MAX_flt)
+    {
+        return -1.0f;
+    }
+    for (int32 Node = To; Node != INDEX_NONE; Node = Previous[Node])
+    {
+        OutPath.Add(Node);
+    }
+    Algo::Reverse(OutPath);
+    return Costs[To];
+}
@@ -0,0 +1,268 @@
+// Hexademic6DUIDSCurve.cpp
+// 6D Morton codec for DUIDS keys and box-to-range decomposition for neighborhood queries.
+
+#include "Hexademic6DUIDSCurve.h"
+#include "HexademicSixLattice.h"
+#include "HAL/IConsoleManager.h" // For TAutoConsoleVariable
+#include "Logging/LogMacros.h"   // For UE_LOG
+
+static TAutoConsoleVariable<int32> CVarHexademicDUIDSEncoding(
+    TEXT("Hexademic.DUIDS.Encoding"),
+    0,
+    TEXT("DUIDS key encoding. 0: axis-sliced (legacy), 1: 6D Morton curve.\n")
+    TEXT("Must be set before any index is generated; a store cannot mix encodings."),
+    ECVF_Default);
+
+namespace Hexademic6DUIDSCurvePrivate
+{
+    // Spreads the 6 low bits of a value so that bit i lands on bit 6*i.
+    struct FSpreadTable
+    {
+        uint64 Spread[64];
+
+        FSpreadTable()
+        {
+            for (uint32 Value = 0; Value < 64; ++Value)
+            {
+                uint64 Result = 0;
+                for (uint32 Bit = 0; Bit < 6; ++Bit)
+                {
+                    Result |= static_cast<uint64>((Value >> Bit) & 1u) << (Bit * 6);
+                }
+                Spread[Value] = Result;
+            }
+        }
+    };
+
+    static const FSpreadTable GSpreadTable;
+
+    // Inverse of the spread: gathers bits 0, 6, 12, ... 30 of Half into 6 bits.
+    FORCEINLINE uint32 Compact(uint64 Half)
+    {
+        uint32 Result = 0;
+        for (uint32 Bit = 0; Bit < 6; ++Bit)
+        {
+            Result |= static_cast<uint32>((Half >> (Bit * 6)) & 1u) << Bit;
+        }
+        return Result;
+    }
+
+    struct FBoxNode
+    {
+        uint32 Base[6];
+        int32 Level;
+    };
+
+    enum class EOverlap : uint8 { Disjoint, Partial, Inside };
+
+    FORCEINLINE EOverlap Classify(const FBoxNode& Node, const uint32 (&MinCell)[6], const uint32 (&MaxCell)[6])
+    {
+        const uint32 Side = 1u << Node.Level;
+        bool bInside = true;
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            const uint32 NodeMin = Node.Base[Axis];
+            const uint32 NodeMax = NodeMin + Side - 1;
+            if (NodeMax < MinCell[Axis] || NodeMin > MaxCell[Axis])
+            {
+                return EOverlap::Disjoint;
+            }
+            bInside &= (NodeMin >= MinCell[Axis] && NodeMax <= MaxCell[Axis]);
+        }
+        return bInside ? EOverlap::Inside : EOverlap::Partial;
+    }
+
+    FORCEINLINE void EmitNode(const FBoxNode& Node, TArray<TPair<FHexademic6DUIDSCurve::FCode, FHexademic6DUIDSCurve::FCode>>& OutRanges)
+    {
+        uint32 Last[6];
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            Last[Axis] = Node.Base[Axis] + (1u << Node.Level) - 1;
+        }
+        OutRanges.Emplace(FHexademic6DUIDSCurve::EncodeCells(Node.Base), FHexademic6DUIDSCurve::EncodeCells(Last));
+    }
+}
+
+EDUIDSEncodingMode FHexademic6DUIDSCurve::GetEncodingMode()
+{
+    return CVarHexademicDUIDSEncoding.GetValueOnAnyThread() == 1 ? EDUIDSEncodingMode::Morton : EDUIDSEncodingMode::AxisSliced;
+}
+
+FHexademic6DUIDSCurve::FCode FHexademic6DUIDSCurve::EncodeCells(const uint32 (&Cells)[6])
+{
+    using namespace Hexademic6DUIDSCurvePrivate;
+    FCode Code;
+    for (int32 Axis = 0; Axis < 6; ++Axis)
+    {
+        const uint32 Cell = Cells[Axis] & MaxCell;
+        Code.Lo |= GSpreadTable.Spread[Cell & 63] << Axis;
+        Code.Hi |= GSpreadTable.Spread[Cell >> 6] << Axis;
+    }
+    return Code;
+}
+
+void FHexademic6DUIDSCurve::DecodeCells(const FCode& Code, uint32 (&OutCells)[6])
+{
+    using namespace Hexademic6DUIDSCurvePrivate;
+    for (int32 Axis = 0; Axis < 6; ++Axis)
+    {
+        OutCells[Axis] = Compact(Code.Lo >> Axis) | (Compact(Code.Hi >> Axis) << 6);
+    }
+}
+
+FDUIDSIndex FHexademic6DUIDSCurve::ToDUIDSIndex(const FCode& Code, ECognitiveLatticeOrder Order, uint8 Edition)
+{
+    FDUIDSIndex Index;
+    Index.MajorClass = static_cast<uint8>(((uint8)Order << 4) | ((Code.Hi >> 32) & 0xF));
+    Index.Division = static_cast<uint8>((Code.Hi >> 24) & 0xFF);
+    Index.Section = static_cast<uint16>((Code.Hi >> 12) & 0xFFF);
+    Index.SubSection = static_cast<uint32>(((Code.Hi & 0xFFF) << 20) | (Code.Lo >> 16));
+    Index.Cutter = static_cast<uint16>(Code.Lo & 0xFFFF);
+    Index.Edition = Edition;
+    return Index;
+}
+
+FHexademic6DUIDSCurve::FCode FHexademic6DUIDSCurve::FromDUIDSIndex(const FDUIDSIndex& Index)
+{
+    FCode Code;
+    Code.Hi = (static_cast<uint64>(Index.MajorClass & 0xF) << 32)
+            | (static_cast<uint64>(Index.Division & 0xFF) << 24)
+            | (static_cast<uint64>(Index.Section & 0xFFF) << 12)
+            | (static_cast<uint64>(Index.SubSection) >> 20);
+    Code.Lo = ((static_cast<uint64>(Index.SubSection) & 0xFFFFF) << 16) | static_cast<uint64>(Index.Cutter);
+    return Code;
+}
+
+FDUIDSIndex FHexademic6DUIDSCurve::Encode(const FHexademic6DCoordinate& Coord)
+{
+    const ECognitiveLatticeOrder Order = Coord.LatticeOrder;
+    const uint32 Cells[6] =
+    {
+        QuantizeAxis(Coord.X, Order), QuantizeAxis(Coord.Y, Order), QuantizeAxis(Coord.Z, Order),
+        QuantizeAxis(Coord.W, Order), QuantizeAxis(Coord.U, Order), QuantizeAxis(Coord.V, Order)
+    };
+    return ToDUIDSIndex(EncodeCells(Cells), Order, Coord.DUIDSLocation.Edition);
+}
+
+FHexademic6DCoordinate FHexademic6DUIDSCurve::Decode(const FDUIDSIndex& Index, ECognitiveLatticeOrder Order)
+{
+    uint32 Cells[6];
+    DecodeCells(FromDUIDSIndex(Index), Cells);
+
+    FHexademic6DCoordinate Coord;
+    Coord.X = DequantizeAxis(Cells[0], Order);
+    Coord.Y = DequantizeAxis(Cells[1], Order);
+    Coord.Z = DequantizeAxis(Cells[2], Order);
+    Coord.W = DequantizeAxis(Cells[3], Order);
+    Coord.U = DequantizeAxis(Cells[4], Order);
+    Coord.V = DequantizeAxis(Cells[5], Order);
+    Coord.LatticeOrder = Order;
+    Coord.DUIDSLocation = Index;
+    return Coord;
+}
+
+void FHexademic6DUIDSCurve::DecomposeBox(const FHexademic6DCoordinate& Min, const FHexademic6DCoordinate& Max, ECognitiveLatticeOrder Order, TArray<FDUIDSIndexRange>& OutRanges, int32 MaxRanges)
+{
+    using namespace Hexademic6DUIDSCurvePrivate;
+    OutRanges.Reset();
+
+    const int32 MinAxes[6] = { Min.X, Min.Y, Min.Z, Min.W, Min.U, Min.V };
+    const int32 MaxAxes[6] = { Max.X, Max.Y, Max.Z, Max.W, Max.U, Max.V };
+    uint32 MinCell[6];
+    uint32 MaxCell[6];
+    for (int32 Axis = 0; Axis < 6; ++Axis)
+    {
+        MinCell[Axis] = QuantizeAxis(FMath::Min(MinAxes[Axis], MaxAxes[Axis]), Order);
+        MaxCell[Axis] = QuantizeAxis(FMath::Max(MinAxes[Axis], MaxAxes[Axis]), Order);
+    }
+
+    TArray<TPair<FCode, FCode>> CodeRanges;
+    TArray<FBoxNode> Partials;
+    Partials.Add(FBoxNode{ { 0, 0, 0, 0, 0, 0 }, BitsPerAxis });
+
+    TArray<FBoxNode> ChildInside;
+    TArray<FBoxNode> ChildPartial;
+    while (Partials.Num() > 0)
+    {
+        // Tentatively refine every partially covered block by one level. Only child halves
+        // that intersect the box on every axis are generated.
+        ChildInside.Reset();
+        ChildPartial.Reset();
+        for (const FBoxNode& Node : Partials)
+        {
+            const int32 ChildLevel = Node.Level - 1;
+            const uint32 Half = 1u << ChildLevel;
+            uint32 HalfMask[6];
+            for (int32 Axis = 0; Axis < 6; ++Axis)
+            {
+                const uint32 LowerMax = Node.Base[Axis] + Half - 1;
+                const uint32 UpperMin = Node.Base[Axis] + Half;
+                HalfMask[Axis] = (MinCell[Axis] <= LowerMax ? 1u : 0u) | (MaxCell[Axis] >= UpperMin ? 2u : 0u);
+            }
+            for (uint32 Child = 0; Child < 64; ++Child)
+            {
+                FBoxNode ChildNode;
+                ChildNode.Level = ChildLevel;
+                bool bIntersects = true;
+                for (int32 Axis = 0; Axis < 6 && bIntersects; ++Axis)
+                {
+                    const uint32 Upper = (Child >> Axis) & 1u;
+                    bIntersects = (HalfMask[Axis] & (1u << Upper)) != 0;
+                    ChildNode.Base[Axis] = Node.Base[Axis] + Upper * Half;
+                }
+                if (!bIntersects)
+                {
+                    continue;
+                }
+                const EOverlap Overlap = Classify(ChildNode, MinCell, MaxCell);
+                if (Overlap == EOverlap::Inside)
+                {
+                    ChildInside.Add(ChildNode);
+                }
+                else if (Overlap == EOverlap::Partial)
+                {
+                    ChildPartial.Add(ChildNode);
+                }
+            }
+        }
+
+        if (CodeRanges.Num() + ChildInside.Num() + ChildPartial.Num() > MaxRanges)
+        {
+            // Over budget: keep the coarser blocks as (over-approximating) ranges.
+            for (const FBoxNode& Node : Partials)
+            {
+                EmitNode(Node, CodeRanges);
+            }
+            break;
+        }
+
+        for (const FBoxNode& Node : ChildInside)
+        {
+            EmitNode(Node, CodeRanges);
+        }
+        Swap(Partials, ChildPartial);
+    }
+
+    // Sort by start code and merge ranges that touch.
+    CodeRanges.Sort([](const TPair<FCode, FCode>& A, const TPair<FCode, FCode>& B) { return A.Key < B.Key; });
+    TArray<TPair<FCode, FCode>> Merged;
+    for (const TPair<FCode, FCode>& Range : CodeRanges)
+    {
+        if (Merged.Num() > 0 && !(Merged.Last().Value.Next() < Range.Key))
+        {
+            if (Merged.Last().Value < Range.Value)
+            {
+                Merged.Last().Value = Range.Value;
+            }
+            continue;
+        }
+        Merged.Add(Range);
+    }
+
+    OutRanges.Reserve(Merged.Num());
+    for (const TPair<FCode, FCode>& Range : Merged)
+    {
+        OutRanges.Add(FDUIDSIndexRange{ ToDUIDSIndex(Range.Key, Order, 0), ToDUIDSIndex(Range.Value, Order, 255) });
+    }
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Decomposed 6D box into %d DUIDS ranges for Order %d."), OutRanges.Num(), (uint8)Order);
+}
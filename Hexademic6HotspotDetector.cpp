@@ -0,0 +1,387 @@
+// Hexademic6HotspotDetector.cpp
+// Parallel grid clustering, change-driven re-clustering and hotspot ranking.
+
+#include "Hexademic6HotspotDetector.h"
+#include "Hexademic6ResonanceField.h" // For FHexademic6ResonanceField
+#include "Algo/Sort.h"                // For Algo::Sort
+#include "Async/ParallelFor.h"        // For ParallelFor
+#include "HAL/IConsoleManager.h"      // For TAutoConsoleVariable
+#include "Logging/LogMacros.h"        // For UE_LOG
+#include "Misc/ScopeLock.h"           // For FScopeLock
+#include "Templates/UniquePtr.h"      // For TUniquePtr
+#include <atomic>
+
+static TAutoConsoleVariable<float> CVarHexademicHotspotsMinDensity(
+    TEXT("Hexademic.Hotspots.MinDensity"),
+    0.5f,
+    TEXT("Resonance field value at which a voxel is dense enough to belong to a hotspot."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicHotspotsMaxResults(
+    TEXT("Hexademic.Hotspots.MaxResults"),
+    8,
+    TEXT("Hotspots returned by a query that does not ask for a specific number."),
+    ECVF_Default);
+
+namespace Hexademic6HotspotDetectorPrivate
+{
+    // Voxels per parallel chunk; smaller passes run on the calling thread.
+    constexpr int32 VoxelChunkSize = 1024;
+
+    template<typename VisitorType>
+    void ParallelRange(int32 Num, const VisitorType& VisitRange)
+    {
+        const int32 NumChunks = FMath::DivideAndRoundUp(Num, VoxelChunkSize);
+        ParallelFor(NumChunks, [Num, &VisitRange](int32 Chunk)
+        {
+            VisitRange(Chunk * VoxelChunkSize, FMath::Min((Chunk + 1) * VoxelChunkSize, Num));
+        }, NumChunks < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+    }
+
+    // The voxel one step along Axis, wrapping within the key's 10 bits like the field does.
+    FORCEINLINE uint64 OffsetVoxelKey(uint64 Key, int32 Axis, int32 Delta)
+    {
+        const int32 Shift = Axis * 10;
+        const uint64 Component = ((Key >> Shift) + static_cast<uint64>(static_cast<int64>(Delta))) & 1023;
+        return (Key & ~(static_cast<uint64>(1023) << Shift)) | (Component << Shift);
+    }
+
+    template<typename VisitorType>
+    FORCEINLINE void ForEachNeighbor(uint64 Key, VisitorType&& Visitor)
+    {
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            Visitor(OffsetVoxelKey(Key, Axis, -1));
+            Visitor(OffsetVoxelKey(Key, Axis, 1));
+        }
+    }
+
+    // Concurrent union-find. A root is only ever linked under a smaller root, so Parents[Node] <= Node
+    // throughout and every component ends up rooted at its lowest index.
+    FORCEINLINE int32 FindRoot(std::atomic<int32>* Parents, int32 Node)
+    {
+        while (true)
+        {
+            int32 Parent = Parents[Node].load(std::memory_order_relaxed);
+            if (Parent == Node)
+            {
+                return Node;
+            }
+            const int32 Grandparent = Parents[Parent].load(std::memory_order_relaxed);
+            if (Grandparent != Parent)
+            {
+                Parents[Node].compare_exchange_weak(Parent, Grandparent, std::memory_order_relaxed); // Path halving
+            }
+            Node = Grandparent;
+        }
+    }
+
+    FORCEINLINE void Union(std::atomic<int32>* Parents, int32 A, int32 B)
+    {
+        while (true)
+        {
+            A = FindRoot(Parents, A);
+            B = FindRoot(Parents, B);
+            if (A == B)
+            {
+                return;
+            }
+            if (A < B)
+            {
+                Swap(A, B);
+            }
+            int32 Expected = A;
+            if (Parents[A].compare_exchange_strong(Expected, B, std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+    }
+
+    struct FClusterSums
+    {
+        int32 RootCell[6];
+        double Offsets[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }; // Value-weighted, relative to RootCell
+        double Intensity = 0.0;
+    };
+}
+
+// =============================================================================
+// CHANGE COLLECTION
+// =============================================================================
+
+void FHexademic6HotspotDetector::CollectChanges(FHexademic6ResonanceField& Field)
+{
+    FScopeLock ScopeLock(&Lock);
+    TSet<uint64> Changed;
+    for (int32 OrderIndex = 0; OrderIndex < FHexademic6OrderIndexing::NumOrders; ++OrderIndex)
+    {
+        const ECognitiveLatticeOrder Order = static_cast<ECognitiveLatticeOrder>(OrderIndex);
+        FOrderState& State = Orders[OrderIndex];
+        if (Field.TakeChangedVoxels(Order, Changed))
+        {
+            State.bFullRecluster = true;
+        }
+        if (State.bFullRecluster)
+        {
+            State.PendingVoxels.Reset();
+            continue;
+        }
+        State.PendingVoxels.Append(Changed);
+        if (State.PendingVoxels.Num() > Field.NumVoxels(Order))
+        {
+            // Past this point a full pass is cheaper than tracking the changes.
+            State.bFullRecluster = true;
+            State.PendingVoxels.Reset();
+        }
+    }
+}
+
+void FHexademic6HotspotDetector::Reset()
+{
+    FScopeLock ScopeLock(&Lock);
+    for (FOrderState& State : Orders)
+    {
+        State = FOrderState();
+    }
+}
+
+// =============================================================================
+// QUERIES
+// =============================================================================
+
+void FHexademic6HotspotDetector::FindHotspots(const FHexademic6ResonanceField& Field, ECognitiveLatticeOrder Order, int32 MaxHotspots, TArray<FHexademic6ResonanceHotspot>& OutHotspots)
+{
+    FScopeLock ScopeLock(&Lock);
+    OutHotspots.Reset();
+    if ((int32)Order >= FHexademic6OrderIndexing::NumOrders)
+    {
+        return;
+    }
+
+    FOrderState& State = Orders[(uint8)Order];
+    const float MinDensity = FMath::Max(CVarHexademicHotspotsMinDensity.GetValueOnAnyThread(), KINDA_SMALL_NUMBER);
+    if (State.MinDensity != MinDensity)
+    {
+        State.bFullRecluster = true;
+    }
+    if (State.bFullRecluster || State.PendingVoxels.Num() > 0)
+    {
+        Recluster(Field, Order, State, MinDensity);
+    }
+
+    TArray<const FCluster*> Ranked;
+    Ranked.Reserve(State.Clusters.Num());
+    for (const FCluster& Cluster : State.Clusters)
+    {
+        Ranked.Add(&Cluster);
+    }
+    Algo::Sort(Ranked, [](const FCluster* A, const FCluster* B)
+    {
+        return A->Hotspot.Intensity != B->Hotspot.Intensity ? A->Hotspot.Intensity > B->Hotspot.Intensity : A->RootKey < B->RootKey;
+    });
+    const int32 NumResults = FMath::Min(Ranked.Num(), MaxHotspots < 0 ? CVarHexademicHotspotsMaxResults.GetValueOnAnyThread() : MaxHotspots);
+    OutHotspots.Reserve(NumResults);
+    for (int32 Index = 0; Index < NumResults; ++Index)
+    {
+        OutHotspots.Add(Ranked[Index]->Hotspot);
+    }
+}
+
+// =============================================================================
+// CLUSTERING
+// =============================================================================
+
+void FHexademic6HotspotDetector::Dissolve(FOrderState& State, int32 ClusterIndex, TArray<uint64>& OutVoxels)
+{
+    FCluster& Cluster = State.Clusters[ClusterIndex];
+    for (uint64 Key : Cluster.Voxels)
+    {
+        State.VoxelClusters.Remove(Key);
+    }
+    OutVoxels.Append(Cluster.Voxels);
+    State.Clusters.RemoveAt(ClusterIndex);
+}
+
+void FHexademic6HotspotDetector::Recluster(const FHexademic6ResonanceField& Field, ECognitiveLatticeOrder Order, FOrderState& State, float MinDensity)
+{
+    using namespace Hexademic6HotspotDetectorPrivate;
+    const TMap<uint64, FHexademic6ResonanceField::FVoxel>& Voxels = Field.GetVoxels(Order);
+    const bool bFull = State.bFullRecluster;
+
+    // Voxels whose status or hotspot may have changed: every voxel, or the changed ones plus the
+    // voxels of the hotspots they belonged to.
+    TArray<uint64> Candidates;
+    if (bFull)
+    {
+        State.VoxelClusters.Reset();
+        State.Clusters.Reset();
+        Candidates.Reserve(Voxels.Num());
+        for (const TPair<uint64, FHexademic6ResonanceField::FVoxel>& Pair : Voxels)
+        {
+            Candidates.Add(Pair.Key);
+        }
+    }
+    else
+    {
+        TArray<uint64> Dissolved;
+        for (uint64 Key : State.PendingVoxels)
+        {
+            if (const int32* ClusterIndex = State.VoxelClusters.Find(Key))
+            {
+                Dissolve(State, *ClusterIndex, Dissolved);
+            }
+        }
+        TSet<uint64> Unique;
+        Unique.Append(Dissolved);
+        Unique.Append(State.PendingVoxels);
+        Candidates = Unique.Array();
+    }
+    State.PendingVoxels.Reset();
+    State.bFullRecluster = false;
+    State.MinDensity = MinDensity;
+
+    // Classify in parallel, then keep the dense voxels in candidate order.
+    TArray<const FHexademic6ResonanceField::FVoxel*> Found;
+    Found.SetNumUninitialized(Candidates.Num());
+    ParallelRange(Candidates.Num(), [&Voxels, &Candidates, &Found, MinDensity](int32 Begin, int32 End)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            const FHexademic6ResonanceField::FVoxel* Voxel = Voxels.Find(Candidates[Index]);
+            Found[Index] = Voxel && Voxel->Value >= MinDensity ? Voxel : nullptr;
+        }
+    });
+    TArray<uint64> Dense;
+    TArray<const FHexademic6ResonanceField::FVoxel*> DenseVoxels;
+    for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+    {
+        if (Found[Index])
+        {
+            Dense.Add(Candidates[Index]);
+            DenseVoxels.Add(Found[Index]);
+        }
+    }
+
+    // A re-clustered voxel next to an untouched hotspot joins it, so that hotspot is re-clustered
+    // too. Its own voxels are unchanged and cannot border any other hotspot.
+    if (!bFull)
+    {
+        TArray<uint64> Absorbed;
+        for (uint64 Key : Dense)
+        {
+            ForEachNeighbor(Key, [&State, &Absorbed](uint64 Neighbor)
+            {
+                if (const int32* ClusterIndex = State.VoxelClusters.Find(Neighbor))
+                {
+                    Dissolve(State, *ClusterIndex, Absorbed);
+                }
+            });
+        }
+        for (uint64 Key : Absorbed)
+        {
+            const FHexademic6ResonanceField::FVoxel* Voxel = Voxels.Find(Key);
+            if (Voxel && Voxel->Value >= MinDensity) // Only not if the field changed without CollectChanges
+            {
+                Dense.Add(Key);
+                DenseVoxels.Add(Voxel);
+            }
+        }
+    }
+
+    // Join dense neighbors in parallel.
+    const int32 NumDense = Dense.Num();
+    TMap<uint64, int32> DenseIndices;
+    DenseIndices.Reserve(NumDense);
+    for (int32 Index = 0; Index < NumDense; ++Index)
+    {
+        DenseIndices.Add(Dense[Index], Index);
+    }
+    TUniquePtr<std::atomic<int32>[]> Parents = MakeUnique<std::atomic<int32>[]>(NumDense);
+    for (int32 Index = 0; Index < NumDense; ++Index)
+    {
+        Parents[Index].store(Index, std::memory_order_relaxed);
+    }
+    ParallelRange(NumDense, [&Dense, &DenseIndices, &Parents](int32 Begin, int32 End)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            ForEachNeighbor(Dense[Index], [&DenseIndices, &Parents, Index](uint64 Neighbor)
+            {
+                const int32* NeighborIndex = DenseIndices.Find(Neighbor);
+                if (NeighborIndex && *NeighborIndex < Index) // Each edge once
+                {
+                    Union(Parents.Get(), Index, *NeighborIndex);
+                }
+            });
+        }
+    });
+    TArray<int32> Roots;
+    Roots.SetNumUninitialized(NumDense);
+    ParallelRange(NumDense, [&Parents, &Roots](int32 Begin, int32 End)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            Roots[Index] = FindRoot(Parents.Get(), Index);
+        }
+    });
+
+    // Build the hotspots in index order; a root precedes every other voxel of its component.
+    TArray<int32> RootClusters;
+    RootClusters.SetNumUninitialized(NumDense);
+    TArray<int32> NewClusters;
+    TArray<FClusterSums> Sums;
+    for (int32 Index = 0; Index < NumDense; ++Index)
+    {
+        const uint64 Key = Dense[Index];
+        const FHexademic6ResonanceField::FVoxel& Voxel = *DenseVoxels[Index];
+        int32 Local;
+        if (Roots[Index] == Index)
+        {
+            Local = NewClusters.Add(State.Clusters.Add(FCluster()));
+            FClusterSums& Added = Sums.AddDefaulted_GetRef();
+            FHexademic6ResonanceField::UnpackVoxelKey(Key, Added.RootCell);
+            State.Clusters[NewClusters[Local]].RootKey = Key;
+            RootClusters[Index] = Local;
+        }
+        else
+        {
+            Local = RootClusters[Roots[Index]];
+        }
+
+        FCluster& Cluster = State.Clusters[NewClusters[Local]];
+        Cluster.RootKey = FMath::Min(Cluster.RootKey, Key); // Union-find roots depend on candidate order; the smallest key does not
+        Cluster.Voxels.Add(Key);
+        State.VoxelClusters.Add(Key, NewClusters[Local]);
+
+        FClusterSums& ClusterSums = Sums[Local];
+        int32 Cell[6];
+        FHexademic6ResonanceField::UnpackVoxelKey(Key, Cell);
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            const int32 Offset = (((Cell[Axis] - ClusterSums.RootCell[Axis]) & 1023) ^ 512) - 512; // Shortest way round the wrap
+            ClusterSums.Offsets[Axis] += (double)Voxel.Value * Offset;
+        }
+        ClusterSums.Intensity += Voxel.Value;
+        Cluster.Hotspot.PeakDensity = FMath::Max(Cluster.Hotspot.PeakDensity, Voxel.Value);
+        Cluster.Hotspot.NumMembers += Voxel.NumMembers;
+        ++Cluster.Hotspot.NumVoxels;
+    }
+
+    const int32 VoxelSize = Field.GetVoxelSize(Order);
+    for (int32 Local = 0; Local < NewClusters.Num(); ++Local)
+    {
+        const FClusterSums& ClusterSums = Sums[Local];
+        int32 Centroid[6];
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            Centroid[Axis] = FMath::RoundToInt((ClusterSums.RootCell[Axis] + ClusterSums.Offsets[Axis] / ClusterSums.Intensity) * VoxelSize);
+        }
+        FHexademic6ResonanceHotspot& Hotspot = State.Clusters[NewClusters[Local]].Hotspot;
+        Hotspot.Centroid = FHexademic6DCoordinate(Centroid[0], Centroid[1], Centroid[2], Centroid[3], Centroid[4], Centroid[5], Order);
+        Hotspot.Intensity = (float)ClusterSums.Intensity;
+    }
+
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("HotspotDetector: Re-clustered %d of %d voxels of Order %d (%s); %d hotspots."),
+        NumDense, Voxels.Num(), (uint8)Order, bFull ? TEXT("full") : TEXT("incremental"), State.Clusters.Num());
+}
@@ -0,0 +1,360 @@
+// Hexademic6LatticeStore.cpp
+// Columnar per-order node storage, on-demand materialization and column-level passes.
+
+#include "Hexademic6LatticeStore.h"
+#include "HexademicSixLattice.h"
+#include "Serialization/MemoryReader.h"      // For FMemoryReaderView
+#include "Serialization/MemoryWriter.h"      // For FMemoryWriter
+#include "Serialization/StructuredArchive.h" // For FStructuredArchiveFromArchive
+#include "UObject/UnrealType.h"              // For FProperty, TFieldIterator
+
+namespace Hexademic6LatticeStorePrivate
+{
+    // Reflected FHexademicMemoryNode properties that have no column, in declaration order. Only
+    // these go into the cold payload, so nothing a column holds is stored twice, and fields added
+    // to the node later are kept without touching the store.
+    const TArray<const FProperty*>& GetColdProperties()
+    {
+        static const TArray<const FProperty*> ColdProperties = []()
+        {
+            static const FName ColumnProperties[] = {
+                TEXT("MemoryID"), TEXT("LatticePosition"), TEXT("ResonanceStrength"), TEXT("CognitiveWeight"),
+                TEXT("TemporalDecay"), TEXT("AccessCount"), TEXT("EmotionalValence"), TEXT("EmotionalIntensity"),
+                TEXT("MythicDepth"), TEXT("AssociatedArchetypes") };
+            TArray<const FProperty*> Properties;
+            for (TFieldIterator<FProperty> It(FHexademicMemoryNode::StaticStruct()); It; ++It)
+            {
+                if (!TConstArrayView<FName>(ColumnProperties).Contains(It->GetFName()))
+                {
+                    Properties.Add(*It);
+                }
+            }
+            return Properties;
+        }();
+        return ColdProperties;
+    }
+
+    // Serializes the cold properties of Memory the same way UStruct::SerializeBin does the whole node.
+    void WriteColdPayload(const FHexademicMemoryNode& Memory, TArray<uint8>& OutPayload)
+    {
+        OutPayload.Reset();
+        FMemoryWriter Writer(OutPayload);
+        FStructuredArchiveFromArchive Adapter(Writer);
+        FStructuredArchive::FStream Stream = Adapter.GetSlot().EnterStream();
+        for (const FProperty* Property : GetColdProperties())
+        {
+            Property->SerializeBinProperty(Stream.EnterElement(), const_cast<FHexademicMemoryNode*>(&Memory));
+        }
+    }
+
+    void ReadColdPayload(TConstArrayView<uint8> Payload, FHexademicMemoryNode& OutMemory)
+    {
+        FMemoryReaderView Reader(Payload);
+        FStructuredArchiveFromArchive Adapter(Reader);
+        FStructuredArchive::FStream Stream = Adapter.GetSlot().EnterStream();
+        for (const FProperty* Property : GetColdProperties())
+        {
+            Property->SerializeBinProperty(Stream.EnterElement(), &OutMemory);
+        }
+    }
+
+    // Coherence deltas applied before the aggregates are recomputed, at least; above this, one
+    // recompute per memory's worth of deltas.
+    constexpr int64 MinDeltasBeforeRecompute = 65536;
+
+    // Applies Func to every row-aligned column so row insertion, swap-removal and reset
+    // can never leave one column behind.
+    template<typename FuncType>
+    FORCEINLINE void ForEachColumn(FHexademic6OrderColumns& Columns, FuncType&& Func)
+    {
+        Func(Columns.ResonanceStrength);
+        Func(Columns.CognitiveWeight);
+        Func(Columns.TemporalDecay);
+        Func(Columns.AccessCount);
+        Func(Columns.EmotionalValence);
+        Func(Columns.EmotionalIntensity);
+        Func(Columns.MythicDepth);
+        Func(Columns.X);
+        Func(Columns.Y);
+        Func(Columns.Z);
+        Func(Columns.W);
+        Func(Columns.U);
+        Func(Columns.V);
+        Func(Columns.Archetypes);
+        Func(Columns.MemoryIDs);
+        Func(Columns.DUIDSLocations);
+        Func(Columns.ColdPayloads);
+        Func(Columns.RowToSlot);
+        Func(Columns.GridSlots);
+    }
+}
+
+FHexademic6LatticeStore::FHexademic6LatticeStore()
+{
+    for (int32 OrderIndex = 0; OrderIndex < FHexademic6OrderIndexing::NumOrders; ++OrderIndex)
+    {
+        Grids[OrderIndex] = FHexademic6SpatialIndex(FHexademic6SpatialIndex::GetDefaultCellSize(static_cast<ECognitiveLatticeOrder>(OrderIndex)));
+    }
+}
+
+FHexademicNodeHandle FHexademic6LatticeStore::AddOrUpdate(const FHexademicMemoryNode& Memory)
+{
+    const ECognitiveLatticeOrder Order = Memory.LatticePosition.LatticeOrder;
+    const uint8 OrderIndex = static_cast<uint8>(Order);
+
+    if (FHexademicNodeHandle* Existing = HandlesByMemory.Find(Memory.MemoryID))
+    {
+        const int32 ExistingRow = GetRow(*Existing);
+        if (Existing->Order == Order)
+        {
+            const float OldInfluence = GetInfluence(Order, ExistingRow);
+            WriteRow(Order, ExistingRow, Memory);
+            Coherence.Update(Order, OldInfluence, GetInfluence(Order, ExistingRow));
+            RecomputeCoherenceIfDrifting();
+            Grids[OrderIndex].Update(Columns[OrderIndex].GridSlots[ExistingRow], Memory.LatticePosition);
+            return *Existing;
+        }
+        // Order migration: drop the row from its old column set and re-insert below.
+        RemoveRow(Existing->Order, ExistingRow);
+        HandlesByMemory.Remove(Memory.MemoryID);
+    }
+
+    FHexademic6OrderColumns& OrderColumns = Columns[OrderIndex];
+    TArray<int32>& OrderSlotToRow = SlotToRow[OrderIndex];
+    const int32 Slot = FreeSlots[OrderIndex].Num() > 0 ? FreeSlots[OrderIndex].Pop(EAllowShrinking::No) : OrderSlotToRow.Add(INDEX_NONE);
+
+    const int32 Row = OrderColumns.Num();
+    Hexademic6LatticeStorePrivate::ForEachColumn(OrderColumns, [](auto& Column) { Column.AddDefaulted(); });
+    WriteRow(Order, Row, Memory);
+    Coherence.Add(Order, GetInfluence(Order, Row));
+    RecomputeCoherenceIfDrifting();
+    OrderColumns.RowToSlot[Row] = Slot;
+    OrderSlotToRow[Slot] = Row;
+
+    const int32 GridSlot = Grids[OrderIndex].Add(Memory.LatticePosition, Memory.MemoryID);
+    OrderColumns.GridSlots[Row] = GridSlot;
+    TArray<int32>& OrderGridSlotToSlot = GridSlotToSlot[OrderIndex];
+    if (GridSlot >= OrderGridSlotToSlot.Num())
+    {
+        OrderGridSlotToSlot.SetNum(GridSlot + 1);
+    }
+    OrderGridSlotToSlot[GridSlot] = Slot;
+
+    const FHexademicNodeHandle Handle(Order, Slot);
+    HandlesByMemory.Add(Memory.MemoryID, Handle);
+    return Handle;
+}
+
+bool FHexademic6LatticeStore::Remove(const FGuid& MemoryID)
+{
+    FHexademicNodeHandle Handle;
+    if (!HandlesByMemory.RemoveAndCopyValue(MemoryID, Handle))
+    {
+        return false;
+    }
+    RemoveRow(Handle.Order, GetRow(Handle));
+    RecomputeCoherenceIfDrifting();
+    return true;
+}
+
+void FHexademic6LatticeStore::Empty()
+{
+    for (int32 OrderIndex = 0; OrderIndex < FHexademic6OrderIndexing::NumOrders; ++OrderIndex)
+    {
+        Hexademic6LatticeStorePrivate::ForEachColumn(Columns[OrderIndex], [](auto& Column) { Column.Empty(); });
+        Grids[OrderIndex].Empty();
+        SlotToRow[OrderIndex].Empty();
+        FreeSlots[OrderIndex].Empty();
+        GridSlotToSlot[OrderIndex].Empty();
+    }
+    HandlesByMemory.Empty();
+    Coherence.Reset();
+}
+
+void FHexademic6LatticeStore::SetResonanceStrength(const FHexademicNodeHandle& Handle, float ResonanceStrength)
+{
+    check(IsValidHandle(Handle));
+    const int32 Row = GetRow(Handle);
+    const float OldInfluence = GetInfluence(Handle.Order, Row);
+    Columns[static_cast<uint8>(Handle.Order)].ResonanceStrength[Row] = ResonanceStrength;
+    Coherence.Update(Handle.Order, OldInfluence, GetInfluence(Handle.Order, Row));
+    RecomputeCoherenceIfDrifting();
+}
+
+void FHexademic6LatticeStore::RecomputeCoherence()
+{
+    Coherence.Recompute(*this);
+}
+
+void FHexademic6LatticeStore::RecomputeCoherenceIfDrifting()
+{
+    if (Coherence.GetNumDeltas() >= FMath::Max<int64>(Hexademic6LatticeStorePrivate::MinDeltasBeforeRecompute, NumTotal()))
+    {
+        RecomputeCoherence();
+    }
+}
+
+float FHexademic6LatticeStore::GetInfluence(ECognitiveLatticeOrder Order, int32 Row) const
+{
+    const FHexademic6OrderColumns& OrderColumns = GetColumns(Order);
+    return FHexademic6CoherenceAggregates::GetInfluence(OrderColumns.ResonanceStrength[Row], OrderColumns.CognitiveWeight[Row]);
+}
+
+FHexademicNodeHandle FHexademic6LatticeStore::FindHandle(const FGuid& MemoryID) const
+{
+    const FHexademicNodeHandle* Handle = HandlesByMemory.Find(MemoryID);
+    return Handle ? *Handle : FHexademicNodeHandle();
+}
+
+bool FHexademic6LatticeStore::IsValidHandle(const FHexademicNodeHandle& Handle) const
+{
+    const TArray<int32>& OrderSlotToRow = SlotToRow[static_cast<uint8>(Handle.Order)];
+    return OrderSlotToRow.IsValidIndex(Handle.Slot) && OrderSlotToRow[Handle.Slot] != INDEX_NONE;
+}
+
+int32 FHexademic6LatticeStore::NumTotal() const
+{
+    return HandlesByMemory.Num();
+}
+
+void FHexademic6LatticeStore::WriteRow(ECognitiveLatticeOrder Order, int32 Row, const FHexademicMemoryNode& Memory)
+{
+    FHexademic6OrderColumns& OrderColumns = Columns[static_cast<uint8>(Order)];
+    OrderColumns.ResonanceStrength[Row] = Memory.ResonanceStrength;
+    OrderColumns.CognitiveWeight[Row] = Memory.CognitiveWeight;
+    OrderColumns.TemporalDecay[Row] = Memory.TemporalDecay;
+    OrderColumns.AccessCount[Row] = Memory.AccessCount;
+    OrderColumns.EmotionalValence[Row] = Memory.EmotionalValence;
+    OrderColumns.EmotionalIntensity[Row] = Memory.EmotionalIntensity;
+    OrderColumns.MythicDepth[Row] = Memory.MythicDepth;
+    OrderColumns.X[Row] = Memory.LatticePosition.X;
+    OrderColumns.Y[Row] = Memory.LatticePosition.Y;
+    OrderColumns.Z[Row] = Memory.LatticePosition.Z;
+    OrderColumns.W[Row] = Memory.LatticePosition.W;
+    OrderColumns.U[Row] = Memory.LatticePosition.U;
+    OrderColumns.V[Row] = Memory.LatticePosition.V;
+    OrderColumns.Archetypes[Row] = FHexademic6OrderColumns::FArchetypeList(Memory.AssociatedArchetypes);
+    OrderColumns.MemoryIDs[Row] = Memory.MemoryID;
+    OrderColumns.DUIDSLocations[Row] = Memory.LatticePosition.DUIDSLocation;
+    Hexademic6LatticeStorePrivate::WriteColdPayload(Memory, OrderColumns.ColdPayloads[Row]);
+}
+
+void FHexademic6LatticeStore::RemoveRow(ECognitiveLatticeOrder Order, int32 Row)
+{
+    const uint8 OrderIndex = static_cast<uint8>(Order);
+    FHexademic6OrderColumns& OrderColumns = Columns[OrderIndex];
+
+    Coherence.Remove(Order, GetInfluence(Order, Row));
+    Grids[OrderIndex].Remove(OrderColumns.GridSlots[Row]);
+    const int32 Slot = OrderColumns.RowToSlot[Row];
+    SlotToRow[OrderIndex][Slot] = INDEX_NONE;
+    FreeSlots[OrderIndex].Add(Slot);
+
+    // Swap-remove keeps every column dense; patch the moved row's slot mapping.
+    const int32 LastRow = OrderColumns.Num() - 1;
+    Hexademic6LatticeStorePrivate::ForEachColumn(OrderColumns, [Row](auto& Column) { Column.RemoveAtSwap(Row, 1, EAllowShrinking::No); });
+    if (Row != LastRow)
+    {
+        SlotToRow[OrderIndex][OrderColumns.RowToSlot[Row]] = Row;
+    }
+}
+
+void FHexademic6LatticeStore::CopyScratch(ECognitiveLatticeOrder Order, int32 Row, FHexademicMemoryNode& Scratch) const
+{
+    const FHexademic6OrderColumns& OrderColumns = GetColumns(Order);
+    Scratch.ResonanceStrength = OrderColumns.ResonanceStrength[Row];
+    Scratch.CognitiveWeight = OrderColumns.CognitiveWeight[Row];
+    Scratch.TemporalDecay = OrderColumns.TemporalDecay[Row];
+    Scratch.AccessCount = OrderColumns.AccessCount[Row];
+    Scratch.EmotionalValence = OrderColumns.EmotionalValence[Row];
+    Scratch.EmotionalIntensity = OrderColumns.EmotionalIntensity[Row];
+    Scratch.MythicDepth = OrderColumns.MythicDepth[Row];
+    Scratch.LatticePosition = OrderColumns.GetPosition(Row, Order);
+}
+
+void FHexademic6LatticeStore::MaterializeRow(ECognitiveLatticeOrder Order, int32 Row, FHexademicMemoryNode& OutMemory) const
+{
+    const FHexademic6OrderColumns& OrderColumns = GetColumns(Order);
+    OutMemory = FHexademicMemoryNode();
+    Hexademic6LatticeStorePrivate::ReadColdPayload(OrderColumns.ColdPayloads[Row], OutMemory);
+    OutMemory.MemoryID = OrderColumns.MemoryIDs[Row];
+    CopyScratch(Order, Row, OutMemory);
+    OutMemory.AssociatedArchetypes = TArray<uint32>(OrderColumns.Archetypes[Row]);
+}
+
+bool FHexademic6LatticeStore::Materialize(const FHexademicNodeHandle& Handle, FHexademicMemoryNode& OutMemory) const
+{
+    if (!IsValidHandle(Handle))
+    {
+        return false;
+    }
+    MaterializeRow(Handle.Order, GetRow(Handle), OutMemory);
+    return true;
+}
+
+TOptional<FHexademicMemoryNode> FHexademic6LatticeStore::GetMemory(const FGuid& MemoryID) const
+{
+    const FHexademicNodeHandle* Handle = HandlesByMemory.Find(MemoryID);
+    if (!Handle)
+    {
+        return TOptional<FHexademicMemoryNode>();
+    }
+    FHexademicMemoryNode Memory;
+    MaterializeRow(Handle->Order, GetRow(*Handle), Memory);
+    return Memory;
+}
+
+TArray<FHexademicMemoryNode> FHexademic6LatticeStore::GetMemoriesInOrder(ECognitiveLatticeOrder Order) const
+{
+    const int32 NumRows = Num(Order);
+    TArray<FHexademicMemoryNode> Memories;
+    Memories.SetNum(NumRows);
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        MaterializeRow(Order, Row, Memories[Row]);
+    }
+    return Memories;
+}
+
+void FHexademic6LatticeStore::QueryRadius(const FHexademic6DCoordinate& Center, float Radius, TArray<FHexademicNodeHandle>& OutHandles) const
+{
+    const uint8 OrderIndex = static_cast<uint8>(Center.LatticeOrder);
+    TArray<int32> GridResults;
+    Grids[OrderIndex].QueryRadius(Center, Radius, GridResults);
+    OutHandles.Reserve(OutHandles.Num() + GridResults.Num());
+    for (int32 GridSlot : GridResults)
+    {
+        OutHandles.Emplace(Center.LatticeOrder, GridSlotToSlot[OrderIndex][GridSlot]);
+    }
+}
+
+void FHexademic6LatticeStore::QueryKNearest(const FHexademic6DCoordinate& Center, int32 K, TArray<FHexademicNodeHandle>& OutHandles, const FGuid& ExcludeID) const
+{
+    const uint8 OrderIndex = static_cast<uint8>(Center.LatticeOrder);
+    TArray<int32> GridResults;
+    Grids[OrderIndex].QueryKNearest(Center, K, GridResults, ExcludeID);
+    OutHandles.Reset(GridResults.Num());
+    for (int32 GridSlot : GridResults)
+    {
+        OutHandles.Emplace(Center.LatticeOrder, GridSlotToSlot[OrderIndex][GridSlot]);
+    }
+}
+
+void FHexademic6LatticeStore::EvaluateOptimalOrders(ECognitiveLatticeOrder Order, int32 FirstRow, int32 NumRows, TArray<TPair<FHexademicNodeHandle, ECognitiveLatticeOrder>>& OutMoves) const
+{
+    // Row by row rather than column-wise: the promotion and decay predicates are the node's own
+    // ShouldPromoteToHigherOrder and ShouldDecayToLowerOrder, and restating their thresholds here
+    // over raw columns would let the two drift apart. CopyScratch touches only the hot columns,
+    // which are contiguous per order, so the batch still streams through them.
+    const int32 EndRow = FMath::Min(Num(Order), FirstRow + NumRows);
+    FHexademicMemoryNode Scratch;
+    for (int32 Row = FMath::Max(0, FirstRow); Row < EndRow; ++Row)
+    {
+        CopyScratch(Order, Row, Scratch);
+        const ECognitiveLatticeOrder TargetOrder = Scratch.DetermineOptimalOrder();
+        if (TargetOrder != Order)
+        {
+            OutMoves.Emplace(GetHandle(Order, Row), TargetOrder);
+        }
+    }
+}
@@ -0,0 +1,202 @@
+// Hexademic6MigrationEngine.cpp
+// Sweep, queue and budgeted application of lattice order migrations.
+
+#include "Hexademic6MigrationEngine.h"
+#include "Hexademic6FrameBudget.h"   // For FHexademic6FrameBudget
+#include "Hexademic6LatticeStore.h"  // For FHexademic6LatticeStore
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::NumOrders
+#include "Hexademic6PackedKey.h"     // For FHexademic6PackedKey
+#include "HAL/IConsoleManager.h"     // For TAutoConsoleVariable
+#include "Logging/LogMacros.h"       // For UE_LOG
+#include "Misc/ScopeExit.h"          // For ON_SCOPE_EXIT
+
+static TAutoConsoleVariable<float> CVarHexademicMigrationFrameBudgetMicroseconds(
+    TEXT("Hexademic.Migration.FrameBudgetMicroseconds"),
+    500.0f,
+    TEXT("Time a migration engine tick may spend evaluating and moving nodes between lattice orders."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicMigrationBatchRows(
+    TEXT("Hexademic.Migration.BatchRows"),
+    256,
+    TEXT("Rows evaluated per migration batch; the unit in which evaluation is fitted into the frame budget."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicMigrationMaxQueuedMoves(
+    TEXT("Hexademic.Migration.MaxQueuedMoves"),
+    8192,
+    TEXT("Queued migrations above which evaluation pauses until moves catch up."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarHexademicMigrationSweepIntervalSeconds(
+    TEXT("Hexademic.Migration.SweepIntervalSeconds"),
+    1.0f,
+    TEXT("Minimum time between the starts of two sweeps over the lattice store."),
+    ECVF_Default);
+
+namespace Hexademic6MigrationEnginePrivate
+{
+    // Starting cost estimates, in microseconds, until the first measurements come in.
+    constexpr double InitialMoveCost = 50.0;
+    constexpr double InitialBatchCost = 100.0;
+}
+
+FHexademic6MigrationEngine::FHexademic6MigrationEngine(FHexademic6LatticeStore& InStore, FDUIDSOrchestrator* InOrchestrator)
+    : Store(InStore)
+    , Orchestrator(InOrchestrator)
+    , MoveCost(Hexademic6MigrationEnginePrivate::InitialMoveCost)
+    , BatchCost(Hexademic6MigrationEnginePrivate::InitialBatchCost)
+{
+}
+
+void FHexademic6MigrationEngine::Reset()
+{
+    Queue.Reset();
+    QueueHead = 0;
+    QueuedIDs.Reset();
+    CursorOrder = 0;
+    CursorRow = 0;
+    NextSweepTime = 0.0;
+}
+
+FHexademic6MigrationStats FHexademic6MigrationEngine::GetStats() const
+{
+    FHexademic6MigrationStats Result = Stats;
+    Result.Pending = NumPending();
+    return Result;
+}
+
+// =============================================================================
+// TICK
+// =============================================================================
+
+void FHexademic6MigrationEngine::Tick(double BudgetMicroseconds)
+{
+    FHexademic6FrameBudget Frame(BudgetMicroseconds >= 0.0 ? BudgetMicroseconds : (double)CVarHexademicMigrationFrameBudgetMicroseconds.GetValueOnAnyThread());
+
+    // A snapshot started by a move would copy every shard inside this tick, so the orchestrator
+    // holds them back until the tick is over.
+    if (Orchestrator)
+    {
+        Orchestrator->DeferSnapshots();
+    }
+    ON_SCOPE_EXIT
+    {
+        if (Orchestrator)
+        {
+            Orchestrator->ResumeSnapshots();
+        }
+    };
+
+    // Queued moves go first: evaluation only exists to feed them.
+    while (NumPending() > 0 && Frame.Fits(MoveCost))
+    {
+        const FPendingMove Move = Queue[QueueHead++];
+        QueuedIDs.Remove(Move.MemoryID);
+        ApplyMove(Move);
+        Frame.EndUnit(MoveCost);
+    }
+    const double StalledMoveCost = MoveCost.Get();
+    if (Frame.RelaxIfStalled(MoveCost, NumPending() > 0) && !bWarnedMoveBudget)
+    {
+        UE_LOG(LogHexademicLattice, Warning, TEXT("Migration: a move costs about %.0f us, more than the %.0f us tick budget; moves continue every few ticks, each overrunning the budget."), StalledMoveCost, Frame.GetBudget());
+        bWarnedMoveBudget = true;
+    }
+    if (QueueHead > 0 && QueueHead * 2 >= Queue.Num())
+    {
+        Queue.RemoveAt(0, QueueHead, EAllowShrinking::No);
+        QueueHead = 0;
+    }
+
+    const int32 MaxQueued = CVarHexademicMigrationMaxQueuedMoves.GetValueOnAnyThread();
+    const auto CanEvaluate = [this, &Frame, MaxQueued]() { return Frame.GetNow() >= NextSweepTime && NumPending() < MaxQueued; };
+    while (CanEvaluate() && Frame.Fits(BatchCost))
+    {
+        const bool bSweepContinues = EvaluateNextBatch();
+        Frame.EndUnit(BatchCost);
+        if (!bSweepContinues)
+        {
+            NextSweepTime = Frame.GetNow() + CVarHexademicMigrationSweepIntervalSeconds.GetValueOnAnyThread();
+        }
+    }
+    Frame.RelaxIfStalled(BatchCost, CanEvaluate());
+}
+
+// =============================================================================
+// EVALUATION AND MOVES
+// =============================================================================
+
+bool FHexademic6MigrationEngine::EvaluateNextBatch()
+{
+    const ECognitiveLatticeOrder Order = static_cast<ECognitiveLatticeOrder>(CursorOrder);
+    const int32 NumRows = FMath::Max(CVarHexademicMigrationBatchRows.GetValueOnAnyThread(), 1);
+    BatchMoves.Reset();
+    Store.EvaluateOptimalOrders(Order, CursorRow, NumRows, BatchMoves);
+    Stats.Evaluated += FMath::Clamp(Store.Num(Order) - CursorRow, 0, NumRows);
+
+    const FHexademic6OrderColumns& Columns = Store.GetColumns(Order);
+    for (const TPair<FHexademicNodeHandle, ECognitiveLatticeOrder>& Move : BatchMoves)
+    {
+        const FGuid& MemoryID = Columns.MemoryIDs[Store.GetRow(Move.Key)];
+        bool bAlreadyQueued;
+        QueuedIDs.Add(MemoryID, &bAlreadyQueued);
+        if (!bAlreadyQueued)
+        {
+            Queue.Add({ MemoryID, Order });
+            ++Stats.Queued;
+        }
+    }
+
+    CursorRow += NumRows;
+    if (CursorRow < Store.Num(Order))
+    {
+        return true;
+    }
+    CursorRow = 0;
+    if (++CursorOrder < FHexademic6OrderIndexing::NumOrders)
+    {
+        return true;
+    }
+    CursorOrder = 0;
+    ++Stats.Sweeps;
+    return false;
+}
+
+void FHexademic6MigrationEngine::ApplyMove(const FPendingMove& Move)
+{
+    // The node may have changed or moved since it was queued, so the decision is taken again
+    // on its current state.
+    const FHexademicNodeHandle Handle = Store.FindHandle(Move.MemoryID);
+    if (!Handle.IsValid() || Handle.Order != Move.SourceOrder || !Store.Materialize(Handle, MoveScratch))
+    {
+        ++Stats.Dropped;
+        return;
+    }
+    FHexademicMemoryNode& Memory = MoveScratch;
+    const ECognitiveLatticeOrder TargetOrder = Memory.DetermineOptimalOrder();
+    if (TargetOrder == Move.SourceOrder)
+    {
+        ++Stats.Dropped;
+        return;
+    }
+
+    const FDUIDSIndex PreviousIndex = Memory.QuickAccessIndex;
+    Memory.LatticePosition = Memory.LatticePosition.ProjectToOrder(TargetOrder);
+    if (Orchestrator)
+    {
+        Memory.QuickAccessIndex = Orchestrator->GenerateIndex(Memory);
+        Orchestrator->RelocateRecord(PreviousIndex, Memory);
+    }
+    Store.AddOrUpdate(Memory);
+
+    if ((uint8)TargetOrder > (uint8)Move.SourceOrder)
+    {
+        ++Stats.Promoted;
+    }
+    else
+    {
+        ++Stats.Demoted;
+    }
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Migrated Memory %s from Order %d to Order %d. New DUIDS: %s"),
+        *Move.MemoryID.ToString(), (uint8)Move.SourceOrder, (uint8)TargetOrder, *FHexademic6PackedKey(Memory.QuickAccessIndex).ToHexString());
+}
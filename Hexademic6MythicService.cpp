@@ -3,6 +3,7 @@
 
 #include "HexademicSixLattice.h" // Includes the main header with interfaces and structs
 #include "Hexademic6Types.h"     // For FVector6 (if used directly in mythic logic)
+#include "Hexademic6LatticeStore.h" // For FHexademic6OrderColumns
 #include "Logging/LogMacros.h"   // For UE_LOG
 #include "Containers/Map.h"      // For TMap
 #include "Containers/Array.h"    // For TArray
@@ -29,7 +30,7 @@ public:
     virtual void ProcessMythicEmergence(const TArray<FHexademicMemoryNode>& DeepMemories) override
     {
         // Placeholder: Implement advanced pattern recognition to detect overarching mythic themes
-        // and narratives from highly integrated, deep-seated memories (e.g., Order144).
+        // and narratives from highly integrated, deep-seated memories (e.g., Order192).
         UE_LOG(LogHexademicLattice, Log, TEXT("MythicService: Processing mythic emergence from %d deep memories."), DeepMemories.Num());
         
         // Example: Check if certain memory combinations or emotional signatures indicate an emergent myth.
@@ -41,7 +42,18 @@ public:
         }
     }
 
-    virtual TArray<FString> ExtractNarrativeThreads(ECognitiveLatticeOrder MinOrder = ECognitiveLatticeOrder::Order72) override
+    virtual void ProcessMythicEmergence(const FHexademic6OrderColumns& DeepMemories) override
+    {
+        // Column-wise variant of the above, for callers that hold the lattice store: the same
+        // emergence check without materializing the deep order's nodes.
+        UE_LOG(LogHexademicLattice, Log, TEXT("MythicService: Processing mythic emergence from %d deep memories."), DeepMemories.Num());
+        if (DeepMemories.Num() > 10) // Arbitrary condition for emergence
+        {
+            UE_LOG(LogHexademicLattice, Display, TEXT("MythicService: A new mythic thread appears to be emerging!"));
+        }
+    }
+
+    virtual TArray<FString> ExtractNarrativeThreads(ECognitiveLatticeOrder MinOrder = ECognitiveLatticeOrder::Order96) override
     {
         // Placeholder: Extracts coherent narrative sequences or "stories" from the interconnected memories.
         // This is a complex task involving natural language generation or symbolic interpretation.
@@ -0,0 +1,272 @@
+// Hexademic6NodeCache.cpp
+// W-TinyLFU admission, segmented LRU maintenance and byte accounting for the node cache.
+
+#include "Hexademic6NodeCache.h"
+
+namespace Hexademic6NodeCachePrivate
+{
+    // Small on purpose: the sketch only has to rank candidates against victims.
+    constexpr int32 FrequencySketchWidth = 2048;
+}
+
+FHexademic6NodeCache::FHexademic6NodeCache(int64 InBudgetBytes)
+    : BudgetBytes(FMath::Max<int64>(InBudgetBytes, 0))
+    , Frequency(Hexademic6NodeCachePrivate::FrequencySketchWidth)
+    , SamplePeriod(10 * Hexademic6NodeCachePrivate::FrequencySketchWidth)
+{
+}
+
+void FHexademic6NodeCache::SetBudget(int64 InBudgetBytes)
+{
+    BudgetBytes = FMath::Max<int64>(InBudgetBytes, 0);
+    Rebalance();
+}
+
+// =============================================================================
+// LOOKUP AND INSERTION
+// =============================================================================
+
+int32 FHexademic6NodeCache::FindEntry(const FDUIDSIndex& Key)
+{
+    const int32* EntryIndex = Lookup.Find(Key);
+    return EntryIndex ? *EntryIndex : INDEX_NONE;
+}
+
+void FHexademic6NodeCache::RecordFrequency(const FDUIDSIndex& Key)
+{
+    Frequency.Add(Key);
+    if (++SampleCount >= SamplePeriod)
+    {
+        Frequency.Halve();
+        SampleCount /= 2;
+    }
+}
+
+bool FHexademic6NodeCache::FindNode(const FDUIDSIndex& Key, FHexademicMemoryNode& OutNode)
+{
+    RecordFrequency(Key);
+    const int32 EntryIndex = FindEntry(Key);
+    if (EntryIndex == INDEX_NONE || !Entries[EntryIndex].Node.IsSet())
+    {
+        ++Stats.Misses;
+        return false;
+    }
+    ++Stats.Hits;
+    OutNode = Entries[EntryIndex].Node.GetValue();
+    OnHit(EntryIndex);
+    return true;
+}
+
+bool FHexademic6NodeCache::FindSlices(const FDUIDSIndex& Key, FHexademic6CachedSlices& OutSlices)
+{
+    RecordFrequency(Key);
+    const int32 EntryIndex = FindEntry(Key);
+    if (EntryIndex == INDEX_NONE)
+    {
+        ++Stats.Misses;
+        return false;
+    }
+    ++Stats.Hits;
+    OutSlices = Entries[EntryIndex].Slices;
+    OnHit(EntryIndex);
+    return true;
+}
+
+int32 FHexademic6NodeCache::AddEntry(const FDUIDSIndex& Key)
+{
+    const int32 EntryIndex = FreeEntries.Num() > 0 ? FreeEntries.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+    FEntry& Entry = Entries[EntryIndex];
+    Entry.Key = Key;
+    Entry.Charge = sizeof(FEntry) + sizeof(TPair<FDUIDSIndex, int32>);
+    Lookup.Add(Key, EntryIndex);
+    Link(EntryIndex, ESegment::Window);
+    return EntryIndex;
+}
+
+void FHexademic6NodeCache::AddNode(const FDUIDSIndex& Key, const FHexademicMemoryNode& Node, int64 PayloadBytes)
+{
+    int32 EntryIndex = FindEntry(Key);
+    if (EntryIndex == INDEX_NONE)
+    {
+        EntryIndex = AddEntry(Key);
+    }
+    FEntry& Entry = Entries[EntryIndex];
+    Entry.Node = Node;
+    Entry.Slices.ResonanceStrength = Node.ResonanceStrength;
+    Entry.Slices.EmotionalSignature = FVector(Node.EmotionalValence, Node.EmotionalIntensity, Node.MythicDepth);
+    Recharge(EntryIndex, sizeof(FEntry) + sizeof(TPair<FDUIDSIndex, int32>) + FMath::Max<int64>(PayloadBytes, 0));
+    Rebalance();
+}
+
+void FHexademic6NodeCache::AddSlices(const FDUIDSIndex& Key, const FHexademic6CachedSlices& Slices)
+{
+    int32 EntryIndex = FindEntry(Key);
+    if (EntryIndex == INDEX_NONE)
+    {
+        EntryIndex = AddEntry(Key);
+    }
+    Entries[EntryIndex].Slices = Slices;
+    Rebalance();
+}
+
+void FHexademic6NodeCache::Invalidate(const FDUIDSIndex& Key)
+{
+    const int32 EntryIndex = FindEntry(Key);
+    if (EntryIndex != INDEX_NONE)
+    {
+        Remove(EntryIndex);
+        ++Stats.Invalidations;
+    }
+}
+
+void FHexademic6NodeCache::Empty()
+{
+    Entries.Reset();
+    FreeEntries.Reset();
+    Lookup.Reset();
+    for (FList& List : Lists)
+    {
+        List = FList();
+    }
+}
+
+FHexademic6CacheStats FHexademic6NodeCache::GetStats() const
+{
+    FHexademic6CacheStats Result = Stats;
+    Result.Entries = Lookup.Num();
+    Result.Bytes = 0;
+    for (const FList& List : Lists)
+    {
+        Result.Bytes += List.Bytes;
+    }
+    return Result;
+}
+
+// =============================================================================
+// SEGMENTS
+// =============================================================================
+
+void FHexademic6NodeCache::Link(int32 EntryIndex, ESegment Segment)
+{
+    FEntry& Entry = Entries[EntryIndex];
+    FList& List = GetList(Segment);
+    Entry.Segment = Segment;
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = List.Head;
+    if (List.Head != INDEX_NONE)
+    {
+        Entries[List.Head].Prev = EntryIndex;
+    }
+    else
+    {
+        List.Tail = EntryIndex;
+    }
+    List.Head = EntryIndex;
+    List.Bytes += Entry.Charge;
+}
+
+void FHexademic6NodeCache::Unlink(int32 EntryIndex)
+{
+    FEntry& Entry = Entries[EntryIndex];
+    FList& List = GetList(Entry.Segment);
+    (Entry.Prev != INDEX_NONE ? Entries[Entry.Prev].Next : List.Head) = Entry.Next;
+    (Entry.Next != INDEX_NONE ? Entries[Entry.Next].Prev : List.Tail) = Entry.Prev;
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = INDEX_NONE;
+    List.Bytes -= Entry.Charge;
+}
+
+void FHexademic6NodeCache::Remove(int32 EntryIndex)
+{
+    Unlink(EntryIndex);
+    Discard(EntryIndex);
+}
+
+void FHexademic6NodeCache::Discard(int32 EntryIndex)
+{
+    FEntry& Entry = Entries[EntryIndex];
+    Lookup.Remove(Entry.Key);
+    Entry.Node.Reset();
+    Entry.Charge = 0;
+    FreeEntries.Add(EntryIndex);
+}
+
+void FHexademic6NodeCache::Recharge(int32 EntryIndex, int64 Charge)
+{
+    FEntry& Entry = Entries[EntryIndex];
+    GetList(Entry.Segment).Bytes += Charge - Entry.Charge;
+    Entry.Charge = Charge;
+}
+
+void FHexademic6NodeCache::OnHit(int32 EntryIndex)
+{
+    // Window and protected hits refresh recency; a probation hit earns promotion.
+    const ESegment Segment = Entries[EntryIndex].Segment;
+    Unlink(EntryIndex);
+    Link(EntryIndex, Segment == ESegment::Window ? ESegment::Window : ESegment::Protected);
+    if (Segment == ESegment::Probation)
+    {
+        Rebalance();
+    }
+}
+
+void FHexademic6NodeCache::Rebalance()
+{
+    FList& Window = GetList(ESegment::Window);
+    while (Window.Bytes > GetWindowBudget() && Window.Tail != INDEX_NONE)
+    {
+        const int32 Candidate = Window.Tail;
+        Unlink(Candidate);
+        Admit(Candidate);
+    }
+
+    FList& Protected = GetList(ESegment::Protected);
+    while (Protected.Bytes > GetProtectedBudget() && Protected.Tail != INDEX_NONE)
+    {
+        const int32 Demoted = Protected.Tail;
+        Unlink(Demoted);
+        Link(Demoted, ESegment::Probation);
+    }
+
+    // Only needed after the budget shrank; admission keeps the main cache within budget.
+    FList& Probation = GetList(ESegment::Probation);
+    while (Probation.Bytes + Protected.Bytes > GetMainBudget() && (Probation.Tail != INDEX_NONE || Protected.Tail != INDEX_NONE))
+    {
+        Remove(Probation.Tail != INDEX_NONE ? Probation.Tail : Protected.Tail);
+        ++Stats.Evictions;
+    }
+}
+
+void FHexademic6NodeCache::Admit(int32 CandidateIndex)
+{
+    // The candidate is unlinked. It enters probation if there is room, or if it is accessed
+    // more often than every victim that has to make room for it.
+    const int64 Charge = Entries[CandidateIndex].Charge;
+    FList& Probation = GetList(ESegment::Probation);
+    FList& Protected = GetList(ESegment::Protected);
+    if (Charge > GetMainBudget())
+    {
+        Discard(CandidateIndex);
+        ++Stats.Evictions;
+        return;
+    }
+
+    const uint32 CandidateFrequency = Frequency.Estimate(Entries[CandidateIndex].Key);
+    while (Probation.Bytes + Protected.Bytes + Charge > GetMainBudget())
+    {
+        const int32 Victim = Probation.Tail != INDEX_NONE ? Probation.Tail : Protected.Tail;
+        if (CandidateFrequency > Frequency.Estimate(Entries[Victim].Key))
+        {
+            Remove(Victim);
+            ++Stats.Evictions;
+        }
+        else
+        {
+            Discard(CandidateIndex);
+            ++Stats.Evictions;
+            ++Stats.Rejections;
+            return;
+        }
+    }
+    Link(CandidateIndex, ESegment::Probation);
+}
@@ -0,0 +1,145 @@
+// Hexademic6OrderIndexing.cpp
+// Batch and projection paths of the compile-time specialized order indexing layer.
+
+#include "Hexademic6OrderIndexing.h"
+#include "HexademicSixLattice.h"
+#include "Logging/LogMacros.h" // For UE_LOG
+
+namespace Hexademic6OrderIndexingPrivate
+{
+    // Computes RoundToInt(Value * Numerator / Denominator) exactly in 64-bit integers.
+    FORCEINLINE int32 ScaleAndRound(int32 Value, int64 Numerator, int64 Denominator)
+    {
+        const int64 Scaled = 2 * static_cast<int64>(Value) * Numerator + Denominator;
+        const int64 Divisor = 2 * Denominator;
+        const int64 Floored = Scaled >= 0 ? Scaled / Divisor : -((-Scaled + Divisor - 1) / Divisor);
+        return static_cast<int32>(Floored);
+    }
+
+    template<int64 Numerator, int64 Denominator>
+    FORCEINLINE void ProjectAxes(const FHexademic6DCoordinate& Coord, FHexademic6DCoordinate& OutCoord)
+    {
+        if constexpr (Numerator == Denominator)
+        {
+            OutCoord.X = Coord.X; OutCoord.Y = Coord.Y; OutCoord.Z = Coord.Z;
+            OutCoord.W = Coord.W; OutCoord.U = Coord.U; OutCoord.V = Coord.V;
+        }
+        else
+        {
+            OutCoord.X = ScaleAndRound(Coord.X, Numerator, Denominator);
+            OutCoord.Y = ScaleAndRound(Coord.Y, Numerator, Denominator);
+            OutCoord.Z = ScaleAndRound(Coord.Z, Numerator, Denominator);
+            OutCoord.W = ScaleAndRound(Coord.W, Numerator, Denominator);
+            OutCoord.U = ScaleAndRound(Coord.U, Numerator, Denominator);
+            OutCoord.V = ScaleAndRound(Coord.V, Numerator, Denominator);
+        }
+    }
+
+    // Resolves both orders once, then runs Func with a projector specialized for the pair.
+    template<typename FuncType>
+    FORCEINLINE void DispatchProjection(ECognitiveLatticeOrder SourceOrder, ECognitiveLatticeOrder TargetOrder, FuncType&& Func)
+    {
+        FHexademic6OrderIndexing::Dispatch(SourceOrder, [TargetOrder, &Func](auto SourceTraits)
+        {
+            FHexademic6OrderIndexing::Dispatch(TargetOrder, [&Func](auto TargetTraits)
+            {
+                constexpr int64 SourceExtent = decltype(SourceTraits)::Extent;
+                constexpr int64 TargetExtent = decltype(TargetTraits)::Extent;
+                Func([](const FHexademic6DCoordinate& Coord, FHexademic6DCoordinate& OutCoord)
+                {
+                    ProjectAxes<TargetExtent, SourceExtent>(Coord, OutCoord);
+                });
+            });
+        });
+    }
+}
+
+void FHexademic6OrderIndexing::ProjectToOrder(const FHexademic6DCoordinate& Coord, ECognitiveLatticeOrder SourceOrder, ECognitiveLatticeOrder TargetOrder, FHexademic6DCoordinate& OutCoord)
+{
+    OutCoord = Coord;
+    OutCoord.LatticeOrder = TargetOrder;
+    Hexademic6OrderIndexingPrivate::DispatchProjection(SourceOrder, TargetOrder, [&Coord, &OutCoord](auto Project)
+    {
+        Project(Coord, OutCoord);
+    });
+}
+
+void FHexademic6OrderIndexing::ToLinearIndices(TConstArrayView<FHexademic6DCoordinate> Coords, ECognitiveLatticeOrder Order, TArrayView<uint64> OutIndices)
+{
+    check(OutIndices.Num() >= Coords.Num());
+    Dispatch(Order, [Coords, OutIndices](auto Traits)
+    {
+        // Straight-line integer arithmetic with constant strides: the compiler is free to
+        // unroll and vectorize this loop for the specialized order.
+        const FHexademic6DCoordinate* RESTRICT Src = Coords.GetData();
+        uint64* RESTRICT Dst = OutIndices.GetData();
+        const int32 Num = Coords.Num();
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Dst[i] = decltype(Traits)::ToLinearIndex(Src[i]);
+        }
+    });
+}
+
+void FHexademic6OrderIndexing::FromLinearIndices(TConstArrayView<uint64> Indices, ECognitiveLatticeOrder Order, TArrayView<FHexademic6DCoordinate> OutCoords, bool bUpdateDUIDS)
+{
+    check(OutCoords.Num() >= Indices.Num());
+    Dispatch(Order, [Indices, OutCoords](auto Traits)
+    {
+        const uint64* RESTRICT Src = Indices.GetData();
+        FHexademic6DCoordinate* RESTRICT Dst = OutCoords.GetData();
+        const int32 Num = Indices.Num();
+        for (int32 i = 0; i < Num; ++i)
+        {
+            decltype(Traits)::FromLinearIndex(Src[i], Dst[i]);
+        }
+    });
+
+    if (bUpdateDUIDS)
+    {
+        for (int32 i = 0; i < Indices.Num(); ++i)
+        {
+            OutCoords[i].UpdateDUIDSIndex();
+        }
+    }
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Converted %d linear indices to 6D coordinates for Order %d."), Indices.Num(), (uint8)Order);
+}
+
+int32 FHexademic6OrderIndexing::ValidateForOrder(TConstArrayView<FHexademic6DCoordinate> Coords, ECognitiveLatticeOrder Order, TArrayView<bool> OutValid)
+{
+    check(OutValid.Num() >= Coords.Num());
+    return Dispatch(Order, [Coords, OutValid](auto Traits)
+    {
+        int32 NumValid = 0;
+        for (int32 i = 0; i < Coords.Num(); ++i)
+        {
+            const bool bValid = decltype(Traits)::IsValid(Coords[i]);
+            OutValid[i] = bValid;
+            NumValid += bValid ? 1 : 0;
+        }
+        return NumValid;
+    });
+}
+
+void FHexademic6OrderIndexing::ProjectToOrder(TConstArrayView<FHexademic6DCoordinate> Coords, ECognitiveLatticeOrder SourceOrder, ECognitiveLatticeOrder TargetOrder, TArrayView<FHexademic6DCoordinate> OutCoords, bool bUpdateDUIDS)
+{
+    check(OutCoords.Num() >= Coords.Num());
+    Hexademic6OrderIndexingPrivate::DispatchProjection(SourceOrder, TargetOrder, [Coords, OutCoords, TargetOrder](auto Project)
+    {
+        for (int32 i = 0; i < Coords.Num(); ++i)
+        {
+            OutCoords[i] = Coords[i];
+            OutCoords[i].LatticeOrder = TargetOrder;
+            Project(Coords[i], OutCoords[i]);
+        }
+    });
+
+    if (bUpdateDUIDS)
+    {
+        for (int32 i = 0; i < Coords.Num(); ++i)
+        {
+            OutCoords[i].UpdateDUIDSIndex();
+        }
+    }
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Projected %d coordinates from Order %d to Order %d."), Coords.Num(), (uint8)SourceOrder, (uint8)TargetOrder);
+}
@@ -0,0 +1,143 @@
+// Hexademic6RecordArena.cpp
+// Slab acquisition, reservation/commit, recycling and compaction.
+
+#include "Hexademic6RecordArena.h"
+
+FHexademic6RecordArena::FHexademic6RecordArena(int32 InSlabSize)
+    : SlabSize(FMath::Max(InSlabSize, 4096))
+{
+}
+
+int32 FHexademic6RecordArena::AcquireSlab(int32 MinCapacity)
+{
+    // Recycled slabs keep their buffer; only standard-size slabs are recycled.
+    if (MinCapacity <= SlabSize && FreeSlabs.Num() > 0)
+    {
+        return FreeSlabs.Pop(EAllowShrinking::No);
+    }
+    const int32 Capacity = FMath::Max(MinCapacity, SlabSize);
+    const int32 SlabIndex = Slabs.AddDefaulted();
+    FSlab& Slab = Slabs[SlabIndex];
+    Slab.Data = MakeUnique<uint8[]>(Capacity);
+    Slab.Capacity = Capacity;
+    AllocatedBytes += Capacity;
+    return SlabIndex;
+}
+
+uint8* FHexademic6RecordArena::Reserve(int32 MaxSize)
+{
+    check(PendingSlab == INDEX_NONE);
+    check(MaxSize > 0);
+    if (MaxSize > SlabSize)
+    {
+        PendingSlab = AcquireSlab(MaxSize);
+    }
+    else
+    {
+        if (CurrentSlab == INDEX_NONE || Slabs[CurrentSlab].Capacity - Slabs[CurrentSlab].Used < MaxSize)
+        {
+            CurrentSlab = AcquireSlab(MaxSize);
+        }
+        PendingSlab = CurrentSlab;
+    }
+    PendingSize = MaxSize;
+    FSlab& Slab = Slabs[PendingSlab];
+    return Slab.Data.Get() + Slab.Used;
+}
+
+FHexademicRecordHandle FHexademic6RecordArena::Commit(int32 Length)
+{
+    check(PendingSlab != INDEX_NONE);
+    check(Length >= 0 && Length <= PendingSize);
+    FSlab& Slab = Slabs[PendingSlab];
+
+    FHexademicRecordHandle Handle;
+    Handle.Slab = PendingSlab;
+    Handle.Offset = (uint32)Slab.Used;
+    Handle.Length = (uint32)Length;
+
+    Slab.Used += Length;
+    Slab.LiveBytes += Length;
+    LiveBytes += Length;
+    PendingSlab = INDEX_NONE;
+    PendingSize = 0;
+    return Handle;
+}
+
+void FHexademic6RecordArena::CancelReservation()
+{
+    // A dedicated slab that never received its record goes straight back.
+    if (PendingSlab != INDEX_NONE && PendingSlab != CurrentSlab && Slabs[PendingSlab].Used == 0)
+    {
+        FSlab& Slab = Slabs[PendingSlab];
+        AllocatedBytes -= Slab.Capacity;
+        Slab.Data.Reset();
+        Slab.Capacity = 0;
+    }
+    PendingSlab = INDEX_NONE;
+    PendingSize = 0;
+}
+
+void FHexademic6RecordArena::Free(const FHexademicRecordHandle& Handle)
+{
+    if (!Handle.IsValid())
+    {
+        return;
+    }
+    FSlab& Slab = Slabs[Handle.Slab];
+    Slab.LiveBytes -= (int32)Handle.Length;
+    LiveBytes -= Handle.Length;
+    check(Slab.LiveBytes >= 0);
+
+    if (Slab.LiveBytes == 0 && Handle.Slab != CurrentSlab)
+    {
+        Slab.Used = 0;
+        if (Slab.Capacity == SlabSize)
+        {
+            FreeSlabs.Add(Handle.Slab);
+        }
+        else
+        {
+            // Oversized slabs are released rather than recycled.
+            AllocatedBytes -= Slab.Capacity;
+            Slab.Data.Reset();
+            Slab.Capacity = 0;
+        }
+    }
+}
+
+void FHexademic6RecordArena::Empty()
+{
+    check(PendingSlab == INDEX_NONE);
+    Slabs.Empty();
+    FreeSlabs.Empty();
+    CurrentSlab = INDEX_NONE;
+    LiveBytes = 0;
+    AllocatedBytes = 0;
+}
+
+void FHexademic6RecordArena::Compact(TArrayView<FHexademicRecordHandle*> LiveHandles)
+{
+    check(PendingSlab == INDEX_NONE);
+    TArray<FSlab> OldSlabs = MoveTemp(Slabs);
+    Empty();
+
+    for (FHexademicRecordHandle* Handle : LiveHandles)
+    {
+        const FSlab& OldSlab = OldSlabs[Handle->Slab];
+        const int32 Length = (int32)Handle->Length;
+        uint8* Out = Reserve(FMath::Max(Length, 1));
+        FMemory::Memcpy(Out, OldSlab.Data.Get() + Handle->Offset, Length);
+        *Handle = Commit(Length);
+    }
+}
+
+float FHexademic6RecordArena::GetDeadRatio() const
+{
+    int64 UsedBytes = 0;
+    for (const FSlab& Slab : Slabs)
+    {
+        UsedBytes += Slab.Used;
+    }
+    return UsedBytes > 0 ? (float)(1.0 - (double)LiveBytes / (double)UsedBytes) : 0.0f;
+}
@@ -0,0 +1,656 @@
+// Hexademic6RecordCodec.cpp
+// Record framing, in-house dictionary LZ, Oodle levels and dictionary training.
+
+#include "Hexademic6RecordCodec.h"
+#include "Async/Async.h"                       // For Async
+#include "Compression/OodleDataCompression.h" // For FOodleDataCompression
+#include "HAL/IConsoleManager.h"              // For TAutoConsoleVariable
+#include "Logging/LogMacros.h"                // For UE_LOG
+#include "Misc/Crc.h"                         // For FCrc::MemCrc32
+#include "Serialization/MemoryReader.h"       // For FMemoryReaderView
+#include "Serialization/MemoryWriter.h"       // For FMemoryWriter
+
+static TAutoConsoleVariable<int32> CVarHexademicCodecDictionarySamples(
+    TEXT("Hexademic.Codec.DictionarySamples"),
+    64,
+    TEXT("Records of one EventType collected before its LZ dictionary is trained. 0 disables training."),
+    ECVF_Default);
+
+namespace Hexademic6RecordCodecPrivate
+{
+    // -------------------------------------------------------------------------
+    // Byte LZ
+    // -------------------------------------------------------------------------
+    // LZ4-style sequences: a token byte holding the literal count (high nibble) and match
+    // length - MinMatch (low nibble), 255-continued length extensions, the literals, then a
+    // 16-bit little-endian offset. The last sequence carries literals only. A dictionary is
+    // treated as history preceding the input, so matches may reach back into it.
+
+    constexpr int32 MinMatch = 4;
+    constexpr int32 MaxOffset = 65535;
+    constexpr int32 HashBits = 14;
+
+    FORCEINLINE uint32 HashAt(const uint8* Ptr)
+    {
+        uint32 Value;
+        FMemory::Memcpy(&Value, Ptr, sizeof(Value));
+        return (Value * 2654435761u) >> (32 - HashBits);
+    }
+
+    // Worst case output for NumBytes of input: all literals plus length extensions and a token.
+    FORCEINLINE int32 GetLZBound(int32 NumBytes)
+    {
+        return NumBytes + NumBytes / 255 + 16;
+    }
+
+    FORCEINLINE void WriteLength(uint8*& Op, int32 Length)
+    {
+        for (; Length >= 255; Length -= 255)
+        {
+            *Op++ = 255;
+        }
+        *Op++ = (uint8)Length;
+    }
+
+    FORCEINLINE bool ReadLength(const uint8*& Ip, const uint8* End, int32& InOutLength)
+    {
+        uint8 Byte;
+        do
+        {
+            if (Ip >= End)
+            {
+                return false;
+            }
+            Byte = *Ip++;
+            InOutLength += Byte;
+        } while (Byte == 255);
+        return true;
+    }
+
+    void EmitSequence(uint8*& Op, const uint8* Literals, int32 NumLiterals, int32 Offset, int32 MatchLength)
+    {
+        const int32 MatchCode = MatchLength > 0 ? MatchLength - MinMatch : 0;
+        *Op++ = (uint8)((FMath::Min(NumLiterals, 15) << 4) | FMath::Min(MatchCode, 15));
+        if (NumLiterals >= 15)
+        {
+            WriteLength(Op, NumLiterals - 15);
+        }
+        FMemory::Memcpy(Op, Literals, NumLiterals);
+        Op += NumLiterals;
+        if (MatchLength > 0)
+        {
+            *Op++ = (uint8)(Offset & 0xFF);
+            *Op++ = (uint8)(Offset >> 8);
+            if (MatchCode >= 15)
+            {
+                WriteLength(Op, MatchCode - 15);
+            }
+        }
+    }
+
+    // Writes at most GetLZBound(Input.Num()) bytes to Out and returns the count. Window and Table
+    // are caller-owned scratch so repeated calls do not allocate.
+    int32 CompressLZ(TConstArrayView<uint8> Dictionary, TConstArrayView<uint8> Input, uint8* Out, TArray<uint8>& Window, TArray<int32>& Table)
+    {
+        Window.Reset(Dictionary.Num() + Input.Num());
+        Window.Append(Dictionary.GetData(), Dictionary.Num());
+        Window.Append(Input.GetData(), Input.Num());
+        const uint8* Base = Window.GetData();
+        const int32 End = Window.Num();
+
+        Table.Init(INDEX_NONE, 1 << HashBits);
+        for (int32 Pos = 0; Pos + MinMatch <= Dictionary.Num(); ++Pos)
+        {
+            Table[HashAt(Base + Pos)] = Pos;
+        }
+
+        uint8* Op = Out;
+        int32 Pos = Dictionary.Num();
+        int32 Anchor = Pos;
+        while (Pos + MinMatch <= End)
+        {
+            const uint32 Hash = HashAt(Base + Pos);
+            const int32 Candidate = Table[Hash];
+            Table[Hash] = Pos;
+            if (Candidate == INDEX_NONE || Pos - Candidate > MaxOffset || FMemory::Memcmp(Base + Candidate, Base + Pos, MinMatch) != 0)
+            {
+                ++Pos;
+                continue;
+            }
+
+            int32 MatchLength = MinMatch;
+            while (Pos + MatchLength < End && Base[Candidate + MatchLength] == Base[Pos + MatchLength])
+            {
+                ++MatchLength;
+            }
+            EmitSequence(Op, Base + Anchor, Pos - Anchor, Pos - Candidate, MatchLength);
+
+            // Index positions inside the match so later repeats find it.
+            for (int32 Inner = Pos + 1; Inner < Pos + MatchLength && Inner + MinMatch <= End; ++Inner)
+            {
+                Table[HashAt(Base + Inner)] = Inner;
+            }
+            Pos += MatchLength;
+            Anchor = Pos;
+        }
+        EmitSequence(Op, Base + Anchor, End - Anchor, 0, 0);
+        return (int32)(Op - Out);
+    }
+
+    bool DecompressLZ(TConstArrayView<uint8> Dictionary, TConstArrayView<uint8> Payload, int32 RawSize, TArray<uint8>& OutRaw)
+    {
+        TArray<uint8> Window;
+        const int32 Expected = Dictionary.Num() + RawSize;
+        Window.Reserve(Expected);
+        Window.Append(Dictionary.GetData(), Dictionary.Num());
+
+        const uint8* Ip = Payload.GetData();
+        const uint8* const IpEnd = Ip + Payload.Num();
+        while (Ip < IpEnd)
+        {
+            const uint8 Token = *Ip++;
+            int32 NumLiterals = Token >> 4;
+            if (NumLiterals == 15 && !ReadLength(Ip, IpEnd, NumLiterals))
+            {
+                return false;
+            }
+            if (NumLiterals > IpEnd - Ip || Window.Num() + NumLiterals > Expected)
+            {
+                return false;
+            }
+            Window.Append(Ip, NumLiterals);
+            Ip += NumLiterals;
+            if (Ip == IpEnd)
+            {
+                break;
+            }
+
+            if (IpEnd - Ip < 2)
+            {
+                return false;
+            }
+            const int32 Offset = Ip[0] | (Ip[1] << 8);
+            Ip += 2;
+            int32 MatchLength = Token & 0xF;
+            if (MatchLength == 15 && !ReadLength(Ip, IpEnd, MatchLength))
+            {
+                return false;
+            }
+            MatchLength += MinMatch;
+            if (Offset == 0 || Offset > Window.Num() || Window.Num() + MatchLength > Expected)
+            {
+                return false;
+            }
+            // Byte-wise copy: overlapping matches (Offset < MatchLength) replicate runs.
+            int32 From = Window.Num() - Offset;
+            for (int32 Index = 0; Index < MatchLength; ++Index)
+            {
+                Window.Add(Window[From++]);
+            }
+        }
+
+        if (Window.Num() != Expected)
+        {
+            return false;
+        }
+        OutRaw.Reset(RawSize);
+        OutRaw.Append(Window.GetData() + Dictionary.Num(), RawSize);
+        return true;
+    }
+}
+
+// =============================================================================
+// LEVELS AND FRAMING
+// =============================================================================
+
+uint8 FHexademic6RecordCodec::GetLevelForOrder(ECognitiveLatticeOrder Order)
+{
+    switch (Order)
+    {
+    case ECognitiveLatticeOrder::Order6:
+    case ECognitiveLatticeOrder::Order12:   return 1;
+    case ECognitiveLatticeOrder::Order24:
+    case ECognitiveLatticeOrder::Order48:   return 2;
+    case ECognitiveLatticeOrder::Order96:   return 3;
+    default:                                return 4;
+    }
+}
+
+EHexademic6RecordCodec FHexademic6RecordCodec::GetCodecForLevel(uint8 Level)
+{
+    switch (Level)
+    {
+    case 0:  return EHexademic6RecordCodec::Stored;
+    case 1:
+    case 2:  return EHexademic6RecordCodec::LZ;
+    case 3:  return EHexademic6RecordCodec::OodleKraken;
+    default: return EHexademic6RecordCodec::OodleLeviathan;
+    }
+}
+
+void FHexademic6RecordCodec::WriteFrameHeader(const FHexademic6RecordFrameHeader& Header, uint8* Out)
+{
+    Out[0] = Header.Version;
+    Out[1] = Header.Level;
+    Out[2] = (uint8)Header.Codec;
+    Out[3] = (uint8)Header.Order;
+    for (int32 Byte = 0; Byte < 4; ++Byte)
+    {
+        Out[4 + Byte] = (uint8)(Header.DictionaryId >> (8 * Byte));
+        Out[8 + Byte] = (uint8)(Header.RawSize >> (8 * Byte));
+    }
+}
+
+bool FHexademic6RecordCodec::ReadFrameHeader(TConstArrayView<uint8> Record, FHexademic6RecordFrameHeader& OutHeader)
+{
+    if (Record.Num() < FHexademic6RecordFrameHeader::SerializedSize || Record[0] != FHexademic6RecordFrameHeader::CurrentVersion)
+    {
+        return false;
+    }
+    OutHeader.Version = Record[0];
+    OutHeader.Level = Record[1];
+    OutHeader.Codec = (EHexademic6RecordCodec)Record[2];
+    OutHeader.Order = (ECognitiveLatticeOrder)Record[3];
+    OutHeader.DictionaryId = 0;
+    OutHeader.RawSize = 0;
+    for (int32 Byte = 0; Byte < 4; ++Byte)
+    {
+        OutHeader.DictionaryId |= (uint32)Record[4 + Byte] << (8 * Byte);
+        OutHeader.RawSize |= (uint32)Record[8 + Byte] << (8 * Byte);
+    }
+    return OutHeader.Codec <= EHexademic6RecordCodec::OodleLeviathan;
+}
+
+namespace Hexademic6RecordCodecPrivate
+{
+    // Slices are written in native byte order; every supported platform is little-endian.
+    template<typename T>
+    FORCEINLINE void WriteScalar(uint8* Out, int32& Offset, T Value)
+    {
+        FMemory::Memcpy(Out + Offset, &Value, sizeof(T));
+        Offset += sizeof(T);
+    }
+
+    template<typename T>
+    FORCEINLINE T ReadScalar(const uint8* In, int32& Offset)
+    {
+        T Value;
+        FMemory::Memcpy(&Value, In + Offset, sizeof(T));
+        Offset += sizeof(T);
+        return Value;
+    }
+
+    // Writes the slice header and cross references at Out + frame header size and returns the
+    // body offset.
+    int32 WriteSlices(const FHexademicMemoryNode& Memory, uint8* Out)
+    {
+        const int32 NumCrossReferences = Memory.CrossReferences.Num();
+        const int32 CrossReferenceOffset = FHexademic6RecordFrameHeader::SerializedSize + FHexademic6RecordSliceHeader::SerializedSize;
+        const int32 BodyOffset = CrossReferenceOffset + NumCrossReferences * FHexademic6RecordSliceHeader::CrossReferenceSize;
+
+        int32 Offset = FHexademic6RecordFrameHeader::SerializedSize;
+        WriteScalar<float>(Out, Offset, Memory.ResonanceStrength);
+        WriteScalar<float>(Out, Offset, Memory.EmotionalValence);
+        WriteScalar<float>(Out, Offset, Memory.EmotionalIntensity);
+        WriteScalar<float>(Out, Offset, Memory.MythicDepth);
+        WriteScalar<int32>(Out, Offset, Memory.AccessCount);
+        WriteScalar<uint32>(Out, Offset, (uint32)CrossReferenceOffset);
+        WriteScalar<uint32>(Out, Offset, (uint32)NumCrossReferences);
+        WriteScalar<uint32>(Out, Offset, (uint32)BodyOffset);
+        for (const FDUIDSIndex& Reference : Memory.CrossReferences)
+        {
+            WriteScalar<uint8>(Out, Offset, Reference.MajorClass);
+            WriteScalar<uint8>(Out, Offset, Reference.Division);
+            WriteScalar<uint16>(Out, Offset, Reference.Section);
+            WriteScalar<uint32>(Out, Offset, Reference.SubSection);
+            WriteScalar<uint16>(Out, Offset, Reference.Cutter);
+            WriteScalar<uint8>(Out, Offset, Reference.Edition);
+        }
+        return BodyOffset;
+    }
+}
+
+bool FHexademic6RecordCodec::ReadSliceHeader(TConstArrayView<uint8> Record, FHexademic6RecordSliceHeader& OutSlices)
+{
+    using namespace Hexademic6RecordCodecPrivate;
+    constexpr int32 SlicesEnd = FHexademic6RecordFrameHeader::SerializedSize + FHexademic6RecordSliceHeader::SerializedSize;
+    if (Record.Num() < SlicesEnd || Record[0] != FHexademic6RecordFrameHeader::CurrentVersion)
+    {
+        return false;
+    }
+    const uint8* In = Record.GetData();
+    int32 Offset = FHexademic6RecordFrameHeader::SerializedSize;
+    OutSlices.ResonanceStrength = ReadScalar<float>(In, Offset);
+    OutSlices.EmotionalValence = ReadScalar<float>(In, Offset);
+    OutSlices.EmotionalIntensity = ReadScalar<float>(In, Offset);
+    OutSlices.MythicDepth = ReadScalar<float>(In, Offset);
+    OutSlices.AccessCount = ReadScalar<int32>(In, Offset);
+    OutSlices.CrossReferenceOffset = ReadScalar<uint32>(In, Offset);
+    OutSlices.NumCrossReferences = ReadScalar<uint32>(In, Offset);
+    OutSlices.BodyOffset = ReadScalar<uint32>(In, Offset);
+
+    const uint64 CrossReferencesEnd = (uint64)OutSlices.CrossReferenceOffset + (uint64)OutSlices.NumCrossReferences * FHexademic6RecordSliceHeader::CrossReferenceSize;
+    return OutSlices.CrossReferenceOffset >= (uint32)SlicesEnd && CrossReferencesEnd <= OutSlices.BodyOffset && OutSlices.BodyOffset <= (uint32)Record.Num();
+}
+
+bool FHexademic6RecordCodec::ReadCrossReferences(TConstArrayView<uint8> Record, TArray<FDUIDSIndex>& OutCrossReferences)
+{
+    using namespace Hexademic6RecordCodecPrivate;
+    FHexademic6RecordSliceHeader Slices;
+    if (!ReadSliceHeader(Record, Slices))
+    {
+        return false;
+    }
+    const uint8* In = Record.GetData();
+    int32 Offset = (int32)Slices.CrossReferenceOffset;
+    OutCrossReferences.Reset(Slices.NumCrossReferences);
+    for (uint32 Index = 0; Index < Slices.NumCrossReferences; ++Index)
+    {
+        FDUIDSIndex& Reference = OutCrossReferences.AddDefaulted_GetRef();
+        Reference.MajorClass = ReadScalar<uint8>(In, Offset);
+        Reference.Division = ReadScalar<uint8>(In, Offset);
+        Reference.Section = ReadScalar<uint16>(In, Offset);
+        Reference.SubSection = ReadScalar<uint32>(In, Offset);
+        Reference.Cutter = ReadScalar<uint16>(In, Offset);
+        Reference.Edition = ReadScalar<uint8>(In, Offset);
+    }
+    return true;
+}
+
+void FHexademic6RecordCodec::SerializeNode(const FHexademicMemoryNode& Memory, TArray<uint8>& OutBytes)
+{
+    FMemoryWriter Writer(OutBytes);
+    FHexademicMemoryNode::StaticStruct()->SerializeBin(Writer, const_cast<FHexademicMemoryNode*>(&Memory));
+}
+
+bool FHexademic6RecordCodec::DeserializeNode(TConstArrayView<uint8> Bytes, FHexademicMemoryNode& OutMemory)
+{
+    FMemoryReaderView Reader(Bytes);
+    FHexademicMemoryNode::StaticStruct()->SerializeBin(Reader, &OutMemory);
+    return !Reader.IsError() && Reader.Tell() == Bytes.Num();
+}
+
+// =============================================================================
+// PAYLOAD CODEC
+// =============================================================================
+
+int32 FHexademic6RecordCodec::GetPayloadBound(int32 RawSize)
+{
+    return (int32)FMath::Max<int64>(Hexademic6RecordCodecPrivate::GetLZBound(RawSize), FOodleDataCompression::CompressedBufferSizeNeeded(RawSize));
+}
+
+int32 FHexademic6RecordCodec::CompressPayload(TConstArrayView<uint8> Raw, uint8 Level, uint32 DictionaryId, uint8* OutPayload, int32 Capacity, EHexademic6RecordCodec& OutCodec)
+{
+    check(Capacity >= GetPayloadBound(Raw.Num()));
+    OutCodec = GetCodecForLevel(Level);
+    int64 Written = 0;
+    switch (OutCodec)
+    {
+    case EHexademic6RecordCodec::LZ:
+    {
+        const TArray<uint8>* Dictionary = DictionaryId != 0 ? Dictionaries.Find(DictionaryId) : nullptr;
+        if (DictionaryId != 0 && !Dictionary)
+        {
+            return INDEX_NONE;
+        }
+        Written = Hexademic6RecordCodecPrivate::CompressLZ(Dictionary ? TConstArrayView<uint8>(*Dictionary) : TConstArrayView<uint8>(), Raw, OutPayload, ScratchWindow, ScratchTable);
+        break;
+    }
+    case EHexademic6RecordCodec::OodleKraken:
+    case EHexademic6RecordCodec::OodleLeviathan:
+    {
+        const bool bKraken = OutCodec == EHexademic6RecordCodec::OodleKraken;
+        Written = FOodleDataCompression::Compress(OutPayload, Capacity, Raw.GetData(), Raw.Num(),
+            bKraken ? FOodleDataCompression::ECompressor::Kraken : FOodleDataCompression::ECompressor::Leviathan,
+            bKraken ? FOodleDataCompression::ECompressionLevel::Normal : FOodleDataCompression::ECompressionLevel::Optimal2);
+        if (Written <= 0)
+        {
+            return INDEX_NONE;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    // Incompressible input is stored as-is rather than expanded.
+    if (OutCodec == EHexademic6RecordCodec::Stored || Written >= Raw.Num())
+    {
+        FMemory::Memcpy(OutPayload, Raw.GetData(), Raw.Num());
+        Written = Raw.Num();
+        OutCodec = EHexademic6RecordCodec::Stored;
+    }
+    return (int32)Written;
+}
+
+bool FHexademic6RecordCodec::DecompressPayload(TConstArrayView<uint8> Payload, EHexademic6RecordCodec Codec, uint32 DictionaryId, int32 RawSize, TArray<uint8>& OutRaw) const
+{
+    switch (Codec)
+    {
+    case EHexademic6RecordCodec::Stored:
+        if (Payload.Num() != RawSize)
+        {
+            return false;
+        }
+        OutRaw = TArray<uint8>(Payload.GetData(), Payload.Num());
+        return true;
+
+    case EHexademic6RecordCodec::LZ:
+    {
+        const TArray<uint8>* Dictionary = DictionaryId != 0 ? Dictionaries.Find(DictionaryId) : nullptr;
+        if (DictionaryId != 0 && !Dictionary)
+        {
+            UE_LOG(LogHexademicLattice, Error, TEXT("RecordCodec: dictionary %u is not registered."), DictionaryId);
+            return false;
+        }
+        return Hexademic6RecordCodecPrivate::DecompressLZ(Dictionary ? TConstArrayView<uint8>(*Dictionary) : TConstArrayView<uint8>(), Payload, RawSize, OutRaw);
+    }
+
+    case EHexademic6RecordCodec::OodleKraken:
+    case EHexademic6RecordCodec::OodleLeviathan:
+        OutRaw.SetNumUninitialized(RawSize);
+        return FOodleDataCompression::Decompress(OutRaw.GetData(), RawSize, Payload.GetData(), Payload.Num());
+
+    default:
+        return false;
+    }
+}
+
+// =============================================================================
+// NODE ROUND TRIP
+// =============================================================================
+
+int32 FHexademic6RecordCodec::CompressTo(const FHexademicMemoryNode& Memory, uint8 Level, TFunctionRef<uint8*(int32 MaxRecordSize)> Allocate)
+{
+    if (PendingTraining.Num() > 0)
+    {
+        CollectTrainedDictionaries();
+    }
+
+    // Cross references live in the uncompressed slice area; the body does not repeat them.
+    ScratchBody = Memory;
+    ScratchBody.CrossReferences.Reset();
+    ScratchRaw.Reset();
+    SerializeNode(ScratchBody, ScratchRaw);
+    AddTrainingSample(Memory.EventType, ScratchRaw);
+
+    FHexademic6RecordFrameHeader Header;
+    Header.Level = Level;
+    Header.Order = Memory.LatticePosition.LatticeOrder;
+    Header.DictionaryId = Level == 2 ? GetDictionaryForEventType(Memory.EventType) : 0;
+    Header.RawSize = (uint32)ScratchRaw.Num();
+
+    const int32 SlicesEnd = FHexademic6RecordFrameHeader::SerializedSize + FHexademic6RecordSliceHeader::SerializedSize
+        + Memory.CrossReferences.Num() * FHexademic6RecordSliceHeader::CrossReferenceSize;
+    const int32 PayloadBound = GetPayloadBound(ScratchRaw.Num());
+    uint8* Out = Allocate(SlicesEnd + PayloadBound);
+    if (!Out)
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 BodyOffset = Hexademic6RecordCodecPrivate::WriteSlices(Memory, Out);
+    const int32 PayloadSize = CompressPayload(ScratchRaw, Level, Header.DictionaryId, Out + BodyOffset, PayloadBound, Header.Codec);
+    if (PayloadSize == INDEX_NONE)
+    {
+        UE_LOG(LogHexademicLattice, Error, TEXT("RecordCodec: failed to compress memory %s at level %d."), *Memory.MemoryID.ToString(), Level);
+        return INDEX_NONE;
+    }
+    // A Stored fallback does not reference the dictionary.
+    if (Header.Codec == EHexademic6RecordCodec::Stored)
+    {
+        Header.DictionaryId = 0;
+    }
+    WriteFrameHeader(Header, Out);
+    return BodyOffset + PayloadSize;
+}
+
+bool FHexademic6RecordCodec::Compress(const FHexademicMemoryNode& Memory, uint8 Level, TArray<uint8>& OutRecord)
+{
+    const int32 RecordSize = CompressTo(Memory, Level, [&OutRecord](int32 MaxRecordSize)
+    {
+        OutRecord.SetNumUninitialized(MaxRecordSize, EAllowShrinking::No);
+        return OutRecord.GetData();
+    });
+    OutRecord.SetNum(FMath::Max(RecordSize, 0), EAllowShrinking::No);
+    return RecordSize != INDEX_NONE;
+}
+
+bool FHexademic6RecordCodec::Decompress(TConstArrayView<uint8> Record, FHexademicMemoryNode& OutMemory) const
+{
+    FHexademic6RecordFrameHeader Header;
+    FHexademic6RecordSliceHeader Slices;
+    if (!ReadFrameHeader(Record, Header) || !ReadSliceHeader(Record, Slices))
+    {
+        UE_LOG(LogHexademicLattice, Error, TEXT("RecordCodec: unreadable record header (%d bytes)."), Record.Num());
+        return false;
+    }
+    TArray<uint8> Raw;
+    const TConstArrayView<uint8> Payload = Record.RightChop((int32)Slices.BodyOffset);
+    if (!DecompressPayload(Payload, Header.Codec, Header.DictionaryId, (int32)Header.RawSize, Raw) || !DeserializeNode(Raw, OutMemory))
+    {
+        UE_LOG(LogHexademicLattice, Error, TEXT("RecordCodec: corrupt record (codec %d, %d payload bytes)."), (int32)Header.Codec, Payload.Num());
+        return false;
+    }
+    return ReadCrossReferences(Record, OutMemory.CrossReferences);
+}
+
+// =============================================================================
+// DICTIONARIES
+// =============================================================================
+
+bool FHexademic6RecordCodec::BuildDictionary(TConstArrayView<TArray<uint8>> Samples, int32 MaxDictionarySize, TArray<uint8>& OutDictionary)
+{
+    // Greedy gram selection: every 8-byte substring that occurs in at least two samples is a
+    // candidate, and the most widespread ones are packed until the size budget is spent.
+    constexpr int32 GramSize = 8;
+    TMap<uint64, int32> SampleCounts;
+    TSet<uint64> SeenInSample;
+    for (const TArray<uint8>& Sample : Samples)
+    {
+        SeenInSample.Reset();
+        for (int32 Pos = 0; Pos + GramSize <= Sample.Num(); ++Pos)
+        {
+            uint64 Gram;
+            FMemory::Memcpy(&Gram, Sample.GetData() + Pos, GramSize);
+            bool bAlreadySeen = false;
+            SeenInSample.Add(Gram, &bAlreadySeen);
+            if (!bAlreadySeen)
+            {
+                ++SampleCounts.FindOrAdd(Gram);
+            }
+        }
+    }
+
+    TArray<TPair<uint64, int32>> Candidates;
+    for (const TPair<uint64, int32>& Pair : SampleCounts)
+    {
+        if (Pair.Value >= 2)
+        {
+            Candidates.Add(Pair);
+        }
+    }
+    Candidates.Sort([](const TPair<uint64, int32>& A, const TPair<uint64, int32>& B) { return A.Value > B.Value; });
+
+    const int32 MaxGrams = MaxDictionarySize / GramSize;
+    if (Candidates.Num() < 4)
+    {
+        return false;
+    }
+    // Most common grams go last, closest to the input, so their matches get short offsets.
+    const int32 NumGrams = FMath::Min(MaxGrams, Candidates.Num());
+    OutDictionary.SetNumUninitialized(NumGrams * GramSize);
+    for (int32 GramIndex = 0; GramIndex < NumGrams; ++GramIndex)
+    {
+        FMemory::Memcpy(OutDictionary.GetData() + (NumGrams - 1 - GramIndex) * GramSize, &Candidates[GramIndex].Key, GramSize);
+    }
+    return true;
+}
+
+uint32 FHexademic6RecordCodec::TrainDictionary(const FString& EventType, TConstArrayView<TArray<uint8>> Samples, int32 MaxDictionarySize)
+{
+    TArray<uint8> Dictionary;
+    return BuildDictionary(Samples, MaxDictionarySize, Dictionary) ? RegisterEventTypeDictionary(EventType, MoveTemp(Dictionary)) : 0;
+}
+
+uint32 FHexademic6RecordCodec::RegisterEventTypeDictionary(const FString& EventType, TArray<uint8> Dictionary)
+{
+    uint32 DictionaryId = FCrc::MemCrc32(Dictionary.GetData(), Dictionary.Num());
+    DictionaryId = DictionaryId != 0 ? DictionaryId : 1;
+    UE_LOG(LogHexademicLattice, Log, TEXT("RecordCodec: trained %d-byte dictionary %u for EventType '%s'."), Dictionary.Num(), DictionaryId, *EventType);
+    AddDictionary(DictionaryId, MoveTemp(Dictionary));
+    DictionaryByEventType.Add(EventType, DictionaryId);
+    return DictionaryId;
+}
+
+void FHexademic6RecordCodec::AddDictionary(uint32 DictionaryId, TArray<uint8> Dictionary)
+{
+    check(DictionaryId != 0);
+    Dictionaries.Add(DictionaryId, MoveTemp(Dictionary));
+}
+
+uint32 FHexademic6RecordCodec::GetDictionaryForEventType(const FString& EventType) const
+{
+    const uint32* DictionaryId = DictionaryByEventType.Find(EventType);
+    return DictionaryId ? *DictionaryId : 0;
+}
+
+void FHexademic6RecordCodec::AddTrainingSample(const FString& EventType, TConstArrayView<uint8> Raw)
+{
+    const int32 SamplesNeeded = CVarHexademicCodecDictionarySamples.GetValueOnAnyThread();
+    if (SamplesNeeded <= 0 || DictionaryByEventType.Contains(EventType) || PendingTraining.Contains(EventType))
+    {
+        return;
+    }
+    TArray<TArray<uint8>>& Samples = PendingSamples.FindOrAdd(EventType);
+    Samples.Emplace(Raw.GetData(), Raw.Num());
+    if (Samples.Num() >= SamplesNeeded)
+    {
+        // Training scans every sample, far more work than one compression, so it runs on the
+        // thread pool and the store path keeps compressing without a dictionary meanwhile.
+        PendingTraining.Add(EventType, Async(EAsyncExecution::ThreadPool, [Samples = MoveTemp(Samples)]()
+        {
+            TArray<uint8> Dictionary;
+            BuildDictionary(Samples, DefaultMaxDictionarySize, Dictionary);
+            return Dictionary;
+        }));
+        PendingSamples.Remove(EventType);
+    }
+}
+
+void FHexademic6RecordCodec::CollectTrainedDictionaries()
+{
+    for (auto It = PendingTraining.CreateIterator(); It; ++It)
+    {
+        if (It.Value().IsReady())
+        {
+            // An empty result means the samples were too dissimilar; fresh ones are collected.
+            TArray<uint8> Dictionary = It.Value().Consume();
+            if (Dictionary.Num() > 0)
+            {
+                RegisterEventTypeDictionary(It.Key(), MoveTemp(Dictionary));
+            }
+            It.RemoveCurrent();
+        }
+    }
+}
@@ -0,0 +1,443 @@
+// Hexademic6ResonanceField.cpp
+// Multilinear splatting, incremental contribution tracking and interpolated sampling.
+
+#include "Hexademic6ResonanceField.h"
+#include "Async/ParallelFor.h" // For ParallelFor
+
+namespace Hexademic6ResonanceFieldPrivate
+{
+    // Batches below this size are sampled on the calling thread.
+    constexpr int32 MinParallelSamples = 1024;
+    constexpr int32 SampleChunkSize = 256;
+
+    // Changed voxels tracked per order before the whole order is reported changed instead.
+    constexpr int32 MinTrackedVoxelChanges = 4096;
+
+    FORCEINLINE int32 FloorDiv(int32 Value, int32 Divisor)
+    {
+        const int32 Quotient = Value / Divisor;
+        return (Value % Divisor != 0 && Value < 0) ? Quotient - 1 : Quotient;
+    }
+
+    FORCEINLINE void LocateVoxel(int32 VoxelSize, const FHexademic6DCoordinate& Position, int32 (&OutBase)[6], float (&OutFractions)[6])
+    {
+        const int32 Components[6] = { Position.X, Position.Y, Position.Z, Position.W, Position.U, Position.V };
+        const float InvVoxelSize = 1.0f / VoxelSize;
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            OutBase[Axis] = FloorDiv(Components[Axis], VoxelSize);
+            OutFractions[Axis] = (Components[Axis] - OutBase[Axis] * VoxelSize) * InvVoxelSize;
+        }
+    }
+
+    // A component just below a grid plane (e.g. -1e-9) floors to the cell beneath, and its
+    // fraction rounds to exactly 1.0f; InterpolateWithGradient divides by 1 - fraction. Such a
+    // position is carried onto the plane it rounds to, as base + 1 with a zero fraction.
+    FORCEINLINE void LocateVoxel(int32 VoxelSize, const FVector6& Position, int32 (&OutBase)[6], float (&OutFractions)[6])
+    {
+        const float InvVoxelSize = 1.0f / VoxelSize;
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            const float Scaled = Position[Axis] * InvVoxelSize;
+            const float Floor = FMath::FloorToFloat(Scaled);
+            OutBase[Axis] = (int32)Floor;
+            OutFractions[Axis] = Scaled - Floor;
+            if (OutFractions[Axis] >= 1.0f)
+            {
+                ++OutBase[Axis];
+                OutFractions[Axis] = 0.0f;
+            }
+        }
+    }
+
+    // Calls Visitor(VoxelKey, Weight, Corner) for each corner of the voxel at Base with a non-zero
+    // multilinear weight. An axis with a zero fraction only contributes its lower corner, so
+    // positions on grid planes visit 2^(axes off the grid) corners rather than all 64.
+    template<typename VisitorType>
+    FORCEINLINE void ForEachCorner(const int32 (&Base)[6], const float (&Fractions)[6], VisitorType&& Visitor)
+    {
+        uint32 OffGridAxes = 0;
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            if (Fractions[Axis] > 0.0f)
+            {
+                OffGridAxes |= 1u << Axis;
+            }
+        }
+        uint32 Corner = 0;
+        do
+        {
+            int32 Cell[6];
+            float Weight = 1.0f;
+            for (int32 Axis = 0; Axis < 6; ++Axis)
+            {
+                const bool bUpper = (Corner >> Axis) & 1u;
+                Cell[Axis] = Base[Axis] + (bUpper ? 1 : 0);
+                Weight *= bUpper ? Fractions[Axis] : 1.0f - Fractions[Axis];
+            }
+            Visitor(FHexademic6ResonanceField::PackVoxelKey(Cell), Weight, Corner);
+            Corner = (Corner - OffGridAxes) & OffGridAxes; // Next subset of the off-grid axes
+        }
+        while (Corner != 0);
+    }
+
+    template<typename VoxelMapType>
+    FORCEINLINE float Interpolate(const VoxelMapType& Voxels, const int32 (&Base)[6], const float (&Fractions)[6])
+    {
+        float Value = 0.0f;
+        ForEachCorner(Base, Fractions, [&Voxels, &Value](uint64 Key, float Weight, uint32 Corner)
+        {
+            if (const auto* Voxel = Voxels.Find(Key))
+            {
+                Value += Voxel->Value * Weight;
+            }
+        });
+        return Value;
+    }
+
+    // Interpolated value, plus its gradient per lattice unit. Off-grid axes take the exact partial
+    // derivative from the same corner values. An axis whose fraction is zero sits on a kink of
+    // the interpolant, so it takes the central difference over one voxel on either side.
+    template<typename VoxelMapType>
+    FORCEINLINE float InterpolateWithGradient(const VoxelMapType& Voxels, int32 VoxelSize, const int32 (&Base)[6], const float (&Fractions)[6], FVector6& OutGradient)
+    {
+        float Value = 0.0f;
+        float Partials[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+        ForEachCorner(Base, Fractions, [&Voxels, &Fractions, &Value, &Partials](uint64 Key, float Weight, uint32 Corner)
+        {
+            const auto* Voxel = Voxels.Find(Key);
+            if (!Voxel)
+            {
+                return;
+            }
+            const float Weighted = Voxel->Value * Weight;
+            Value += Weighted;
+            for (int32 Axis = 0; Axis < 6; ++Axis)
+            {
+                // Weight / (this axis' factor) is the product over the other axes; the factor's
+                // derivative is +1 for the upper corner and -1 for the lower one.
+                if (Fractions[Axis] > 0.0f)
+                {
+                    Partials[Axis] += ((Corner >> Axis) & 1u) ? Weighted / Fractions[Axis] : -Weighted / (1.0f - Fractions[Axis]);
+                }
+            }
+        });
+        const float InvVoxelSize = 1.0f / VoxelSize;
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            if (Fractions[Axis] == 0.0f)
+            {
+                int32 Shifted[6] = { Base[0], Base[1], Base[2], Base[3], Base[4], Base[5] };
+                Shifted[Axis] = Base[Axis] + 1;
+                const float Upper = Interpolate(Voxels, Shifted, Fractions);
+                Shifted[Axis] = Base[Axis] - 1;
+                const float Lower = Interpolate(Voxels, Shifted, Fractions);
+                Partials[Axis] = (Upper - Lower) * 0.5f;
+            }
+            OutGradient[Axis] = Partials[Axis] * InvVoxelSize;
+        }
+        return Value;
+    }
+
+    FORCEINLINE bool IsSamePosition(const FHexademic6DCoordinate& A, const FHexademic6DCoordinate& B)
+    {
+        return A.X == B.X && A.Y == B.Y && A.Z == B.Z && A.W == B.W && A.U == B.U && A.V == B.V && A.LatticeOrder == B.LatticeOrder;
+    }
+}
+
+FHexademic6ResonanceField::FHexademic6ResonanceField()
+{
+    for (int32 OrderIndex = 0; OrderIndex < FHexademic6OrderIndexing::NumOrders; ++OrderIndex)
+    {
+        Grids[OrderIndex].VoxelSize = GetDefaultVoxelSize(static_cast<ECognitiveLatticeOrder>(OrderIndex));
+    }
+}
+
+uint64 FHexademic6ResonanceField::PackVoxelKey(const int32 (&Cell)[6])
+{
+    uint64 Key = 0;
+    for (int32 Axis = 0; Axis < 6; ++Axis)
+    {
+        Key |= static_cast<uint64>(Cell[Axis] & 1023) << (Axis * 10);
+    }
+    return Key;
+}
+
+void FHexademic6ResonanceField::UnpackVoxelKey(uint64 Key, int32 (&OutCell)[6])
+{
+    for (int32 Axis = 0; Axis < 6; ++Axis)
+    {
+        OutCell[Axis] = (static_cast<int32>((Key >> (Axis * 10)) & 1023) ^ 512) - 512; // Sign-extend 10 bits
+    }
+}
+
+int32 FHexademic6ResonanceField::GetDefaultVoxelSize(ECognitiveLatticeOrder Order)
+{
+    return Order == ECognitiveLatticeOrder::OrderInfinite ? 64 : FMath::Max(1, FHexademic6OrderIndexing::GetExtent(Order) / 6);
+}
+
+void FHexademic6ResonanceField::SetVoxelSize(ECognitiveLatticeOrder Order, int32 VoxelSize)
+{
+    FGrid& Grid = Grids[(uint8)Order];
+    Grid.Voxels.Reset();
+    Grid.VoxelSize = FMath::Max(1, VoxelSize);
+    MarkAllChanged(Grid);
+    for (const TPair<FGuid, FContribution>& Pair : Contributions)
+    {
+        if (Pair.Value.Position.LatticeOrder == Order)
+        {
+            Splat(Pair.Value, 1);
+        }
+    }
+}
+
+// =============================================================================
+// UPDATES
+// =============================================================================
+
+void FHexademic6ResonanceField::BeginUpdate()
+{
+    ++Generation;
+}
+
+void FHexademic6ResonanceField::Contribute(const FGuid& MemoryID, const FHexademic6DCoordinate& Position, float Influence)
+{
+    using namespace Hexademic6ResonanceFieldPrivate;
+    if (FContribution* Existing = Contributions.Find(MemoryID))
+    {
+        Existing->Generation = Generation;
+        if (IsSamePosition(Existing->Position, Position) && Existing->Influence == Influence)
+        {
+            return;
+        }
+        Splat(*Existing, -1);
+        Existing->Position = Position;
+        Existing->Influence = Influence;
+        Splat(*Existing, 1);
+        return;
+    }
+    FContribution& Added = Contributions.Add(MemoryID);
+    Added.Position = Position;
+    Added.Influence = Influence;
+    Added.Generation = Generation;
+    Splat(Added, 1);
+}
+
+void FHexademic6ResonanceField::EndUpdate()
+{
+    for (TMap<FGuid, FContribution>::TIterator It = Contributions.CreateIterator(); It; ++It)
+    {
+        if (It->Value.Generation != Generation)
+        {
+            Splat(It->Value, -1);
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FHexademic6ResonanceField::Remove(const FGuid& MemoryID)
+{
+    FContribution Removed;
+    if (Contributions.RemoveAndCopyValue(MemoryID, Removed))
+    {
+        Splat(Removed, -1);
+    }
+}
+
+void FHexademic6ResonanceField::Empty()
+{
+    for (FGrid& Grid : Grids)
+    {
+        Grid.Voxels.Empty();
+        MarkAllChanged(Grid);
+    }
+    Contributions.Empty();
+}
+
+void FHexademic6ResonanceField::Rebuild()
+{
+    for (FGrid& Grid : Grids)
+    {
+        Grid.Voxels.Reset();
+        MarkAllChanged(Grid);
+    }
+    for (const TPair<FGuid, FContribution>& Pair : Contributions)
+    {
+        Splat(Pair.Value, 1);
+    }
+}
+
+bool FHexademic6ResonanceField::TakeChangedVoxels(ECognitiveLatticeOrder Order, TSet<uint64>& OutChanged)
+{
+    FGrid& Grid = Grids[(uint8)Order];
+    const bool bAllChanged = Grid.bAllChanged;
+    OutChanged = MoveTemp(Grid.ChangedVoxels);
+    Grid.ChangedVoxels.Reset();
+    Grid.bAllChanged = false;
+    if (bAllChanged)
+    {
+        OutChanged.Reset();
+    }
+    return bAllChanged;
+}
+
+void FHexademic6ResonanceField::MarkAllChanged(FGrid& Grid)
+{
+    Grid.ChangedVoxels.Empty();
+    Grid.bAllChanged = true;
+}
+
+void FHexademic6ResonanceField::Splat(const FContribution& Contribution, int32 Sign)
+{
+    using namespace Hexademic6ResonanceFieldPrivate;
+    if (Contribution.Influence == 0.0f)
+    {
+        return;
+    }
+    FGrid& Grid = Grids[(uint8)Contribution.Position.LatticeOrder];
+    int32 Base[6];
+    float Fractions[6];
+    LocateVoxel(Grid.VoxelSize, Contribution.Position, Base, Fractions);
+    // The contribution counts as a member of the vertex it is closest to.
+    uint32 NearestCorner = 0;
+    for (int32 Axis = 0; Axis < 6; ++Axis)
+    {
+        NearestCorner |= Fractions[Axis] >= 0.5f ? 1u << Axis : 0u;
+    }
+    const float SignedInfluence = Contribution.Influence * Sign;
+    ForEachCorner(Base, Fractions, [&Grid, SignedInfluence, Sign, NearestCorner](uint64 Key, float Weight, uint32 Corner)
+    {
+        FVoxel& Voxel = Grid.Voxels.FindOrAdd(Key);
+        Voxel.NumSplats += Sign;
+        if (Voxel.NumSplats == 0)
+        {
+            Grid.Voxels.Remove(Key);
+        }
+        else
+        {
+            Voxel.Value += SignedInfluence * Weight;
+            Voxel.NumMembers += Corner == NearestCorner ? Sign : 0;
+        }
+        if (!Grid.bAllChanged)
+        {
+            Grid.ChangedVoxels.Add(Key);
+        }
+    });
+    if (Grid.ChangedVoxels.Num() > FMath::Max(MinTrackedVoxelChanges, Grid.Voxels.Num()))
+    {
+        MarkAllChanged(Grid);
+    }
+}
+
+// =============================================================================
+// SAMPLING
+// =============================================================================
+
+float FHexademic6ResonanceField::Sample(const FHexademic6DCoordinate& Position) const
+{
+    using namespace Hexademic6ResonanceFieldPrivate;
+    const FGrid& Grid = Grids[(uint8)Position.LatticeOrder];
+    if (Grid.Voxels.Num() == 0)
+    {
+        return 0.0f;
+    }
+    int32 Base[6];
+    float Fractions[6];
+    LocateVoxel(Grid.VoxelSize, Position, Base, Fractions);
+    return Interpolate(Grid.Voxels, Base, Fractions);
+}
+
+float FHexademic6ResonanceField::Sample(ECognitiveLatticeOrder Order, const FVector6& Position) const
+{
+    using namespace Hexademic6ResonanceFieldPrivate;
+    const FGrid& Grid = Grids[(uint8)Order];
+    if (Grid.Voxels.Num() == 0)
+    {
+        return 0.0f;
+    }
+    int32 Base[6];
+    float Fractions[6];
+    LocateVoxel(Grid.VoxelSize, Position, Base, Fractions);
+    return Interpolate(Grid.Voxels, Base, Fractions);
+}
+
+void FHexademic6ResonanceField::Sample(TConstArrayView<FHexademic6DCoordinate> Positions, TArrayView<float> OutValues) const
+{
+    using namespace Hexademic6ResonanceFieldPrivate;
+    check(OutValues.Num() >= Positions.Num());
+    if (Positions.Num() < MinParallelSamples)
+    {
+        for (int32 Index = 0; Index < Positions.Num(); ++Index)
+        {
+            OutValues[Index] = Sample(Positions[Index]);
+        }
+        return;
+    }
+    const int32 NumChunks = FMath::DivideAndRoundUp(Positions.Num(), SampleChunkSize);
+    ParallelFor(NumChunks, [this, Positions, OutValues](int32 Chunk)
+    {
+        const int32 End = FMath::Min((Chunk + 1) * SampleChunkSize, Positions.Num());
+        for (int32 Index = Chunk * SampleChunkSize; Index < End; ++Index)
+        {
+            OutValues[Index] = Sample(Positions[Index]);
+        }
+    });
+}
+
+float FHexademic6ResonanceField::SampleGradient(const FHexademic6DCoordinate& Position, FVector6& OutGradient) const
+{
+    using namespace Hexademic6ResonanceFieldPrivate;
+    const FGrid& Grid = Grids[(uint8)Position.LatticeOrder];
+    OutGradient = FVector6();
+    if (Grid.Voxels.Num() == 0)
+    {
+        return 0.0f;
+    }
+    int32 Base[6];
+    float Fractions[6];
+    LocateVoxel(Grid.VoxelSize, Position, Base, Fractions);
+    return InterpolateWithGradient(Grid.Voxels, Grid.VoxelSize, Base, Fractions, OutGradient);
+}
+
+float FHexademic6ResonanceField::SampleGradient(ECognitiveLatticeOrder Order, const FVector6& Position, FVector6& OutGradient) const
+{
+    using namespace Hexademic6ResonanceFieldPrivate;
+    const FGrid& Grid = Grids[(uint8)Order];
+    OutGradient = FVector6();
+    if (Grid.Voxels.Num() == 0)
+    {
+        return 0.0f;
+    }
+    int32 Base[6];
+    float Fractions[6];
+    LocateVoxel(Grid.VoxelSize, Position, Base, Fractions);
+    return InterpolateWithGradient(Grid.Voxels, Grid.VoxelSize, Base, Fractions, OutGradient);
+}
+
+void FHexademic6ResonanceField::SampleGradients(TConstArrayView<FHexademic6DCoordinate> Positions, TArrayView<FVector6> OutGradients, TArrayView<float> OutValues) const
+{
+    using namespace Hexademic6ResonanceFieldPrivate;
+    check(OutGradients.Num() >= Positions.Num());
+    check(OutValues.Num() == 0 || OutValues.Num() >= Positions.Num());
+    const auto SampleRange = [this, Positions, OutGradients, OutValues](int32 Begin, int32 End)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            const float Value = SampleGradient(Positions[Index], OutGradients[Index]);
+            if (OutValues.Num() > 0)
+            {
+                OutValues[Index] = Value;
+            }
+        }
+    };
+    if (Positions.Num() < MinParallelSamples)
+    {
+        SampleRange(0, Positions.Num());
+        return;
+    }
+    const int32 NumChunks = FMath::DivideAndRoundUp(Positions.Num(), SampleChunkSize);
+    ParallelFor(NumChunks, [&SampleRange, &Positions](int32 Chunk)
+    {
+        SampleRange(Chunk * SampleChunkSize, FMath::Min((Chunk + 1) * SampleChunkSize, Positions.Num()));
+    });
+}
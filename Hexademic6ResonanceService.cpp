@@ -3,7 +3,12 @@
 
 #include "HexademicSixLattice.h" // Includes the main header with interfaces and structs
 #include "Hexademic6Types.h"     // For FVector6
+#include "Hexademic6LatticeStore.h" // For FHexademic6LatticeStore
+#include "Hexademic6ResonanceField.h" // For FHexademic6ResonanceField
+#include "Hexademic6WaveEngine.h"    // For FHexademic6WaveEngine
+#include "Hexademic6HotspotDetector.h" // For FHexademic6HotspotDetector
 #include "Logging/LogMacros.h"   // For UE_LOG
+#include "Hexademic6CoherenceAggregates.h" // For FHexademic6CoherenceAggregates
 #include "Containers/Map.h"
 #include "Templates/Function.h"  // For TFunction
 
@@ -17,7 +22,6 @@ public:
     FHexademic6ResonanceService()
     {
         UE_LOG(LogHexademicLattice, Log, TEXT("FHexademic6ResonanceService constructed."));
-        GlobalCoherenceValue = 0.0f;
     }
 
     virtual ~FHexademic6ResonanceService() override
@@ -25,56 +29,82 @@ public:
         UE_LOG(LogHexademicLattice, Log, TEXT("FHexademic6ResonanceService destructed."));
     }
 
-    virtual void UpdateResonanceField(const TArray<FHexademicMemoryNode>& ActiveMemories) override
+    virtual void UpdateResonanceField(TConstArrayView<FHexademicMemoryNode> ActiveMemories) override
     {
-        // Placeholder: Implement the logic to update the global resonance field.
-        // This could involve iterating through active memories, calculating their
-        // influence on the field, and updating a spatial grid or data structure.
         UE_LOG(LogHexademicLattice, Log, TEXT("ResonanceService: Updating resonance field with %d active memories."), ActiveMemories.Num());
-        
-        // Example: Simple aggregation for global coherence calculation
-        float TotalResonance = 0.0f;
+
+        // Coherence of exactly this set, in one parallel pass; it stays in effect until the next update.
+        SnapshotCoherence.Recompute(ActiveMemories);
+        CoherenceSource = &SnapshotCoherence;
+
+        // The active set replaces the field's contents; unchanged memories are not re-splatted.
+        ResonanceField.BeginUpdate();
         for (const FHexademicMemoryNode& Memory : ActiveMemories)
         {
-            TotalResonance += Memory.ResonanceStrength * Memory.CognitiveWeight;
+            ResonanceField.Contribute(Memory.MemoryID, Memory.LatticePosition, Memory.ResonanceStrength * Memory.CognitiveWeight);
         }
-        if (ActiveMemories.Num() > 0)
-        {
-            GlobalCoherenceValue = FMath::Clamp(TotalResonance / ActiveMemories.Num(), 0.0f, 1.0f);
-        }
-        else
+        ResonanceField.EndUpdate();
+        HotspotDetector.CollectChanges(ResonanceField);
+        NotifyCoherenceSubscribers();
+    }
+
+    virtual void UpdateResonanceField(const FHexademic6LatticeStore& Store) override
+    {
+        // The store already keeps coherence current; a copy of its aggregates is all this needs.
+        // A service tracking the store reads them live instead.
+        SnapshotCoherence = Store.GetCoherence();
+        if (CoherenceSource != &Store.GetCoherence())
         {
-            GlobalCoherenceValue = 0.0f;
+            CoherenceSource = &SnapshotCoherence;
         }
-        
-        // Notify subscribers
-        for (TFunction<void(float)> Callback : CoherenceUpdateCallbacks)
+
+        int32 TotalMemories = 0;
+        ResonanceField.BeginUpdate();
+        for (int32 OrderIndex = 0; OrderIndex < FHexademic6OrderIndexing::NumOrders; ++OrderIndex)
         {
-            Callback(GlobalCoherenceValue);
+            const ECognitiveLatticeOrder Order = static_cast<ECognitiveLatticeOrder>(OrderIndex);
+            const FHexademic6OrderColumns& Columns = Store.GetColumns(Order);
+            const float* Resonance = Columns.ResonanceStrength.GetData();
+            const float* Weight = Columns.CognitiveWeight.GetData();
+            const int32 NumRows = Columns.Num();
+            for (int32 Row = 0; Row < NumRows; ++Row)
+            {
+                const FHexademic6DCoordinate Position(Columns.X[Row], Columns.Y[Row], Columns.Z[Row], Columns.W[Row], Columns.U[Row], Columns.V[Row], Order);
+                ResonanceField.Contribute(Columns.MemoryIDs[Row], Position, Resonance[Row] * Weight[Row]);
+            }
+            TotalMemories += NumRows;
         }
+        ResonanceField.EndUpdate();
+        HotspotDetector.CollectChanges(ResonanceField);
+        UE_LOG(LogHexademicLattice, Log, TEXT("ResonanceService: Updating resonance field from lattice store with %d memories."), TotalMemories);
+        NotifyCoherenceSubscribers();
     }
 
     virtual float SampleResonanceAt(const FHexademic6DCoordinate& Position) const override
     {
-        // Placeholder: Implement logic to sample the resonance field at a specific 6D position.
-        // This would query your internal resonance data structure.
         UE_LOG(LogHexademicLattice, Verbose, TEXT("ResonanceService: Sampling resonance at coord (X=%d, Y=%d, Z=%d, W=%d, U=%d, V=%d)."), 
             Position.X, Position.Y, Position.Z, Position.W, Position.U, Position.V);
-        
-        // For demonstration, return a value based on position (e.g., distance from center)
-        float DistanceFromCenter = FVector6((float)Position.X, (float)Position.Y, (float)Position.Z, (float)Position.W, (float)Position.U, (float)Position.V).Size();
-        return FMath::Clamp(1.0f - (DistanceFromCenter / 1000.0f), 0.0f, 1.0f); // Example scaling
+        return ResonanceField.Sample(Position);
+    }
+
+    virtual void SampleResonanceAt(TConstArrayView<FHexademic6DCoordinate> Positions, TArrayView<float> OutResonance) const override
+    {
+        ResonanceField.Sample(Positions, OutResonance);
     }
 
     virtual FVector6 GetResonanceGradient(const FHexademic6DCoordinate& Position) const override
     {
-        // Placeholder: Calculate the 6D gradient of the resonance field at a position.
-        // This indicates the direction of steepest increase in resonance.
+        // Direction of steepest increase in resonance, per lattice unit of Position's order.
         UE_LOG(LogHexademicLattice, Verbose, TEXT("ResonanceService: Calculating resonance gradient at coord (X=%d, Y=%d, Z=%d, W=%d, U=%d, V=%d)."), 
             Position.X, Position.Y, Position.Z, Position.W, Position.U, Position.V);
-        
-        // For demonstration, return a fixed or simple gradient
-        return FVector6(0.1f, 0.2f, -0.1f, 0.05f, 0.3f, -0.2f);
+        FVector6 Gradient;
+        ResonanceField.SampleGradient(Position, Gradient);
+        return Gradient;
+    }
+
+    virtual void GetResonanceGradient(TConstArrayView<FHexademic6DCoordinate> Positions, TArrayView<FVector6> OutGradients) const override
+    {
+        ResonanceField.SampleGradients(Positions, OutGradients);
     }
 
     virtual float CalculateCrossDimensionalResonance() const override
@@ -88,38 +118,57 @@ public:
 
     virtual TArray<FHexademic6DCoordinate> GetResonanceHotspots(ECognitiveLatticeOrder Order) const override
     {
-        // Placeholder: Identify areas in the lattice with unusually high resonance concentrations.
-        // This would involve spatial clustering or peak detection algorithms.
-        UE_LOG(LogHexademicLattice, Log, TEXT("ResonanceService: Getting resonance hotspots for Order %d."), (uint8)Order);
-        TArray<FHexademic6DCoordinate> Hotspots;
-        // Example: Add a few dummy hotspots
-        Hotspots.Add(FHexademic6DCoordinate()); // Default (0,0,0,0,0,0)
-        Hotspots.Add(FHexademic6DCoordinate(10,10,10,10,10,10, Order));
-        return Hotspots;
+        // Centroids of the most intense hotspots, up to Hexademic.Hotspots.MaxResults.
+        TArray<FHexademic6ResonanceHotspot> Hotspots;
+        GetResonanceHotspots(Order, -1, Hotspots);
+        TArray<FHexademic6DCoordinate> Centroids;
+        Centroids.Reserve(Hotspots.Num());
+        for (const FHexademic6ResonanceHotspot& Hotspot : Hotspots)
+        {
+            Centroids.Add(Hotspot.Centroid);
+        }
+        return Centroids;
+    }
+
+    virtual void GetResonanceHotspots(ECognitiveLatticeOrder Order, int32 MaxHotspots, TArray<FHexademic6ResonanceHotspot>& OutHotspots) const override
+    {
+        // Dense regions of the resonance field, most intense first. Only the voxels changed by
+        // updates since the last query are re-clustered.
+        HotspotDetector.FindHotspots(ResonanceField, Order, MaxHotspots, OutHotspots);
+        UE_LOG(LogHexademicLattice, Verbose, TEXT("ResonanceService: Found %d resonance hotspots for Order %d."), OutHotspots.Num(), (uint8)Order);
     }
 
     virtual void PropagateResonanceWave(const FHexademic6DCoordinate& Origin, float Amplitude) override
     {
-        // Placeholder: Simulate a resonance wave propagating from an origin point through the lattice.
-        // This could affect memory resonance values dynamically.
-        UE_LOG(LogHexademicLattice, Log, TEXT("ResonanceService: Propagating resonance wave from (X=%d, Y=%d, Z=%d, W=%d, U=%d, V=%d) with amplitude %f."), 
+        // Queued; the wave spreads through the store over the following TickResonanceWaves calls,
+        // together with every other wave queued before the next one.
+        UE_LOG(LogHexademicLattice, Verbose, TEXT("ResonanceService: Propagating resonance wave from (X=%d, Y=%d, Z=%d, W=%d, U=%d, V=%d) with amplitude %f."), 
             Origin.X, Origin.Y, Origin.Z, Origin.W, Origin.U, Origin.V, Amplitude);
-        // Effects of propagation would be implemented here.
+        WaveEngine.Enqueue(Origin, Amplitude);
+    }
+
+    virtual void TickResonanceWaves(FHexademic6LatticeStore& Store, double BudgetMicroseconds) override
+    {
+        WaveEngine.Tick(Store, BudgetMicroseconds);
+    }
+
+    virtual void TrackLatticeCoherence(const FHexademic6LatticeStore* Store) override
+    {
+        // While tracked, coherence reads follow the store's running aggregates live. The store
+        // must outlive the tracking; pass null to fall back to the last update's values.
+        CoherenceSource = Store ? &Store->GetCoherence() : &SnapshotCoherence;
     }
 
     virtual float GetGlobalCoherence() const override
     {
-        // Returns the current global coherence value of the lattice.
-        return GlobalCoherenceValue;
+        // O(1): a sum over the per-order aggregates.
+        return CoherenceSource->GetGlobalCoherence();
     }
 
     virtual float GetOrderCoherence(ECognitiveLatticeOrder Order) const override
     {
-        // Placeholder: Calculates coherence for a specific lattice order.
-        // This might involve querying the cognitive lattice service for memories in that order.
-        UE_LOG(LogHexademicLattice, Log, TEXT("ResonanceService: Getting coherence for Order %d. (Placeholder)"), (uint8)Order);
-        // Example: Return global coherence for simplicity, or query actual data if services were linked
-        return GlobalCoherenceValue; 
+        // Mean influence of the order's memories.
+        return (int32)Order < FHexademic6OrderIndexing::NumOrders ? CoherenceSource->GetOrderCoherence(Order) : 0.0f;
     }
 
     virtual void SubscribeToCoherenceUpdates(TFunction<void(float)> Callback) override
@@ -129,7 +178,21 @@ public:
     }
 
 private:
-    float GlobalCoherenceValue;
+    void NotifyCoherenceSubscribers()
+    {
+        const float GlobalCoherence = GetGlobalCoherence();
+        // Notify subscribers
+        for (TFunction<void(float)> Callback : CoherenceUpdateCallbacks)
+        {
+            Callback(GlobalCoherence);
+        }
+    }
+
+    FHexademic6CoherenceAggregates SnapshotCoherence; // Coherence as of the last update
+    const FHexademic6CoherenceAggregates* CoherenceSource = &SnapshotCoherence;
+    FHexademic6ResonanceField ResonanceField; // Influence of every memory seen by the last update
+    FHexademic6WaveEngine WaveEngine;
+    mutable FHexademic6HotspotDetector HotspotDetector; // Catches up with the field when queried
     TArray<TFunction<void(float)>> CoherenceUpdateCallbacks;
 };
 
@@ -0,0 +1,268 @@
+// Hexademic6SegmentFile.cpp
+// Segment writing, mapping and in-place lookup.
+
+#include "Hexademic6SegmentFile.h"
+#include "Hexademic6RecordCodec.h"    // For FHexademic6RecordFrameHeader::CurrentVersion
+#include "Algo/BinarySearch.h"        // For Algo::LowerBoundBy
+#include "Async/MappedFileHandle.h"   // For IMappedFileHandle, IMappedFileRegion
+#include "HAL/PlatformFileManager.h"  // For FPlatformFileManager
+#include "HAL/PlatformTime.h"         // For FPlatformTime::Seconds()
+#include "Logging/LogMacros.h"        // For UE_LOG
+#include "Misc/Crc.h"                 // For FCrc::MemCrc32
+
+namespace Hexademic6SegmentFilePrivate
+{
+    FORCEINLINE uint64 AlignToPage(uint64 Offset, uint32 PageSize)
+    {
+        return Align(Offset, (uint64)PageSize);
+    }
+
+    bool WriteBytes(IFileHandle& File, const void* Bytes, int64 Size)
+    {
+        return Size == 0 || File.Write(static_cast<const uint8*>(Bytes), Size);
+    }
+
+    bool PadTo(IFileHandle& File, uint64 Offset)
+    {
+        static const uint8 Zeros[4096] = {};
+        for (int64 Remaining = (int64)Offset - File.Tell(); Remaining > 0; Remaining -= sizeof(Zeros))
+        {
+            if (!File.Write(Zeros, FMath::Min<int64>(Remaining, sizeof(Zeros))))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Large indices exceed the int32 length FCrc takes, so the CRC is chained over chunks.
+    uint32 ComputeIndexCrc(const void* Index, uint64 Size)
+    {
+        constexpr uint64 ChunkSize = 1ull << 30;
+        uint32 Crc = 0;
+        for (uint64 Offset = 0; Offset < Size; Offset += ChunkSize)
+        {
+            Crc = FCrc::MemCrc32(static_cast<const uint8*>(Index) + Offset, (int32)FMath::Min(ChunkSize, Size - Offset), Crc);
+        }
+        return Crc;
+    }
+
+    uint32 ComputeHeaderCrc(const FHexademic6SegmentHeader& Header)
+    {
+        return FCrc::MemCrc32(&Header, STRUCT_OFFSET(FHexademic6SegmentHeader, HeaderCrc));
+    }
+}
+
+FHexademic6Segment::~FHexademic6Segment()
+{
+    // The region must be unmapped before its file handle is closed.
+    MappedRegion.Reset();
+    MappedFile.Reset();
+}
+
+// =============================================================================
+// WRITING
+// =============================================================================
+
+bool FHexademic6Segment::Write(const FString& Path, TArrayView<FHexademic6SegmentRecordSource> Records, const TMap<uint32, TArray<uint8>>& Dictionaries)
+{
+    using namespace Hexademic6SegmentFilePrivate;
+    const double StartTime = FPlatformTime::Seconds();
+
+    Records.Sort([](const FHexademic6SegmentRecordSource& A, const FHexademic6SegmentRecordSource& B) { return A.Key < B.Key; });
+
+    FHexademic6SegmentHeader Header;
+    Header.RecordVersion = FHexademic6RecordFrameHeader::CurrentVersion;
+    Header.NumEntries = (uint64)Records.Num();
+
+    TArray<FHexademic6SegmentEntry> Entries;
+    Entries.SetNum(Records.Num());
+    uint64 DataSize = 0;
+    for (int32 RecordIndex = 0; RecordIndex < Records.Num(); ++RecordIndex)
+    {
+        const FHexademic6SegmentRecordSource& Source = Records[RecordIndex];
+        if (RecordIndex > 0 && !(Records[RecordIndex - 1].Key < Source.Key))
+        {
+            UE_LOG(LogHexademicLattice, Error, TEXT("Segment %s: duplicate key %s."), *Path, *Source.Key.ToDecimalString());
+            return false;
+        }
+        FHexademic6SegmentEntry& Entry = Entries[RecordIndex];
+        Entry.SetKey(Source.Key);
+        Entry.Order = (uint8)Source.Order;
+        Entry.Length = (uint32)Source.Record.Num();
+        Entry.Offset = DataSize;
+        Entry.MemoryID = Source.MemoryID;
+        DataSize += Entry.Length;
+    }
+
+    TArray<uint8> DictionaryBytes;
+    for (const TPair<uint32, TArray<uint8>>& Pair : Dictionaries)
+    {
+        const uint32 Size = (uint32)Pair.Value.Num();
+        DictionaryBytes.Append(reinterpret_cast<const uint8*>(&Pair.Key), sizeof(uint32));
+        DictionaryBytes.Append(reinterpret_cast<const uint8*>(&Size), sizeof(uint32));
+        DictionaryBytes.Append(Pair.Value);
+    }
+
+    const uint64 IndexSize = (uint64)Entries.Num() * sizeof(FHexademic6SegmentEntry);
+    Header.IndexOffset = AlignToPage(sizeof(FHexademic6SegmentHeader), Header.PageSize);
+    Header.DictionaryOffset = AlignToPage(Header.IndexOffset + IndexSize, Header.PageSize);
+    Header.DictionarySize = (uint64)DictionaryBytes.Num();
+    Header.DataOffset = AlignToPage(Header.DictionaryOffset + Header.DictionarySize, Header.PageSize);
+    Header.DataSize = DataSize;
+    Header.IndexCrc = ComputeIndexCrc(Entries.GetData(), IndexSize);
+    Header.HeaderCrc = ComputeHeaderCrc(Header);
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    const FString TempPath = Path + TEXT(".tmp");
+    bool bWritten = false;
+    {
+        TUniquePtr<IFileHandle> File(PlatformFile.OpenWrite(*TempPath));
+        if (File)
+        {
+            bWritten = WriteBytes(*File, &Header, sizeof(Header))
+                && PadTo(*File, Header.IndexOffset) && WriteBytes(*File, Entries.GetData(), (int64)IndexSize)
+                && PadTo(*File, Header.DictionaryOffset) && WriteBytes(*File, DictionaryBytes.GetData(), DictionaryBytes.Num())
+                && PadTo(*File, Header.DataOffset);
+            for (int32 RecordIndex = 0; bWritten && RecordIndex < Records.Num(); ++RecordIndex)
+            {
+                bWritten = WriteBytes(*File, Records[RecordIndex].Record.GetData(), Records[RecordIndex].Record.Num());
+            }
+            bWritten = bWritten && File->Flush(true);
+        }
+    }
+
+    if (!bWritten)
+    {
+        PlatformFile.DeleteFile(*TempPath);
+    }
+    if (!bWritten || !ReplaceFile(Path, TempPath))
+    {
+        UE_LOG(LogHexademicLattice, Error, TEXT("Failed to write segment %s."), *Path);
+        return false;
+    }
+    UE_LOG(LogHexademicLattice, Log, TEXT("Wrote segment %s: %d records, %llu data bytes in %.1f ms."),
+        *Path, Records.Num(), DataSize, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return true;
+}
+
+bool FHexademic6Segment::ReplaceFile(const FString& Path, const FString& TempPath)
+{
+    // POSIX rename replaces atomically; the backup dance is only for platforms where it refuses.
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (PlatformFile.MoveFile(*Path, *TempPath))
+    {
+        return true;
+    }
+    if (PlatformFile.FileExists(*Path))
+    {
+        const FString BackupPath = Path + BackupSuffix;
+        PlatformFile.DeleteFile(*BackupPath); // Left over from an earlier interrupted replace; Path is newer
+        if (PlatformFile.MoveFile(*BackupPath, *Path))
+        {
+            if (PlatformFile.MoveFile(*Path, *TempPath))
+            {
+                PlatformFile.DeleteFile(*BackupPath);
+                return true;
+            }
+            PlatformFile.MoveFile(*Path, *BackupPath);
+        }
+    }
+    PlatformFile.DeleteFile(*TempPath);
+    return false;
+}
+
+// =============================================================================
+// MAPPING AND LOOKUP
+// =============================================================================
+
+TUniquePtr<FHexademic6Segment> FHexademic6Segment::Open(const FString& Path, bool bVerifyIndex)
+{
+    using namespace Hexademic6SegmentFilePrivate;
+    const double StartTime = FPlatformTime::Seconds();
+
+    TUniquePtr<FHexademic6Segment> Segment(new FHexademic6Segment());
+    Segment->Path = Path;
+    Segment->MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+    if (!Segment->MappedFile)
+    {
+        UE_LOG(LogHexademicLattice, Error, TEXT("Segment %s could not be opened for mapping."), *Path);
+        return nullptr;
+    }
+    const int64 FileSize = Segment->MappedFile->GetFileSize();
+    if (FileSize < (int64)sizeof(FHexademic6SegmentHeader))
+    {
+        UE_LOG(LogHexademicLattice, Error, TEXT("Segment %s is truncated."), *Path);
+        return nullptr;
+    }
+    Segment->MappedRegion.Reset(Segment->MappedFile->MapRegion(0, FileSize));
+    if (!Segment->MappedRegion)
+    {
+        UE_LOG(LogHexademicLattice, Error, TEXT("Segment %s could not be mapped."), *Path);
+        return nullptr;
+    }
+
+    const uint8* Base = Segment->MappedRegion->GetMappedPtr();
+    FHexademic6SegmentHeader Header;
+    FMemory::Memcpy(&Header, Base, sizeof(Header));
+    const uint64 IndexSize = Header.NumEntries * sizeof(FHexademic6SegmentEntry);
+    const bool bHeaderValid = Header.Magic == FHexademic6SegmentHeader::ExpectedMagic
+        && Header.Version == FHexademic6SegmentHeader::CurrentVersion
+        && Header.RecordVersion == FHexademic6RecordFrameHeader::CurrentVersion
+        && Header.HeaderCrc == ComputeHeaderCrc(Header)
+        && Header.NumEntries <= (uint64)MAX_int32
+        && Header.IndexOffset % alignof(FHexademic6SegmentEntry) == 0
+        && Header.IndexOffset + IndexSize <= Header.DictionaryOffset
+        && Header.DictionaryOffset + Header.DictionarySize <= Header.DataOffset
+        && Header.DataOffset + Header.DataSize <= (uint64)FileSize;
+    if (!bHeaderValid)
+    {
+        UE_LOG(LogHexademicLattice, Error, TEXT("Segment %s has an invalid or incompatible header."), *Path);
+        return nullptr;
+    }
+
+    Segment->Entries = TConstArrayView<FHexademic6SegmentEntry>(reinterpret_cast<const FHexademic6SegmentEntry*>(Base + Header.IndexOffset), (int32)Header.NumEntries);
+    Segment->Dictionaries = TConstArrayView<uint8>(Base + Header.DictionaryOffset, (int32)Header.DictionarySize);
+    Segment->Data = Base + Header.DataOffset;
+    Segment->DataSize = Header.DataSize;
+
+    if (bVerifyIndex && ComputeIndexCrc(Segment->Entries.GetData(), IndexSize) != Header.IndexCrc)
+    {
+        UE_LOG(LogHexademicLattice, Error, TEXT("Segment %s failed index verification."), *Path);
+        return nullptr;
+    }
+
+    UE_LOG(LogHexademicLattice, Log, TEXT("Mapped segment %s: %d records in %.2f ms."), *Path, Segment->Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return Segment;
+}
+
+int32 FHexademic6Segment::LowerBound(const FDUIDSIndex& Key) const
+{
+    return Algo::LowerBoundBy(Entries, Key, [](const FHexademic6SegmentEntry& Entry) { return Entry.GetKey(); });
+}
+
+const FHexademic6SegmentEntry* FHexademic6Segment::FindEntry(const FDUIDSIndex& Key) const
+{
+    const int32 EntryIndex = LowerBound(Key);
+    return EntryIndex < Entries.Num() && Entries[EntryIndex].GetKey() == Key ? &Entries[EntryIndex] : nullptr;
+}
+
+void FHexademic6Segment::ForEachDictionary(TFunctionRef<void(uint32 DictionaryId, TConstArrayView<uint8> Dictionary)> Visitor) const
+{
+    int32 Offset = 0;
+    while (Offset + 8 <= Dictionaries.Num())
+    {
+        uint32 DictionaryId;
+        uint32 Size;
+        FMemory::Memcpy(&DictionaryId, Dictionaries.GetData() + Offset, sizeof(uint32));
+        FMemory::Memcpy(&Size, Dictionaries.GetData() + Offset + 4, sizeof(uint32));
+        Offset += 8;
+        if ((int64)Offset + Size > Dictionaries.Num())
+        {
+            UE_LOG(LogHexademicLattice, Error, TEXT("Segment %s has a truncated dictionary section."), *Path);
+            return;
+        }
+        Visitor(DictionaryId, TConstArrayView<uint8>(Dictionaries.GetData() + Offset, (int32)Size));
+        Offset += (int32)Size;
+    }
+}
@@ -0,0 +1,354 @@
+// Hexademic6SpatialIndex.cpp
+// Grid-hash implementation of the per-order 6D spatial index.
+
+#include "Hexademic6SpatialIndex.h"
+#include "HexademicSixLattice.h"
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::GetExtent
+#include "HAL/IConsoleManager.h" // For TAutoConsoleVariable
+#include "Logging/LogMacros.h" // For UE_LOG
+
+static TAutoConsoleVariable<int32> CVarHexademicSpatialExpectedMemoriesPerOrder(
+    TEXT("Hexademic.Spatial.ExpectedMemoriesPerOrder"),
+    262144,
+    TEXT("Expected number of memories in one lattice order. Sizes the spatial grid cells so about one memory falls in each cell when spread evenly. Read when a grid is created."),
+    ECVF_ReadOnly);
+
+namespace Hexademic6SpatialIndexPrivate
+{
+    FORCEINLINE int32 FloorDiv(int32 Value, int32 Divisor)
+    {
+        const int32 Quotient = Value / Divisor;
+        return (Value % Divisor != 0 && Value < 0) ? Quotient - 1 : Quotient;
+    }
+
+    // Number of cells in the box. Boxes wider than the 10-bit key space on any axis would
+    // alias buckets, so they report as unbounded and the caller scans instead.
+    FORCEINLINE int64 CellCount(const int32 (&MinCell)[6], const int32 (&MaxCell)[6])
+    {
+        int64 Count = 1;
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            const int64 Span = static_cast<int64>(MaxCell[Axis]) - MinCell[Axis] + 1;
+            Count *= Span;
+            if (Span > 1024 || Count > MAX_int32)
+            {
+                return MAX_int32;
+            }
+        }
+        return Count;
+    }
+
+    // Max-heap on distance so the current K-th best sits at the top.
+    using FCandidate = TPair<int64, int32>;
+    struct FFartherFirst
+    {
+        FORCEINLINE bool operator()(const FCandidate& A, const FCandidate& B) const { return A.Key > B.Key; }
+    };
+}
+
+// =============================================================================
+// FHexademic6SpatialIndex
+// =============================================================================
+
+FHexademic6SpatialIndex::FHexademic6SpatialIndex(int32 InCellSize)
+    : CellSize(FMath::Max(1, InCellSize))
+{
+}
+
+int32 FHexademic6SpatialIndex::GetDefaultCellSize(ECognitiveLatticeOrder Order)
+{
+    return GetDefaultCellSize(Order, CVarHexademicSpatialExpectedMemoriesPerOrder.GetValueOnAnyThread());
+}
+
+int32 FHexademic6SpatialIndex::GetDefaultCellSize(ECognitiveLatticeOrder Order, int32 ExpectedMemories)
+{
+    // One memory per cell on average: (AxisSpan / CellSize)^6 = ExpectedMemories. Past 1024 cells
+    // per axis the packed cell keys would alias, which gains nothing.
+    const int64 AxisSpan = 2 * static_cast<int64>(FHexademic6OrderIndexing::GetExtent(Order)) - 1;
+    const double CellsPerAxis = FMath::Clamp(FMath::Pow(static_cast<double>(FMath::Max(1, ExpectedMemories)), 1.0 / 6.0), 1.0, 1024.0);
+    return static_cast<int32>(FMath::Clamp<int64>(FMath::CeilToInt64(AxisSpan / CellsPerAxis), 1, MAX_int32));
+}
+
+int32 FHexademic6SpatialIndex::Add(const FHexademic6DCoordinate& Position, const FGuid& MemoryID)
+{
+    const int32 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+    FEntry& Entry = Entries[Slot];
+    Entry.Position = Position;
+    Entry.MemoryID = MemoryID;
+    Entry.bAlive = true;
+    LinkToCell(Slot);
+    ++NumAlive;
+    return Slot;
+}
+
+void FHexademic6SpatialIndex::Update(int32 Slot, const FHexademic6DCoordinate& NewPosition)
+{
+    check(IsValidSlot(Slot));
+    int32 NewCell[6];
+    ComputeCell(NewPosition, NewCell);
+    const uint64 NewKey = PackCellKey(NewCell);
+    if (NewKey != Entries[Slot].CellKey)
+    {
+        UnlinkFromCell(Slot);
+        Entries[Slot].Position = NewPosition;
+        LinkToCell(Slot);
+    }
+    else
+    {
+        Entries[Slot].Position = NewPosition;
+    }
+}
+
+void FHexademic6SpatialIndex::Remove(int32 Slot)
+{
+    if (!IsValidSlot(Slot))
+    {
+        return;
+    }
+    UnlinkFromCell(Slot);
+    Entries[Slot].bAlive = false;
+    FreeSlots.Add(Slot);
+    --NumAlive;
+}
+
+void FHexademic6SpatialIndex::Empty()
+{
+    Entries.Empty();
+    FreeSlots.Empty();
+    Cells.Empty();
+    NumAlive = 0;
+}
+
+int64 FHexademic6SpatialIndex::DistanceSquared(const FHexademic6DCoordinate& A, const FHexademic6DCoordinate& B)
+{
+    const int64 DX = (int64)A.X - B.X, DY = (int64)A.Y - B.Y, DZ = (int64)A.Z - B.Z;
+    const int64 DW = (int64)A.W - B.W, DU = (int64)A.U - B.U, DV = (int64)A.V - B.V;
+    return DX * DX + DY * DY + DZ * DZ + DW * DW + DU * DU + DV * DV;
+}
+
+void FHexademic6SpatialIndex::ComputeCell(const FHexademic6DCoordinate& Position, int32 (&OutCell)[6]) const
+{
+    using namespace Hexademic6SpatialIndexPrivate;
+    OutCell[0] = FloorDiv(Position.X, CellSize);
+    OutCell[1] = FloorDiv(Position.Y, CellSize);
+    OutCell[2] = FloorDiv(Position.Z, CellSize);
+    OutCell[3] = FloorDiv(Position.W, CellSize);
+    OutCell[4] = FloorDiv(Position.U, CellSize);
+    OutCell[5] = FloorDiv(Position.V, CellSize);
+}
+
+uint64 FHexademic6SpatialIndex::PackCellKey(const int32 (&Cell)[6])
+{
+    // 10 bits per axis. Far-apart cells may share a bucket; queries always check distances.
+    uint64 Key = 0;
+    for (int32 Axis = 0; Axis < 6; ++Axis)
+    {
+        Key |= static_cast<uint64>(static_cast<uint32>(Cell[Axis]) & 0x3FFu) << (Axis * 10);
+    }
+    return Key;
+}
+
+void FHexademic6SpatialIndex::LinkToCell(int32 Slot)
+{
+    FEntry& Entry = Entries[Slot];
+    int32 Cell[6];
+    ComputeCell(Entry.Position, Cell);
+    Entry.CellKey = PackCellKey(Cell);
+    TArray<int32>& Members = Cells.FindOrAdd(Entry.CellKey);
+    Entry.SlotInCell = Members.Add(Slot);
+}
+
+void FHexademic6SpatialIndex::UnlinkFromCell(int32 Slot)
+{
+    FEntry& Entry = Entries[Slot];
+    TArray<int32>* Members = Cells.Find(Entry.CellKey);
+    if (!Members)
+    {
+        return;
+    }
+    // Swap-remove and patch the back-pointer of the member that moved.
+    const int32 LastSlot = Members->Last();
+    (*Members)[Entry.SlotInCell] = LastSlot;
+    Entries[LastSlot].SlotInCell = Entry.SlotInCell;
+    Members->Pop(EAllowShrinking::No);
+    if (Members->Num() == 0)
+    {
+        Cells.Remove(Entry.CellKey);
+    }
+    Entry.SlotInCell = INDEX_NONE;
+}
+
+template<typename VisitorType>
+void FHexademic6SpatialIndex::ForEachCell(const int32 (&MinCell)[6], const int32 (&MaxCell)[6], const int32 (&CenterCell)[6], int32 ShellRadius, VisitorType&& Visitor) const
+{
+    int32 Cursor[6];
+    FMemory::Memcpy(Cursor, MinCell, sizeof(Cursor));
+    for (;;)
+    {
+        bool bVisit = true;
+        if (ShellRadius > 0)
+        {
+            int32 Chebyshev = 0;
+            for (int32 Axis = 0; Axis < 6; ++Axis)
+            {
+                Chebyshev = FMath::Max(Chebyshev, FMath::Abs(Cursor[Axis] - CenterCell[Axis]));
+            }
+            bVisit = Chebyshev == ShellRadius;
+        }
+        if (bVisit)
+        {
+            if (const TArray<int32>* Members = Cells.Find(PackCellKey(Cursor)))
+            {
+                Visitor(*Members);
+            }
+        }
+
+        // Odometer increment over the six axes.
+        int32 Axis = 0;
+        for (; Axis < 6; ++Axis)
+        {
+            if (++Cursor[Axis] <= MaxCell[Axis])
+            {
+                break;
+            }
+            Cursor[Axis] = MinCell[Axis];
+        }
+        if (Axis == 6)
+        {
+            return;
+        }
+    }
+}
+
+void FHexademic6SpatialIndex::QueryRadius(const FHexademic6DCoordinate& Center, float Radius, TArray<int32>& OutSlots) const
+{
+    using namespace Hexademic6SpatialIndexPrivate;
+    if (NumAlive == 0 || Radius < 0.0f)
+    {
+        return;
+    }
+
+    const double RadiusSquared = (double)Radius * Radius;
+    const int32 Reach = FMath::CeilToInt(Radius);
+    int32 CenterCell[6];
+    ComputeCell(Center, CenterCell);
+    int32 MinCell[6];
+    int32 MaxCell[6];
+    const int32 CenterAxes[6] = { Center.X, Center.Y, Center.Z, Center.W, Center.U, Center.V };
+    for (int32 Axis = 0; Axis < 6; ++Axis)
+    {
+        MinCell[Axis] = FloorDiv(CenterAxes[Axis] - Reach, CellSize);
+        MaxCell[Axis] = FloorDiv(CenterAxes[Axis] + Reach, CellSize);
+    }
+
+    auto TestSlot = [this, &Center, RadiusSquared, &OutSlots](int32 Slot)
+    {
+        if ((double)DistanceSquared(Entries[Slot].Position, Center) <= RadiusSquared)
+        {
+            OutSlots.Add(Slot);
+        }
+    };
+
+    if (CellCount(MinCell, MaxCell) > NumAlive)
+    {
+        for (int32 Slot = 0; Slot < Entries.Num(); ++Slot)
+        {
+            if (Entries[Slot].bAlive)
+            {
+                TestSlot(Slot);
+            }
+        }
+        return;
+    }
+
+    ForEachCell(MinCell, MaxCell, CenterCell, -1, [&TestSlot](const TArray<int32>& Members)
+    {
+        for (int32 Slot : Members)
+        {
+            TestSlot(Slot);
+        }
+    });
+}
+
+void FHexademic6SpatialIndex::QueryKNearest(const FHexademic6DCoordinate& Center, int32 K, TArray<int32>& OutSlots, const FGuid& ExcludeID) const
+{
+    using namespace Hexademic6SpatialIndexPrivate;
+    OutSlots.Reset();
+    if (K <= 0 || NumAlive == 0)
+    {
+        return;
+    }
+
+    TArray<FCandidate> Heap;
+    Heap.Reserve(K + 1);
+    auto Consider = [this, &Center, &ExcludeID, K, &Heap](int32 Slot)
+    {
+        const FEntry& Entry = Entries[Slot];
+        if (ExcludeID.IsValid() && Entry.MemoryID == ExcludeID)
+        {
+            return;
+        }
+        const int64 Distance = DistanceSquared(Entry.Position, Center);
+        if (Heap.Num() < K)
+        {
+            Heap.HeapPush(FCandidate(Distance, Slot), FFartherFirst());
+        }
+        else if (Distance < Heap.HeapTop().Key)
+        {
+            FCandidate Discarded;
+            Heap.HeapPop(Discarded, FFartherFirst(), EAllowShrinking::No);
+            Heap.HeapPush(FCandidate(Distance, Slot), FFartherFirst());
+        }
+    };
+
+    int32 CenterCell[6];
+    ComputeCell(Center, CenterCell);
+
+    // Grow a ring of cells around the center. After ring R every unvisited entry is at least
+    // R * CellSize away, so the search stops once the K-th best is closer than that.
+    bool bResolved = false;
+    for (int32 Ring = 0; !bResolved; ++Ring)
+    {
+        int32 MinCell[6];
+        int32 MaxCell[6];
+        for (int32 Axis = 0; Axis < 6; ++Axis)
+        {
+            MinCell[Axis] = CenterCell[Axis] - Ring;
+            MaxCell[Axis] = CenterCell[Axis] + Ring;
+        }
+        if (CellCount(MinCell, MaxCell) > NumAlive)
+        {
+            break; // Cheaper to finish with a scan.
+        }
+
+        ForEachCell(MinCell, MaxCell, CenterCell, Ring, [&Consider](const TArray<int32>& Members)
+        {
+            for (int32 Slot : Members)
+            {
+                Consider(Slot);
+            }
+        });
+
+        const int64 Bound = static_cast<int64>(Ring) * CellSize;
+        bResolved = Heap.Num() == K && Heap.HeapTop().Key <= Bound * Bound;
+    }
+
+    if (!bResolved)
+    {
+        Heap.Reset();
+        for (int32 Slot = 0; Slot < Entries.Num(); ++Slot)
+        {
+            if (Entries[Slot].bAlive)
+            {
+                Consider(Slot);
+            }
+        }
+    }
+
+    Heap.Sort([](const FCandidate& A, const FCandidate& B) { return A.Key < B.Key; });
+    OutSlots.Reserve(Heap.Num());
+    for (const FCandidate& Candidate : Heap)
+    {
+        OutSlots.Add(Candidate.Value);
+    }
+}
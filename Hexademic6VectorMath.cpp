@@ -0,0 +1,217 @@
+// Hexademic6VectorMath.cpp
+// Vectorized FVector6Batch kernels with a scalar tail and fallback.
+
+#include "Hexademic6VectorMath.h"
+#include "Math/VectorRegister.h" // For VectorRegister4Float and friends
+
+namespace Hexademic6VectorMathPrivate
+{
+    FORCEINLINE void CheckSameNum(const FVector6Batch& A, const FVector6Batch& B)
+    {
+        check(A.Num() == B.Num());
+    }
+
+    // Applies a lane-wise binary op to every axis; Index tracks how far the vector loop got.
+    template<typename VectorOpType, typename ScalarOpType>
+    void BinaryOp(const FVector6Batch& A, const FVector6Batch& B, FVector6Batch& Out, VectorOpType&& VectorOp, ScalarOpType&& ScalarOp)
+    {
+        CheckSameNum(A, B);
+        CheckSameNum(A, Out);
+        const int32 Num = A.Num();
+        for (int32 AxisIndex = 0; AxisIndex < 6; ++AxisIndex)
+        {
+            const float* PA = A.Axes[AxisIndex].GetData();
+            const float* PB = B.Axes[AxisIndex].GetData();
+            float* POut = Out.Axes[AxisIndex].GetData();
+            int32 Index = 0;
+#if HEXADEMIC6_VECTOR_KERNELS
+            for (; Index + 4 <= Num; Index += 4)
+            {
+                VectorStore(VectorOp(VectorLoad(PA + Index), VectorLoad(PB + Index)), POut + Index);
+            }
+#endif
+            for (; Index < Num; ++Index)
+            {
+                POut[Index] = ScalarOp(PA[Index], PB[Index]);
+            }
+        }
+    }
+
+    // Sum over axes of A[axis] * B[axis] - the shared core of Dot, SizeSquared and the distances.
+    // When bSubtractPoint is set, B is ignored and (A - Point) is squared instead.
+    template<bool bSubtractPoint>
+    void SumOfProducts(const FVector6Batch& A, const FVector6Batch* B, const FVector6& Point, TArrayView<float> Out)
+    {
+        const int32 Num = A.Num();
+        check(Out.Num() >= Num);
+        const FVector6Batch& Rhs = B ? *B : A;
+        float* POut = Out.GetData();
+        int32 Index = 0;
+#if HEXADEMIC6_VECTOR_KERNELS
+        VectorRegister4Float PointLanes[6];
+        for (int32 AxisIndex = 0; AxisIndex < 6; ++AxisIndex)
+        {
+            PointLanes[AxisIndex] = VectorSetFloat1(Point[AxisIndex]);
+        }
+        for (; Index + 4 <= Num; Index += 4)
+        {
+            VectorRegister4Float Sum = VectorZeroFloat();
+            for (int32 AxisIndex = 0; AxisIndex < 6; ++AxisIndex)
+            {
+                VectorRegister4Float LaneA = VectorLoad(A.Axes[AxisIndex].GetData() + Index);
+                if (bSubtractPoint)
+                {
+                    LaneA = VectorSubtract(LaneA, PointLanes[AxisIndex]);
+                    Sum = VectorMultiplyAdd(LaneA, LaneA, Sum);
+                }
+                else
+                {
+                    Sum = VectorMultiplyAdd(LaneA, VectorLoad(Rhs.Axes[AxisIndex].GetData() + Index), Sum);
+                }
+            }
+            VectorStore(Sum, POut + Index);
+        }
+#endif
+        for (; Index < Num; ++Index)
+        {
+            float Sum = 0.0f;
+            for (int32 AxisIndex = 0; AxisIndex < 6; ++AxisIndex)
+            {
+                if (bSubtractPoint)
+                {
+                    const float Delta = A.Axes[AxisIndex][Index] - Point[AxisIndex];
+                    Sum += Delta * Delta;
+                }
+                else
+                {
+                    Sum += A.Axes[AxisIndex][Index] * Rhs.Axes[AxisIndex][Index];
+                }
+            }
+            POut[Index] = Sum;
+        }
+    }
+
+    void SqrtInPlace(float* Values, int32 Num)
+    {
+        int32 Index = 0;
+#if HEXADEMIC6_VECTOR_KERNELS
+        for (; Index + 4 <= Num; Index += 4)
+        {
+            VectorStore(VectorSqrt(VectorLoad(Values + Index)), Values + Index);
+        }
+#endif
+        for (; Index < Num; ++Index)
+        {
+            Values[Index] = FMath::Sqrt(Values[Index]);
+        }
+    }
+}
+
+void FHexademic6VectorMath::Add(const FVector6Batch& A, const FVector6Batch& B, FVector6Batch& Out)
+{
+    Hexademic6VectorMathPrivate::BinaryOp(A, B, Out,
+        [](VectorRegister4Float L, VectorRegister4Float R) { return VectorAdd(L, R); },
+        [](float L, float R) { return L + R; });
+}
+
+void FHexademic6VectorMath::Subtract(const FVector6Batch& A, const FVector6Batch& B, FVector6Batch& Out)
+{
+    Hexademic6VectorMathPrivate::BinaryOp(A, B, Out,
+        [](VectorRegister4Float L, VectorRegister4Float R) { return VectorSubtract(L, R); },
+        [](float L, float R) { return L - R; });
+}
+
+void FHexademic6VectorMath::Scale(const FVector6Batch& A, float Scalar, FVector6Batch& Out)
+{
+    check(A.Num() == Out.Num());
+    const int32 Num = A.Num();
+#if HEXADEMIC6_VECTOR_KERNELS
+    const VectorRegister4Float ScalarLanes = VectorSetFloat1(Scalar);
+#endif
+    for (int32 AxisIndex = 0; AxisIndex < 6; ++AxisIndex)
+    {
+        const float* PA = A.Axes[AxisIndex].GetData();
+        float* POut = Out.Axes[AxisIndex].GetData();
+        int32 Index = 0;
+#if HEXADEMIC6_VECTOR_KERNELS
+        for (; Index + 4 <= Num; Index += 4)
+        {
+            VectorStore(VectorMultiply(VectorLoad(PA + Index), ScalarLanes), POut + Index);
+        }
+#endif
+        for (; Index < Num; ++Index)
+        {
+            POut[Index] = PA[Index] * Scalar;
+        }
+    }
+}
+
+void FHexademic6VectorMath::Dot(const FVector6Batch& A, const FVector6Batch& B, TArrayView<float> OutDots)
+{
+    check(A.Num() == B.Num());
+    Hexademic6VectorMathPrivate::SumOfProducts<false>(A, &B, FVector6(), OutDots);
+}
+
+void FHexademic6VectorMath::SizeSquared(const FVector6Batch& A, TArrayView<float> OutSizes)
+{
+    Hexademic6VectorMathPrivate::SumOfProducts<false>(A, nullptr, FVector6(), OutSizes);
+}
+
+void FHexademic6VectorMath::Size(const FVector6Batch& A, TArrayView<float> OutSizes)
+{
+    SizeSquared(A, OutSizes);
+    Hexademic6VectorMathPrivate::SqrtInPlace(OutSizes.GetData(), A.Num());
+}
+
+void FHexademic6VectorMath::Normalize(const FVector6Batch& A, FVector6Batch& Out, float Tolerance)
+{
+    check(A.Num() == Out.Num());
+    const int32 Num = A.Num();
+    TArray<float, TInlineAllocator<256>> Scales;
+    Scales.SetNumUninitialized(Num);
+    Size(A, Scales);
+
+    // Turn lengths into per-vector scale factors, zero for degenerate vectors.
+    int32 Index = 0;
+#if HEXADEMIC6_VECTOR_KERNELS
+    const VectorRegister4Float ToleranceLanes = VectorSetFloat1(Tolerance);
+    for (; Index + 4 <= Num; Index += 4)
+    {
+        const VectorRegister4Float Lengths = VectorLoad(Scales.GetData() + Index);
+        const VectorRegister4Float Mask = VectorCompareGT(Lengths, ToleranceLanes);
+        VectorStore(VectorSelect(Mask, VectorDivide(VectorOneFloat(), Lengths), VectorZeroFloat()), Scales.GetData() + Index);
+    }
+#endif
+    for (; Index < Num; ++Index)
+    {
+        Scales[Index] = Scales[Index] > Tolerance ? 1.0f / Scales[Index] : 0.0f;
+    }
+
+    for (int32 AxisIndex = 0; AxisIndex < 6; ++AxisIndex)
+    {
+        const float* PA = A.Axes[AxisIndex].GetData();
+        float* POut = Out.Axes[AxisIndex].GetData();
+        Index = 0;
+#if HEXADEMIC6_VECTOR_KERNELS
+        for (; Index + 4 <= Num; Index += 4)
+        {
+            VectorStore(VectorMultiply(VectorLoad(PA + Index), VectorLoad(Scales.GetData() + Index)), POut + Index);
+        }
+#endif
+        for (; Index < Num; ++Index)
+        {
+            POut[Index] = PA[Index] * Scales[Index];
+        }
+    }
+}
+
+void FHexademic6VectorMath::DistanceSquared(const FVector6Batch& A, const FVector6& Point, TArrayView<float> OutDistances)
+{
+    Hexademic6VectorMathPrivate::SumOfProducts<true>(A, nullptr, Point, OutDistances);
+}
+
+void FHexademic6VectorMath::Distance(const FVector6Batch& A, const FVector6& Point, TArrayView<float> OutDistances)
+{
+    DistanceSquared(A, Point, OutDistances);
+    Hexademic6VectorMathPrivate::SqrtInPlace(OutDistances.GetData(), A.Num());
+}
@@ -0,0 +1,294 @@
+// Hexademic6WaveEngine.cpp
+// Wave coalescing, parallel frontier expansion and budgeted resonance updates.
+
+#include "Hexademic6WaveEngine.h"
+#include "Hexademic6FrameBudget.h"   // For FHexademic6FrameBudget
+#include "Hexademic6LatticeStore.h"  // For FHexademic6LatticeStore
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::GetExtent
+#include "Async/ParallelFor.h"       // For ParallelFor
+#include "HAL/IConsoleManager.h"     // For TAutoConsoleVariable
+#include "Misc/ScopeLock.h"          // For FScopeLock
+#include "Logging/LogMacros.h"       // For UE_LOG
+
+static TAutoConsoleVariable<float> CVarHexademicWavesFrameBudgetMicroseconds(
+    TEXT("Hexademic.Waves.FrameBudgetMicroseconds"),
+    250.0f,
+    TEXT("Time a wave engine tick may spend expanding resonance wave frontiers."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicWavesChunkNodes(
+    TEXT("Hexademic.Waves.ChunkNodes"),
+    256,
+    TEXT("Frontier nodes expanded per chunk; the unit in which propagation is fitted into the frame budget."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicWavesNeighborsPerNode(
+    TEXT("Hexademic.Waves.NeighborsPerNode"),
+    12,
+    TEXT("Nearest lattice neighbors a wave spreads to from each node it reaches, and seeds at its origin."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarHexademicWavesHopDecay(
+    TEXT("Hexademic.Waves.HopDecay"),
+    0.6f,
+    TEXT("Fraction of a wave's energy carried over each hop, before distance attenuation."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarHexademicWavesAttenuationLength(
+    TEXT("Hexademic.Waves.AttenuationLength"),
+    0.25f,
+    TEXT("Hop length, as a fraction of the order's extent, over which a wave's energy halves."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarHexademicWavesMinEnergy(
+    TEXT("Hexademic.Waves.MinEnergy"),
+    0.001f,
+    TEXT("Energy below which a wave front stops spreading."),
+    ECVF_Default);
+
+namespace Hexademic6WaveEnginePrivate
+{
+    // Starting chunk cost estimate, in microseconds, until the first measurement comes in.
+    constexpr double InitialChunkCost = 100.0;
+
+    // Chunks smaller than this are expanded on the calling thread.
+    constexpr int32 MinParallelFronts = 64;
+
+    FORCEINLINE uint64 GetNodeKey(const FHexademicNodeHandle& Handle)
+    {
+        return (static_cast<uint64>(Handle.Order) << 32) | static_cast<uint32>(Handle.Slot);
+    }
+
+    FORCEINLINE const FGuid& GetMemoryID(const FHexademic6LatticeStore& Store, const FHexademicNodeHandle& Handle)
+    {
+        return Store.GetColumns(Handle.Order).MemoryIDs[Store.GetRow(Handle)];
+    }
+
+    // Slots are reused as soon as a node is removed, so a handle taken in an earlier hop may name
+    // another memory by now; the front's memory id tells.
+    FORCEINLINE bool IsSameMemory(const FHexademic6LatticeStore& Store, const FHexademicNodeHandle& Handle, const FGuid& MemoryID)
+    {
+        return Store.IsValidHandle(Handle) && GetMemoryID(Store, Handle) == MemoryID;
+    }
+
+    FORCEINLINE FHexademic6DCoordinate GetPosition(const FHexademic6LatticeStore& Store, const FHexademicNodeHandle& Handle)
+    {
+        const FHexademic6OrderColumns& Columns = Store.GetColumns(Handle.Order);
+        const int32 Row = Store.GetRow(Handle);
+        return FHexademic6DCoordinate(Columns.X[Row], Columns.Y[Row], Columns.Z[Row], Columns.W[Row], Columns.U[Row], Columns.V[Row], Handle.Order);
+    }
+
+    FORCEINLINE float Distance(const FHexademic6DCoordinate& A, const FHexademic6DCoordinate& B)
+    {
+        const double Deltas[6] = { (double)A.X - B.X, (double)A.Y - B.Y, (double)A.Z - B.Z, (double)A.W - B.W, (double)A.U - B.U, (double)A.V - B.V };
+        double SizeSquared = 0.0;
+        for (const double Delta : Deltas)
+        {
+            SizeSquared += Delta * Delta;
+        }
+        return (float)FMath::Sqrt(SizeSquared);
+    }
+
+    // Share of energy left after a hop of HopLength in Order: one half at the attenuation length.
+    FORCEINLINE float GetFalloff(float HopLength, ECognitiveLatticeOrder Order, float AttenuationLength)
+    {
+        const float Length = FMath::Max(AttenuationLength * FHexademic6OrderIndexing::GetExtent(Order), 1.0f);
+        return 1.0f / (1.0f + HopLength / Length);
+    }
+}
+
+FHexademic6WaveEngine::FHexademic6WaveEngine()
+    : ChunkCost(Hexademic6WaveEnginePrivate::InitialChunkCost)
+{
+}
+
+void FHexademic6WaveEngine::Enqueue(const FHexademic6DCoordinate& Origin, float Amplitude)
+{
+    FScopeLock Lock(&PendingLock);
+    PendingWaves.Add({ Origin, Amplitude });
+    ++Stats.Waves;
+}
+
+void FHexademic6WaveEngine::Reset()
+{
+    {
+        FScopeLock Lock(&PendingLock);
+        PendingWaves.Reset();
+    }
+    Passes.Reset();
+    NextPass = 0;
+}
+
+FHexademic6WaveStats FHexademic6WaveEngine::GetStats() const
+{
+    FScopeLock Lock(&PendingLock);
+    FHexademic6WaveStats Result = Stats;
+    Result.ActivePasses = Passes.Num();
+    Result.FrontierNodes = 0;
+    for (const TUniquePtr<FPass>& Pass : Passes)
+    {
+        Result.FrontierNodes += Pass->Frontier.Num() - Pass->Cursor;
+    }
+    return Result;
+}
+
+// =============================================================================
+// TICK
+// =============================================================================
+
+void FHexademic6WaveEngine::Tick(FHexademic6LatticeStore& Store, double BudgetMicroseconds)
+{
+    FHexademic6FrameBudget Frame(BudgetMicroseconds >= 0.0 ? BudgetMicroseconds : (double)CVarHexademicWavesFrameBudgetMicroseconds.GetValueOnAnyThread());
+
+    StartPass(Store);
+
+    // Passes take turns chunk by chunk, so a large wave does not hold back the ones after it.
+    const int32 ChunkNodes = FMath::Max(CVarHexademicWavesChunkNodes.GetValueOnAnyThread(), 1);
+    while (Passes.Num() > 0 && Frame.Fits(ChunkCost))
+    {
+        if (NextPass >= Passes.Num())
+        {
+            NextPass = 0;
+        }
+        if (ExpandChunk(Store, *Passes[NextPass], ChunkNodes))
+        {
+            ++NextPass;
+        }
+        else
+        {
+            Passes.RemoveAt(NextPass);
+        }
+        Frame.EndUnit(ChunkCost);
+    }
+    const double StalledChunkCost = ChunkCost.Get();
+    if (Frame.RelaxIfStalled(ChunkCost, Passes.Num() > 0) && !bWarnedChunkBudget)
+    {
+        UE_LOG(LogHexademicLattice, Warning, TEXT("Waves: a chunk costs about %.0f us, more than the %.0f us tick budget; lower Hexademic.Waves.ChunkNodes or raise the budget."), StalledChunkCost, Frame.GetBudget());
+        bWarnedChunkBudget = true;
+    }
+}
+
+// =============================================================================
+// PROPAGATION
+// =============================================================================
+
+void FHexademic6WaveEngine::StartPass(FHexademic6LatticeStore& Store)
+{
+    using namespace Hexademic6WaveEnginePrivate;
+    TArray<FWave> Waves;
+    {
+        FScopeLock Lock(&PendingLock);
+        Waves = MoveTemp(PendingWaves);
+        PendingWaves.Reset();
+    }
+    if (Waves.Num() == 0)
+    {
+        return;
+    }
+
+    // Every origin seeds the same frontier; the seeds are the pass' first hop.
+    TUniquePtr<FPass> Pass = MakeUnique<FPass>();
+    const int32 NumNeighbors = FMath::Max(CVarHexademicWavesNeighborsPerNode.GetValueOnAnyThread(), 1);
+    const float AttenuationLength = CVarHexademicWavesAttenuationLength.GetValueOnAnyThread();
+    const float MinEnergy = CVarHexademicWavesMinEnergy.GetValueOnAnyThread();
+    TArray<FHexademicNodeHandle> Seeds;
+    for (const FWave& Wave : Waves)
+    {
+        Store.QueryKNearest(Wave.Origin, NumNeighbors, Seeds);
+        for (const FHexademicNodeHandle& Seed : Seeds)
+        {
+            const float Energy = Wave.Amplitude * GetFalloff(Distance(Wave.Origin, GetPosition(Store, Seed)), Seed.Order, AttenuationLength);
+            if (FMath::Abs(Energy) >= MinEnergy)
+            {
+                AddFront(*Pass, Seed, GetMemoryID(Store, Seed), Energy);
+            }
+        }
+    }
+    Pass->Frontier = MoveTemp(Pass->Next);
+    Pass->Next.Reset();
+    Pass->NextIndex.Reset();
+    ++Stats.Passes;
+    if (Pass->Frontier.Num() > 0)
+    {
+        Passes.Add(MoveTemp(Pass));
+    }
+}
+
+bool FHexademic6WaveEngine::ExpandChunk(FHexademic6LatticeStore& Store, FPass& Pass, int32 MaxNodes)
+{
+    using namespace Hexademic6WaveEnginePrivate;
+    const int32 Begin = Pass.Cursor;
+    const int32 Count = FMath::Min(MaxNodes, Pass.Frontier.Num() - Begin);
+    const int32 NumNeighbors = FMath::Max(CVarHexademicWavesNeighborsPerNode.GetValueOnAnyThread(), 1);
+    const float HopDecay = FMath::Clamp(CVarHexademicWavesHopDecay.GetValueOnAnyThread(), 0.0f, 1.0f);
+    const float AttenuationLength = CVarHexademicWavesAttenuationLength.GetValueOnAnyThread();
+    const float MinEnergy = CVarHexademicWavesMinEnergy.GetValueOnAnyThread();
+
+    // Neighbor queries only read the store, so the chunk's fronts are expanded in parallel.
+    const FHexademic6LatticeStore& ReadStore = Store;
+    ChunkNeighbors.SetNum(Count, EAllowShrinking::No);
+    ParallelFor(Count, [this, &ReadStore, &Pass, Begin, NumNeighbors, HopDecay, AttenuationLength, MinEnergy](int32 Index)
+    {
+        const FFront& Front = Pass.Frontier[Begin + Index];
+        TArray<FFront>& Spread = ChunkNeighbors[Index];
+        Spread.Reset();
+        if (!IsSameMemory(ReadStore, Front.Handle, Front.MemoryID))
+        {
+            return; // Removed since it was reached
+        }
+        const FHexademic6DCoordinate Position = GetPosition(ReadStore, Front.Handle);
+        TArray<FHexademicNodeHandle> Neighbors;
+        ReadStore.QueryKNearest(Position, NumNeighbors, Neighbors, Front.MemoryID);
+        for (const FHexademicNodeHandle& Neighbor : Neighbors)
+        {
+            const float Energy = Front.Energy * HopDecay * GetFalloff(Distance(Position, GetPosition(ReadStore, Neighbor)), Neighbor.Order, AttenuationLength);
+            if (FMath::Abs(Energy) >= MinEnergy)
+            {
+                Spread.Add({ Neighbor, GetMemoryID(ReadStore, Neighbor), Energy });
+            }
+        }
+    }, Count < MinParallelFronts ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    // Updates and next-hop bookkeeping on this thread, in frontier order.
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FFront& Front = Pass.Frontier[Begin + Index];
+        if (IsSameMemory(Store, Front.Handle, Front.MemoryID))
+        {
+            const float Resonance = Store.GetColumns(Front.Handle.Order).ResonanceStrength[Store.GetRow(Front.Handle)];
+            Store.SetResonanceStrength(Front.Handle, FMath::Clamp(Resonance + Front.Energy, 0.0f, 1.0f));
+            ++Stats.NodesReached;
+        }
+        for (const FFront& Spread : ChunkNeighbors[Index])
+        {
+            AddFront(Pass, Spread.Handle, Spread.MemoryID, Spread.Energy);
+        }
+    }
+
+    Pass.Cursor = Begin + Count;
+    if (Pass.Cursor == Pass.Frontier.Num())
+    {
+        Pass.Frontier = MoveTemp(Pass.Next);
+        Pass.Next.Reset();
+        Pass.NextIndex.Reset();
+        Pass.Cursor = 0;
+    }
+    return Pass.Frontier.Num() > 0;
+}
+
+void FHexademic6WaveEngine::AddFront(FPass& Pass, const FHexademicNodeHandle& Handle, const FGuid& MemoryID, float Energy)
+{
+    using namespace Hexademic6WaveEnginePrivate;
+    const uint64 Key = GetNodeKey(Handle);
+    if (const int32* Existing = Pass.NextIndex.Find(Key))
+    {
+        Pass.Next[*Existing].Energy += Energy; // Fronts meeting in the same hop add up
+        return;
+    }
+    bool bAlreadyReached;
+    Pass.Reached.Add(Key, &bAlreadyReached);
+    if (!bAlreadyReached)
+    {
+        Pass.NextIndex.Add(Key, Pass.Next.Add({ Handle, MemoryID, Energy }));
+    }
+}
@@ -0,0 +1,633 @@
+// Hexademic6WriteAheadLog.cpp
+// Log generations, the group commit thread, replay and snapshot files.
+
+#include "Hexademic6WriteAheadLog.h"
+#include "HAL/Event.h"               // For FEvent
+#include "HAL/FileManager.h"         // For IFileManager
+#include "HAL/IConsoleManager.h"     // For TAutoConsoleVariable
+#include "HAL/PlatformFileManager.h" // For FPlatformFileManager
+#include "HAL/PlatformProcess.h"     // For FPlatformProcess::GetSynchEventFromPool
+#include "HAL/PlatformTime.h"        // For FPlatformTime::Seconds()
+#include "HAL/RunnableThread.h"      // For FRunnableThread
+#include "Logging/LogMacros.h"       // For UE_LOG
+#include "Misc/Crc.h"                // For FCrc::MemCrc32
+#include "Misc/FileHelper.h"         // For FFileHelper::LoadFileToArray
+#include "Misc/Paths.h"              // For FPaths
+#include "Misc/ScopeLock.h"          // For FScopeLock
+#include "Serialization/MemoryReader.h" // For FMemoryReader
+#include "Serialization/MemoryWriter.h" // For FMemoryWriter
+
+static TAutoConsoleVariable<int32> CVarHexademicWALSyncPolicy(
+    TEXT("Hexademic.WAL.SyncPolicy"),
+    1,
+    TEXT("When write-ahead log commits are fsynced. 0: never (OS buffered), 1: at most once per\n")
+    TEXT("Hexademic.WAL.SyncIntervalMs, 2: every group commit. Writers never wait on the fsync."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicWALGroupCommitMs(
+    TEXT("Hexademic.WAL.GroupCommitMs"),
+    5,
+    TEXT("How long the write-ahead log gathers appended records before writing them as one group."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHexademicWALSyncIntervalMs(
+    TEXT("Hexademic.WAL.SyncIntervalMs"),
+    100,
+    TEXT("Minimum time between fsyncs under Hexademic.WAL.SyncPolicy=1."),
+    ECVF_Default);
+
+namespace Hexademic6WriteAheadLogPrivate
+{
+    // A pending buffer this large wakes the commit thread before the group interval ends.
+    constexpr int32 WakeThresholdBytes = 1 << 20;
+
+    constexpr uint32 SnapshotMagic = 0x50365848; // "HX6P"
+    constexpr uint32 SnapshotVersion = 1;
+
+    const TCHAR* const WalPrefix = TEXT("wal-");
+    const TCHAR* const WalExtension = TEXT(".log");
+    const TCHAR* const SnapshotPrefix = TEXT("snapshot-");
+    const TCHAR* const StateExtension = TEXT(".state");
+    const TCHAR* const SegmentExtension = TEXT(".hx6s");
+    const TCHAR* const BackupExtension = FHexademic6Segment::BackupSuffix;
+
+    FString MakeNumberedPath(const FString& Directory, const TCHAR* Prefix, uint64 Number, const TCHAR* Extension)
+    {
+        // Zero-padded so that names sort like the numbers they carry.
+        return Directory / FString::Printf(TEXT("%s%020llu%s"), Prefix, Number, Extension);
+    }
+
+    // Numbers of every <Prefix><digits><Extension> file in Directory, ascending. Originals that
+    // WriteFileAtomically renamed aside and never got to delete are put back first if their
+    // replacement is missing, and deleted otherwise.
+    TArray<uint64> FindNumberedFiles(const FString& Directory, const TCHAR* Prefix, const TCHAR* Extension)
+    {
+        TArray<FString> FileNames;
+        IFileManager::Get().FindFiles(FileNames, *(Directory / FString(Prefix) + TEXT("*") + Extension + BackupExtension), true, false);
+        for (const FString& FileName : FileNames)
+        {
+            const FString BackupPath = Directory / FileName;
+            const FString Path = BackupPath.LeftChop(FCString::Strlen(BackupExtension));
+            if (IFileManager::Get().FileExists(*Path))
+            {
+                IFileManager::Get().Delete(*BackupPath, false, false, true);
+            }
+            else
+            {
+                UE_LOG(LogHexademicLattice, Warning, TEXT("Restoring %s after an interrupted replace."), *Path);
+                IFileManager::Get().Move(*Path, *BackupPath, false);
+            }
+        }
+
+        FileNames.Reset();
+        IFileManager::Get().FindFiles(FileNames, *(Directory / FString(Prefix) + TEXT("*") + Extension), true, false);
+
+        const int32 PrefixLen = FCString::Strlen(Prefix);
+        const int32 ExtensionLen = FCString::Strlen(Extension);
+        TArray<uint64> Numbers;
+        for (const FString& FileName : FileNames)
+        {
+            const FString Digits = FileName.Mid(PrefixLen, FileName.Len() - PrefixLen - ExtensionLen);
+            bool bDigitsOnly = !Digits.IsEmpty();
+            for (TCHAR Char : Digits)
+            {
+                bDigitsOnly &= FChar::IsDigit(Char);
+            }
+            if (bDigitsOnly && FileName.EndsWith(Extension))
+            {
+                Numbers.Add(FCString::Strtoui64(*Digits, nullptr, 10));
+            }
+        }
+        Numbers.Sort();
+        return Numbers;
+    }
+
+    // Writes Bytes under a temporary name, syncs it and renames it over Path with
+    // FHexademic6Segment::ReplaceFile, so the original stays in place until the new file has
+    // replaced it. FindNumberedFiles restores an original left aside by a crash in between.
+    bool WriteFileAtomically(const FString& Path, TConstArrayView<uint8> Bytes)
+    {
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        const FString TempPath = Path + TEXT(".tmp");
+        bool bWritten = false;
+        {
+            TUniquePtr<IFileHandle> File(PlatformFile.OpenWrite(*TempPath));
+            bWritten = File && File->Write(Bytes.GetData(), Bytes.Num()) && File->Flush(true);
+        }
+        if (!bWritten)
+        {
+            PlatformFile.DeleteFile(*TempPath);
+        }
+        if (!bWritten || !FHexademic6Segment::ReplaceFile(Path, TempPath))
+        {
+            UE_LOG(LogHexademicLattice, Error, TEXT("Failed to write %s."), *Path);
+            return false;
+        }
+        return true;
+    }
+
+    FORCEINLINE uint32 RecordCrc(uint32 PayloadCrc, uint64 Sequence, EHexademic6WalRecordType Type)
+    {
+        uint8 Tail[9];
+        FMemory::Memcpy(Tail, &Sequence, sizeof(uint64));
+        Tail[8] = (uint8)Type;
+        return FCrc::MemCrc32(Tail, sizeof(Tail), PayloadCrc);
+    }
+
+    void SerializeKey(FArchive& Ar, FDUIDSIndex& Key)
+    {
+        Ar << Key.MajorClass << Key.Division << Key.Section << Key.SubSection << Key.Cutter << Key.Edition;
+    }
+
+    // Reads a serialized element count, rejecting counts the remaining bytes cannot hold.
+    bool SerializeCount(FArchive& Ar, int32& Count)
+    {
+        Ar << Count;
+        return !Ar.IsError() && Count >= 0 && Count <= Ar.TotalSize() - Ar.Tell();
+    }
+}
+
+// =============================================================================
+// WRITE-AHEAD LOG
+// =============================================================================
+
+FHexademic6WriteAheadLog::FHexademic6WriteAheadLog(const FString& InDirectory, uint64 InGeneration, uint64 NextSequence)
+    : Directory(InDirectory)
+    , Generation(InGeneration)
+    , LastSequence(NextSequence - 1)
+    , WrittenSequence(NextSequence - 1)
+    , DurableSequence(NextSequence - 1)
+{
+}
+
+FHexademic6WriteAheadLog::~FHexademic6WriteAheadLog()
+{
+    if (Thread)
+    {
+        Thread->Kill(true); // Calls Stop() and waits for Run() to return
+        delete Thread;
+        Thread = nullptr;
+    }
+    if (WakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+    }
+    FScopeLock FileScope(&FileLock);
+    CommitLocked(true);
+    File.Reset();
+}
+
+TUniquePtr<FHexademic6WriteAheadLog> FHexademic6WriteAheadLog::Open(const FString& Directory, uint64 Generation, uint64 NextSequence)
+{
+    IFileManager::Get().MakeDirectory(*Directory, true);
+    TUniquePtr<FHexademic6WriteAheadLog> Log(new FHexademic6WriteAheadLog(Directory, Generation, NextSequence));
+    if (!Log->OpenGeneration())
+    {
+        return nullptr;
+    }
+    Log->WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    Log->Thread = FRunnableThread::Create(Log.Get(), TEXT("HexademicWriteAheadLog"), 0, TPri_BelowNormal);
+    UE_LOG(LogHexademicLattice, Log, TEXT("Opened write-ahead log generation %llu in %s at sequence %llu."), Generation, *Directory, NextSequence);
+    return Log;
+}
+
+bool FHexademic6WriteAheadLog::OpenGeneration()
+{
+    const FString Path = GetGenerationPath(Directory, Generation);
+    File.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*Path));
+
+    uint8 Header[FileHeaderSize];
+    const uint32 Magic = ExpectedMagic;
+    const uint32 Version = CurrentVersion;
+    FMemory::Memcpy(Header, &Magic, sizeof(uint32));
+    FMemory::Memcpy(Header + 4, &Version, sizeof(uint32));
+    FMemory::Memcpy(Header + 8, &Generation, sizeof(uint64));
+    if (!File || !File->Write(Header, FileHeaderSize) || !File->Flush(true))
+    {
+        UE_LOG(LogHexademicLattice, Error, TEXT("Could not create write-ahead log generation %s."), *Path);
+        File.Reset();
+        return false;
+    }
+    return true;
+}
+
+EHexademic6WalSyncPolicy FHexademic6WriteAheadLog::GetSyncPolicy()
+{
+    return (EHexademic6WalSyncPolicy)FMath::Clamp(CVarHexademicWALSyncPolicy.GetValueOnAnyThread(), 0, 2);
+}
+
+FString FHexademic6WriteAheadLog::GetGenerationPath(const FString& Directory, uint64 Generation)
+{
+    using namespace Hexademic6WriteAheadLogPrivate;
+    return MakeNumberedPath(Directory, WalPrefix, Generation, WalExtension);
+}
+
+void FHexademic6WriteAheadLog::WriteKey(uint8* Out, const FDUIDSIndex& Key)
+{
+    Out[0] = Key.MajorClass;
+    Out[1] = Key.Division;
+    FMemory::Memcpy(Out + 2, &Key.Section, sizeof(uint16));
+    FMemory::Memcpy(Out + 4, &Key.SubSection, sizeof(uint32));
+    FMemory::Memcpy(Out + 8, &Key.Cutter, sizeof(uint16));
+    Out[10] = Key.Edition;
+}
+
+FDUIDSIndex FHexademic6WriteAheadLog::ReadKey(const uint8* In)
+{
+    FDUIDSIndex Key;
+    Key.MajorClass = In[0];
+    Key.Division = In[1];
+    FMemory::Memcpy(&Key.Section, In + 2, sizeof(uint16));
+    FMemory::Memcpy(&Key.SubSection, In + 4, sizeof(uint32));
+    FMemory::Memcpy(&Key.Cutter, In + 8, sizeof(uint16));
+    Key.Edition = In[10];
+    return Key;
+}
+
+uint64 FHexademic6WriteAheadLog::Append(EHexademic6WalRecordType Type, TConstArrayView<uint8> Prefix, TConstArrayView<uint8> Body)
+{
+    using namespace Hexademic6WriteAheadLogPrivate;
+    const uint32 PayloadSize = (uint32)(Prefix.Num() + Body.Num());
+    const uint32 PayloadCrc = FCrc::MemCrc32(Body.GetData(), Body.Num(), FCrc::MemCrc32(Prefix.GetData(), Prefix.Num()));
+
+    uint64 Sequence;
+    bool bWake;
+    {
+        FScopeLock BufferScope(&BufferLock);
+        Sequence = ++LastSequence;
+        const uint32 Crc = RecordCrc(PayloadCrc, Sequence, Type);
+
+        uint8 Header[RecordHeaderSize];
+        FMemory::Memcpy(Header, &PayloadSize, sizeof(uint32));
+        FMemory::Memcpy(Header + 4, &Crc, sizeof(uint32));
+        FMemory::Memcpy(Header + 8, &Sequence, sizeof(uint64));
+        Header[16] = (uint8)Type;
+        PendingBuffer.Append(Header, RecordHeaderSize);
+        PendingBuffer.Append(Prefix.GetData(), Prefix.Num());
+        PendingBuffer.Append(Body.GetData(), Body.Num());
+        bWake = PendingBuffer.Num() >= WakeThresholdBytes;
+    }
+    if (bWake && WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+    return Sequence;
+}
+
+uint64 FHexademic6WriteAheadLog::CommitLocked(bool bForceSync)
+{
+    uint64 Sequence;
+    {
+        FScopeLock BufferScope(&BufferLock);
+        Swap(PendingBuffer, WriteBuffer);
+        Sequence = LastSequence;
+    }
+
+    if (WriteBuffer.Num() > 0)
+    {
+        if (File && File->Write(WriteBuffer.GetData(), WriteBuffer.Num()))
+        {
+            BytesSinceRotation.fetch_add(WriteBuffer.Num(), std::memory_order_relaxed);
+            WrittenSequence = Sequence;
+        }
+        else if (bHealthy.exchange(false))
+        {
+            // The in-memory state is still complete; the next snapshot makes it durable again.
+            UE_LOG(LogHexademicLattice, Error, TEXT("Write-ahead log generation %llu could not be written; durability is lost until the next snapshot."), Generation);
+        }
+        WriteBuffer.Reset();
+    }
+
+    if (File && DurableSequence.load(std::memory_order_relaxed) < WrittenSequence)
+    {
+        const double Now = FPlatformTime::Seconds();
+        const EHexademic6WalSyncPolicy Policy = GetSyncPolicy();
+        const bool bSyncDue = bForceSync
+            || Policy == EHexademic6WalSyncPolicy::EveryCommit
+            || (Policy == EHexademic6WalSyncPolicy::Interval && (Now - LastSyncTime) * 1000.0 >= CVarHexademicWALSyncIntervalMs.GetValueOnAnyThread());
+        if (bSyncDue && File->Flush(true))
+        {
+            LastSyncTime = Now;
+            DurableSequence.store(WrittenSequence, std::memory_order_release);
+        }
+    }
+    return Sequence;
+}
+
+uint32 FHexademic6WriteAheadLog::Run()
+{
+    while (!bStopping.load(std::memory_order_relaxed))
+    {
+        WakeEvent->Wait(FMath::Max(CVarHexademicWALGroupCommitMs.GetValueOnAnyThread(), 1));
+        FScopeLock FileScope(&FileLock);
+        CommitLocked(false);
+    }
+    return 0;
+}
+
+void FHexademic6WriteAheadLog::Stop()
+{
+    bStopping.store(true, std::memory_order_relaxed);
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+void FHexademic6WriteAheadLog::Flush(bool bSync)
+{
+    FScopeLock FileScope(&FileLock);
+    CommitLocked(bSync);
+}
+
+uint64 FHexademic6WriteAheadLog::Rotate(uint64& OutLastSequence)
+{
+    FScopeLock FileScope(&FileLock);
+    OutLastSequence = CommitLocked(true);
+    File.Reset();
+    ++Generation;
+    BytesSinceRotation.store(0, std::memory_order_relaxed);
+    bHealthy.store(OpenGeneration(), std::memory_order_relaxed);
+    return Generation;
+}
+
+uint64 FHexademic6WriteAheadLog::GetLastSequence() const
+{
+    FScopeLock BufferScope(&BufferLock);
+    return LastSequence;
+}
+
+void FHexademic6WriteAheadLog::DeleteGenerationsBefore(uint64 FirstKeptGeneration) const
+{
+    using namespace Hexademic6WriteAheadLogPrivate;
+    for (uint64 FileGeneration : FindNumberedFiles(Directory, WalPrefix, WalExtension))
+    {
+        if (FileGeneration < FirstKeptGeneration)
+        {
+            IFileManager::Get().Delete(*GetGenerationPath(Directory, FileGeneration), false, false, true);
+        }
+    }
+}
+
+uint64 FHexademic6WriteAheadLog::Replay(const FString& Directory, uint64 FirstGeneration, uint64 AfterSequence,
+    TFunctionRef<void(EHexademic6WalRecordType Type, TConstArrayView<uint8> Payload)> Apply, uint64& OutLastGeneration)
+{
+    using namespace Hexademic6WriteAheadLogPrivate;
+    const double StartTime = FPlatformTime::Seconds();
+    uint64 LastApplied = AfterSequence;
+    int32 NumApplied = 0;
+    bool bDamaged = false;
+    OutLastGeneration = 0;
+
+    for (uint64 FileGeneration : FindNumberedFiles(Directory, WalPrefix, WalExtension))
+    {
+        if (FileGeneration < FirstGeneration)
+        {
+            continue; // Covered by the snapshot; deleted once the next snapshot completes
+        }
+        const FString Path = GetGenerationPath(Directory, FileGeneration);
+        if (bDamaged)
+        {
+            UE_LOG(LogHexademicLattice, Error, TEXT("Discarding write-ahead log generation %s: it follows a damaged generation."), *Path);
+            IFileManager::Get().Delete(*Path, false, false, true);
+            continue;
+        }
+        OutLastGeneration = FileGeneration;
+
+        // Generations are bounded by the snapshot threshold, so each is read whole.
+        TArray<uint8> Bytes;
+        if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+        {
+            UE_LOG(LogHexademicLattice, Error, TEXT("Could not read write-ahead log generation %s."), *Path);
+            bDamaged = true;
+            continue;
+        }
+
+        uint32 Magic = 0;
+        uint32 Version = 0;
+        if (Bytes.Num() >= FileHeaderSize)
+        {
+            FMemory::Memcpy(&Magic, Bytes.GetData(), sizeof(uint32));
+            FMemory::Memcpy(&Version, Bytes.GetData() + 4, sizeof(uint32));
+        }
+        int64 ValidSize = 0;
+        if (Magic == ExpectedMagic && Version == CurrentVersion)
+        {
+            ValidSize = FileHeaderSize;
+            int64 Offset = FileHeaderSize;
+            while (Offset + RecordHeaderSize <= Bytes.Num())
+            {
+                const uint8* Header = Bytes.GetData() + Offset;
+                uint32 PayloadSize;
+                uint32 Crc;
+                uint64 Sequence;
+                FMemory::Memcpy(&PayloadSize, Header, sizeof(uint32));
+                FMemory::Memcpy(&Crc, Header + 4, sizeof(uint32));
+                FMemory::Memcpy(&Sequence, Header + 8, sizeof(uint64));
+                const EHexademic6WalRecordType Type = (EHexademic6WalRecordType)Header[16];
+                if (Offset + RecordHeaderSize + PayloadSize > Bytes.Num())
+                {
+                    break;
+                }
+                const TConstArrayView<uint8> Payload(Header + RecordHeaderSize, (int32)PayloadSize);
+                if (RecordCrc(FCrc::MemCrc32(Payload.GetData(), Payload.Num()), Sequence, Type) != Crc)
+                {
+                    break;
+                }
+                if (Sequence > LastApplied)
+                {
+                    Apply(Type, Payload);
+                    LastApplied = Sequence;
+                    ++NumApplied;
+                }
+                Offset += RecordHeaderSize + PayloadSize;
+                ValidSize = Offset;
+            }
+        }
+
+        if (ValidSize < Bytes.Num())
+        {
+            // A torn tail from the crash, or damage. Either way nothing after it can be trusted.
+            UE_LOG(LogHexademicLattice, Warning, TEXT("Write-ahead log generation %s: discarding %lld damaged trailing bytes."), *Path, Bytes.Num() - ValidSize);
+            bDamaged = true;
+            if (ValidSize == 0)
+            {
+                IFileManager::Get().Delete(*Path, false, false, true);
+            }
+            else
+            {
+                WriteFileAtomically(Path, TConstArrayView<uint8>(Bytes.GetData(), (int32)ValidSize));
+            }
+        }
+    }
+
+    UE_LOG(LogHexademicLattice, Log, TEXT("Replayed %d write-ahead log records up to sequence %llu in %.1f ms."),
+        NumApplied, LastApplied, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return LastApplied;
+}
+
+// =============================================================================
+// SNAPSHOTS
+// =============================================================================
+
+FString FHexademic6Snapshot::GetSegmentPath(const FString& Directory, uint64 Sequence)
+{
+    using namespace Hexademic6WriteAheadLogPrivate;
+    return MakeNumberedPath(Directory, SnapshotPrefix, Sequence, SegmentExtension);
+}
+
+FString FHexademic6Snapshot::GetStatePath(const FString& Directory, uint64 Sequence)
+{
+    using namespace Hexademic6WriteAheadLogPrivate;
+    return MakeNumberedPath(Directory, SnapshotPrefix, Sequence, StateExtension);
+}
+
+bool FHexademic6Snapshot::Write(const FString& Directory)
+{
+    using namespace Hexademic6WriteAheadLogPrivate;
+    const double StartTime = FPlatformTime::Seconds();
+    if (!FHexademic6Segment::Write(GetSegmentPath(Directory, Sequence), Records, Dictionaries))
+    {
+        return false;
+    }
+
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+    uint32 Magic = SnapshotMagic;
+    uint32 Version = SnapshotVersion;
+    Writer << Magic << Version << Sequence << WalGeneration;
+
+    int32 Count = IndexToMemory.Num();
+    Writer << Count;
+    for (TPair<FDUIDSIndex, FGuid>& Pair : IndexToMemory)
+    {
+        FDUIDSIndex Key = Pair.Key;
+        SerializeKey(Writer, Key);
+        Writer << Pair.Value;
+    }
+    Count = AccessCounts.Num();
+    Writer << Count;
+    for (TPair<FDUIDSIndex, int32>& Pair : AccessCounts)
+    {
+        FDUIDSIndex Key = Pair.Key;
+        SerializeKey(Writer, Key);
+        Writer << Pair.Value;
+    }
+    Count = LastAccessTimes.Num();
+    Writer << Count;
+    for (TPair<FDUIDSIndex, double>& Pair : LastAccessTimes)
+    {
+        FDUIDSIndex Key = Pair.Key;
+        SerializeKey(Writer, Key);
+        Writer << Pair.Value;
+    }
+    uint32 Crc = FCrc::MemCrc32(Bytes.GetData(), Bytes.Num());
+    Writer << Crc;
+
+    if (!WriteFileAtomically(GetStatePath(Directory, Sequence), Bytes))
+    {
+        return false;
+    }
+    UE_LOG(LogHexademicLattice, Log, TEXT("Wrote snapshot %llu: %d indices, %d records in %.1f ms."),
+        Sequence, IndexToMemory.Num(), Records.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return true;
+}
+
+bool FHexademic6Snapshot::LoadLatest(const FString& Directory, FHexademic6Snapshot& OutSnapshot, FString& OutSegmentPath)
+{
+    using namespace Hexademic6WriteAheadLogPrivate;
+    const TArray<uint64> Sequences = FindNumberedFiles(Directory, SnapshotPrefix, StateExtension);
+    for (int32 SnapshotIndex = Sequences.Num() - 1; SnapshotIndex >= 0; --SnapshotIndex)
+    {
+        const FString StatePath = GetStatePath(Directory, Sequences[SnapshotIndex]);
+        TArray<uint8> Bytes;
+        if (!FFileHelper::LoadFileToArray(Bytes, *StatePath) || Bytes.Num() < (int32)sizeof(uint32))
+        {
+            UE_LOG(LogHexademicLattice, Warning, TEXT("Skipping unreadable snapshot %s."), *StatePath);
+            continue;
+        }
+        const int32 BodySize = Bytes.Num() - (int32)sizeof(uint32);
+        uint32 StoredCrc;
+        FMemory::Memcpy(&StoredCrc, Bytes.GetData() + BodySize, sizeof(uint32));
+        if (StoredCrc != FCrc::MemCrc32(Bytes.GetData(), BodySize))
+        {
+            UE_LOG(LogHexademicLattice, Warning, TEXT("Skipping snapshot %s: checksum mismatch."), *StatePath);
+            continue;
+        }
+
+        OutSnapshot = FHexademic6Snapshot();
+        FMemoryReader Reader(Bytes);
+        uint32 Magic = 0;
+        uint32 Version = 0;
+        Reader << Magic << Version;
+        if (Magic != SnapshotMagic || Version != SnapshotVersion)
+        {
+            UE_LOG(LogHexademicLattice, Warning, TEXT("Skipping snapshot %s: unknown format."), *StatePath);
+            continue;
+        }
+        Reader << OutSnapshot.Sequence << OutSnapshot.WalGeneration;
+
+        int32 Count = 0;
+        bool bValid = SerializeCount(Reader, Count);
+        OutSnapshot.IndexToMemory.Reserve(bValid ? Count : 0);
+        for (int32 Entry = 0; bValid && Entry < Count; ++Entry)
+        {
+            FDUIDSIndex Key;
+            FGuid MemoryID;
+            SerializeKey(Reader, Key);
+            Reader << MemoryID;
+            OutSnapshot.IndexToMemory.Add(Key, MemoryID);
+        }
+        bValid = bValid && SerializeCount(Reader, Count);
+        OutSnapshot.AccessCounts.Reserve(bValid ? Count : 0);
+        for (int32 Entry = 0; bValid && Entry < Count; ++Entry)
+        {
+            FDUIDSIndex Key;
+            int32 AccessCount = 0;
+            SerializeKey(Reader, Key);
+            Reader << AccessCount;
+            OutSnapshot.AccessCounts.Add(Key, AccessCount);
+        }
+        bValid = bValid && SerializeCount(Reader, Count);
+        OutSnapshot.LastAccessTimes.Reserve(bValid ? Count : 0);
+        for (int32 Entry = 0; bValid && Entry < Count; ++Entry)
+        {
+            FDUIDSIndex Key;
+            double Time = 0.0;
+            SerializeKey(Reader, Key);
+            Reader << Time;
+            OutSnapshot.LastAccessTimes.Add(Key, Time);
+        }
+
+        OutSegmentPath = GetSegmentPath(Directory, OutSnapshot.Sequence);
+        if (!bValid || Reader.IsError() || !FPaths::FileExists(OutSegmentPath))
+        {
+            UE_LOG(LogHexademicLattice, Warning, TEXT("Skipping snapshot %s: truncated state or missing segment."), *StatePath);
+            continue;
+        }
+        return true;
+    }
+    OutSnapshot = FHexademic6Snapshot();
+    return false;
+}
+
+void FHexademic6Snapshot::DeleteBefore(const FString& Directory, uint64 Sequence)
+{
+    using namespace Hexademic6WriteAheadLogPrivate;
+    // State files go first, so a snapshot never appears complete without its segment.
+    for (uint64 SnapshotSequence : FindNumberedFiles(Directory, SnapshotPrefix, StateExtension))
+    {
+        if (SnapshotSequence < Sequence)
+        {
+            IFileManager::Get().Delete(*GetStatePath(Directory, SnapshotSequence), false, false, true);
+        }
+    }
+    for (uint64 SnapshotSequence : FindNumberedFiles(Directory, SnapshotPrefix, SegmentExtension))
+    {
+        if (SnapshotSequence < Sequence)
+        {
+            IFileManager::Get().Delete(*GetSegmentPath(Directory, SnapshotSequence), false, false, true);
+        }
+    }
+}
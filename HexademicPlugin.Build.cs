@@ -48,6 +48,7 @@ public class HexademicPlugin : ModuleRules
                 "RHI", // For low-level Rendering Hardware Interface.
                 "RHICore", // Core RHI types.
                 "Projects", // For IPluginManager::FindPlugin().
+                "OodleDataCompression", // For FOodleDataCompression (record codec levels 3+).
                 "ComputeShader" // If you're explicitly using Unreal's Compute Shader framework directly.
                 // ... add other private dependencies here ...
             }
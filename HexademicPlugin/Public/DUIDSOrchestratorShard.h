@@ -0,0 +1,67 @@
+// DUIDSOrchestratorShard.h
+// One lock-partitioned slice of FDUIDSOrchestrator state.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"  // For TStaticArray
+#include "Misc/ScopeRWLock.h"        // For FRWLock, FReadScopeLock, FWriteScopeLock
+#include "HexademicSixLattice.h"     // For FDUIDSIndex
+#include "DUIDSOrderedIndex.h"       // For FDUIDSOrderedIndex
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::NumOrders
+#include "Hexademic6RecordArena.h"   // For FHexademic6RecordArena, FHexademicRecordLocation
+#include "Hexademic6RecordCodec.h"   // For FHexademic6RecordCodec
+#include "Hexademic6NodeCache.h"     // For FHexademic6NodeCache
+#include "Hexademic6FlatMap.h"       // For THexademic6FlatMap
+
+// =============================================================================
+// ORCHESTRATOR SHARD
+// =============================================================================
+
+// DUIDS keys are spread over NumShards shards by a mixed hash of the key, and memory ids by a
+// mixed hash of the id, so operations on different memories rarely contend. Each shard has:
+//   MemoryLock - MemoryToIndexMap. Held by a re-indexing for its whole duration, so re-indexings
+//                of one memory are serialized; Lock of key shards may be taken inside it, but
+//                MemoryLock is never taken while any Lock is held, nor on two shards at once.
+//   Lock       - readers share it, writers hold it exclusively. Guards the key-to-memory map,
+//                ordered index, record storage and codec.
+//   CacheLock  - the node cache. Fills and invalidations happen while holding Lock (shared or
+//                exclusive respectively); cache hits take CacheLock alone. Lock is never
+//                acquired while CacheLock is held.
+// A thread never holds Lock on two shards at once, except for the snapshot paths and batched
+// retrieval, which take several shards' Lock for reading in ascending order.
+struct FDUIDSOrchestratorShard
+{
+    static constexpr int32 NumShards = 16;
+    static_assert((NumShards & (NumShards - 1)) == 0, "Shard selection masks the hash.");
+
+    static int32 GetShardIndex(uint32 Hash)
+    {
+        // Finalizer mix, so that structured keys (e.g. one MajorClass) still spread evenly.
+        Hash ^= Hash >> 16;
+        Hash *= 0x7feb352du;
+        Hash ^= Hash >> 15;
+        Hash *= 0x846ca68bu;
+        Hash ^= Hash >> 16;
+        return (int32)(Hash & (NumShards - 1));
+    }
+
+    mutable FRWLock MemoryLock;
+    TMap<FGuid, FDUIDSIndex> MemoryToIndexMap; // Memory ids that hash to this shard
+
+    mutable FRWLock Lock;
+    THexademic6FlatMap<FGuid> IndexToMemoryMap; // Hit on every lookup, so flat and packed-keyed
+    FDUIDSOrderedIndex OrderedIndex;
+    THexademic6FlatMap<FHexademicRecordLocation> CompressedMemoryStorage;
+    TStaticArray<FHexademic6RecordArena, FHexademic6OrderIndexing::NumOrders> RecordArenas;
+    TStaticArray<int64, FHexademic6OrderIndexing::NumOrders> RawBytesByOrder{InPlace, 0};
+    TStaticArray<int64, FHexademic6OrderIndexing::NumOrders> StoredBytesByOrder{InPlace, 0};
+    FHexademic6RecordCodec RecordCodec; // Compression scratch is per codec, so shards compress in parallel
+    TSet<uint32> LoggedDictionaries;
+    TSet<FDUIDSIndex> RemovedSegmentRecords; // Keys whose mounted segment records were removed; segments are read-only
+
+    mutable FCriticalSection CacheLock;
+    FHexademic6NodeCache Cache;
+};
+
+using FDUIDSOrchestratorShards = TStaticArray<FDUIDSOrchestratorShard, FDUIDSOrchestratorShard::NumShards>;
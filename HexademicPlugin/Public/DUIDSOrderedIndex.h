@@ -0,0 +1,402 @@
+// DUIDSOrderedIndex.h
+// Persistent ordered key index (sorted blocks + fence keys) backing FDUIDSOrchestrator range queries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/BinarySearch.h" // For Algo::LowerBound, Algo::UpperBound
+#include "HexademicSixLattice.h" // For FDUIDSIndex
+
+// =============================================================================
+// SORTED BLOCK INDEX
+// =============================================================================
+
+// Keys are kept sorted in fixed-capacity blocks, each a single contiguous allocation.
+// A parallel fence array holds the first key of every block, so a lookup is a binary search
+// over the fences followed by a binary search inside one block: O(log n) with two cache-dense
+// searches. Inserts and removals touch one block (plus a split or merge), so the index is
+// maintained incrementally instead of being re-sorted per query.
+//
+// Block sizes are kept in a Fenwick tree that every mutation updates, so CountRange is
+// O(log n) and, like every other const method, never writes: any number of readers may run
+// together as long as no writer does.
+//
+// KeyType must be copyable and provide operator< and operator==.
+template<typename KeyType, int32 BlockCapacity = 256>
+class TSortedBlockIndex
+{
+    static_assert(BlockCapacity >= 4, "Blocks must hold at least four keys.");
+
+public:
+    // Position of a key: block number and offset inside that block.
+    struct FCursor
+    {
+        int32 Block = 0;
+        int32 Offset = 0;
+    };
+
+    int32 Num() const { return NumKeys; }
+    int32 NumBlocks() const { return Blocks.Num(); }
+
+    void Empty()
+    {
+        Blocks.Empty();
+        Fences.Empty();
+        BlockCounts.Empty();
+        NumKeys = 0;
+    }
+
+    // Inserts Key. Returns false if it was already present.
+    bool Add(const KeyType& Key)
+    {
+        if (Blocks.Num() == 0)
+        {
+            TArray<KeyType>& NewBlock = Blocks.AddDefaulted_GetRef();
+            NewBlock.Reserve(BlockCapacity);
+            NewBlock.Add(Key);
+            Fences.Add(Key);
+            NumKeys = 1;
+            RebuildBlockCounts();
+            return true;
+        }
+
+        const int32 BlockIndex = FindBlock(Key);
+        TArray<KeyType>& Block = Blocks[BlockIndex];
+        const int32 Offset = Algo::LowerBound(Block, Key);
+        if (Offset < Block.Num() && Block[Offset] == Key)
+        {
+            return false;
+        }
+
+        Block.Insert(Key, Offset);
+        if (Offset == 0)
+        {
+            Fences[BlockIndex] = Key;
+        }
+        ++NumKeys;
+        UpdateBlockCount(BlockIndex, 1);
+
+        if (Block.Num() > BlockCapacity)
+        {
+            SplitBlock(BlockIndex);
+        }
+        return true;
+    }
+
+    // Removes Key. Returns false if it was not present.
+    bool Remove(const KeyType& Key)
+    {
+        if (Blocks.Num() == 0)
+        {
+            return false;
+        }
+
+        const int32 BlockIndex = FindBlock(Key);
+        TArray<KeyType>& Block = Blocks[BlockIndex];
+        const int32 Offset = Algo::LowerBound(Block, Key);
+        if (Offset >= Block.Num() || !(Block[Offset] == Key))
+        {
+            return false;
+        }
+
+        Block.RemoveAt(Offset, 1, EAllowShrinking::No);
+        --NumKeys;
+        UpdateBlockCount(BlockIndex, -1);
+
+        if (Block.Num() == 0)
+        {
+            Blocks.RemoveAt(BlockIndex);
+            Fences.RemoveAt(BlockIndex);
+            RebuildBlockCounts();
+            return true;
+        }
+        if (Offset == 0)
+        {
+            Fences[BlockIndex] = Block[0];
+        }
+        if (Block.Num() < BlockCapacity / 4)
+        {
+            MaybeMergeWithNext(BlockIndex > 0 ? BlockIndex - 1 : BlockIndex);
+        }
+        return true;
+    }
+
+    bool Contains(const KeyType& Key) const
+    {
+        if (Blocks.Num() == 0)
+        {
+            return false;
+        }
+        const TArray<KeyType>& Block = Blocks[FindBlock(Key)];
+        const int32 Offset = Algo::LowerBound(Block, Key);
+        return Offset < Block.Num() && Block[Offset] == Key;
+    }
+
+    // First position whose key is not less than Key (may be one past the end).
+    FCursor LowerBound(const KeyType& Key) const
+    {
+        FCursor Cursor;
+        if (Blocks.Num() == 0)
+        {
+            return Cursor;
+        }
+        Cursor.Block = FindBlock(Key);
+        Cursor.Offset = Algo::LowerBound(Blocks[Cursor.Block], Key);
+        Normalize(Cursor);
+        return Cursor;
+    }
+
+    // First position whose key is greater than Key (may be one past the end).
+    FCursor UpperBound(const KeyType& Key) const
+    {
+        FCursor Cursor;
+        if (Blocks.Num() == 0)
+        {
+            return Cursor;
+        }
+        Cursor.Block = FindBlock(Key);
+        Cursor.Offset = Algo::UpperBound(Blocks[Cursor.Block], Key);
+        Normalize(Cursor);
+        return Cursor;
+    }
+
+    // Visits keys in [Start, End] in ascending order until Visitor returns false.
+    // Costs O(log n + k). Returns the number of keys visited.
+    template<typename VisitorType>
+    int32 ForEachInRange(const KeyType& Start, const KeyType& End, VisitorType&& Visitor) const
+    {
+        int32 Visited = 0;
+        if (End < Start)
+        {
+            return Visited;
+        }
+        for (FCursor Cursor = LowerBound(Start); Cursor.Block < Blocks.Num(); ++Cursor.Block, Cursor.Offset = 0)
+        {
+            const TArray<KeyType>& Block = Blocks[Cursor.Block];
+            for (; Cursor.Offset < Block.Num(); ++Cursor.Offset)
+            {
+                const KeyType& Key = Block[Cursor.Offset];
+                if (End < Key)
+                {
+                    return Visited;
+                }
+                ++Visited;
+                if (!Visitor(Key))
+                {
+                    return Visited;
+                }
+            }
+        }
+        return Visited;
+    }
+
+    // Visits keys in [Start, End] in descending order until Visitor returns false.
+    template<typename VisitorType>
+    int32 ForEachInRangeReverse(const KeyType& Start, const KeyType& End, VisitorType&& Visitor) const
+    {
+        int32 Visited = 0;
+        if (End < Start || Blocks.Num() == 0)
+        {
+            return Visited;
+        }
+        // Start from the last key <= End: one before UpperBound(End).
+        const FCursor After = UpperBound(End);
+        int32 BlockIndex = After.Block;
+        int32 Offset = After.Offset - 1;
+        if (BlockIndex >= Blocks.Num())
+        {
+            BlockIndex = Blocks.Num() - 1;
+            Offset = Blocks[BlockIndex].Num() - 1;
+        }
+        while (BlockIndex >= 0)
+        {
+            const TArray<KeyType>& Block = Blocks[BlockIndex];
+            for (; Offset >= 0; --Offset)
+            {
+                const KeyType& Key = Block[Offset];
+                if (Key < Start)
+                {
+                    return Visited;
+                }
+                ++Visited;
+                if (!Visitor(Key))
+                {
+                    return Visited;
+                }
+            }
+            if (--BlockIndex >= 0)
+            {
+                Offset = Blocks[BlockIndex].Num() - 1;
+            }
+        }
+        return Visited;
+    }
+
+    // Visits every key in ascending order until Visitor returns false.
+    template<typename VisitorType>
+    void ForEach(VisitorType&& Visitor) const
+    {
+        for (const TArray<KeyType>& Block : Blocks)
+        {
+            for (const KeyType& Key : Block)
+            {
+                if (!Visitor(Key))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    // Appends keys in [Start, End] to OutKeys in ascending order.
+    void GetRange(const KeyType& Start, const KeyType& End, TArray<KeyType>& OutKeys) const
+    {
+        ForEachInRange(Start, End, [&OutKeys](const KeyType& Key) { OutKeys.Add(Key); return true; });
+    }
+
+    // Number of keys in [Start, End] in O(log n).
+    int32 CountRange(const KeyType& Start, const KeyType& End) const
+    {
+        if (End < Start || Blocks.Num() == 0)
+        {
+            return 0;
+        }
+        return Rank(UpperBound(End)) - Rank(LowerBound(Start));
+    }
+
+    // Rebuilds the index from an ascending, duplicate-free key array with every block full.
+    void BuildFromSorted(TConstArrayView<KeyType> SortedKeys)
+    {
+        Empty();
+        Blocks.Reserve(FMath::DivideAndRoundUp(SortedKeys.Num(), BlockCapacity));
+        for (int32 First = 0; First < SortedKeys.Num(); First += BlockCapacity)
+        {
+            const int32 Count = FMath::Min(BlockCapacity, SortedKeys.Num() - First);
+            TArray<KeyType>& Block = Blocks.AddDefaulted_GetRef();
+            Block.Reserve(BlockCapacity);
+            Block.Append(SortedKeys.GetData() + First, Count);
+            Fences.Add(Block[0]);
+        }
+        NumKeys = SortedKeys.Num();
+        RebuildBlockCounts();
+    }
+
+    // Repacks all keys into full blocks.
+    void Compact()
+    {
+        TArray<KeyType> AllKeys;
+        AllKeys.Reserve(NumKeys);
+        for (const TArray<KeyType>& Block : Blocks)
+        {
+            AllKeys.Append(Block);
+        }
+        BuildFromSorted(AllKeys);
+    }
+
+    // Share of allocated block slots left empty: 0 when every block is full.
+    float GetFragmentation() const
+    {
+        const int32 Slots = Blocks.Num() * BlockCapacity;
+        return Slots > 0 ? 1.0f - (float)NumKeys / (float)Slots : 0.0f;
+    }
+
+private:
+    // Block whose fence is the greatest fence <= Key (block 0 for keys below every fence).
+    int32 FindBlock(const KeyType& Key) const
+    {
+        const int32 Upper = Algo::UpperBound(Fences, Key);
+        return FMath::Max(0, Upper - 1);
+    }
+
+    void Normalize(FCursor& Cursor) const
+    {
+        while (Cursor.Block < Blocks.Num() && Cursor.Offset >= Blocks[Cursor.Block].Num())
+        {
+            ++Cursor.Block;
+            Cursor.Offset = 0;
+        }
+    }
+
+    int32 Rank(const FCursor& Cursor) const
+    {
+        if (Cursor.Block >= Blocks.Num())
+        {
+            return NumKeys;
+        }
+        // Keys in blocks [0, Cursor.Block), summed over the Fenwick tree.
+        int32 Preceding = 0;
+        for (int32 Node = Cursor.Block - 1; Node >= 0; Node = (Node & (Node + 1)) - 1)
+        {
+            Preceding += BlockCounts[Node];
+        }
+        return Preceding + Cursor.Offset;
+    }
+
+    void UpdateBlockCount(int32 BlockIndex, int32 Delta)
+    {
+        for (int32 Node = BlockIndex; Node < BlockCounts.Num(); Node |= Node + 1)
+        {
+            BlockCounts[Node] += Delta;
+        }
+    }
+
+    // O(blocks); only needed when blocks are inserted or removed.
+    void RebuildBlockCounts()
+    {
+        const int32 NumBlocks = Blocks.Num();
+        BlockCounts.SetNumUninitialized(NumBlocks);
+        for (int32 BlockIndex = 0; BlockIndex < NumBlocks; ++BlockIndex)
+        {
+            BlockCounts[BlockIndex] = Blocks[BlockIndex].Num();
+        }
+        for (int32 Node = 0; Node < NumBlocks; ++Node)
+        {
+            const int32 Parent = Node | (Node + 1);
+            if (Parent < NumBlocks)
+            {
+                BlockCounts[Parent] += BlockCounts[Node];
+            }
+        }
+    }
+
+    void SplitBlock(int32 BlockIndex)
+    {
+        TArray<KeyType> UpperHalf;
+        UpperHalf.Reserve(BlockCapacity);
+        {
+            TArray<KeyType>& Block = Blocks[BlockIndex];
+            const int32 Half = Block.Num() / 2;
+            UpperHalf.Append(Block.GetData() + Half, Block.Num() - Half);
+            Block.SetNum(Half, EAllowShrinking::No);
+        }
+        Fences.Insert(UpperHalf[0], BlockIndex + 1);
+        Blocks.Insert(MoveTemp(UpperHalf), BlockIndex + 1);
+        RebuildBlockCounts();
+    }
+
+    // Folds block BlockIndex + 1 into BlockIndex when both are sparse enough to share a block.
+    void MaybeMergeWithNext(int32 BlockIndex)
+    {
+        if (BlockIndex + 1 >= Blocks.Num())
+        {
+            return;
+        }
+        TArray<KeyType>& Block = Blocks[BlockIndex];
+        TArray<KeyType>& Next = Blocks[BlockIndex + 1];
+        if (Block.Num() + Next.Num() <= BlockCapacity / 2)
+        {
+            Block.Append(Next);
+            Blocks.RemoveAt(BlockIndex + 1);
+            Fences.RemoveAt(BlockIndex + 1);
+            RebuildBlockCounts();
+        }
+    }
+
+    TArray<TArray<KeyType>> Blocks;
+    TArray<KeyType> Fences;
+    TArray<int32> BlockCounts; // Fenwick tree over Blocks[i].Num()
+    int32 NumKeys = 0;
+};
+
+// Ordered DUIDS key index maintained by FDUIDSOrchestrator.
+using FDUIDSOrderedIndex = TSortedBlockIndex<FDUIDSIndex>;
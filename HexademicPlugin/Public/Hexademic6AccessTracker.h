@@ -0,0 +1,240 @@
+// Hexademic6AccessTracker.h
+// Approximate, low-overhead access statistics for DUIDS-indexed memories.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"  // For TStaticArray
+#include "HAL/CriticalSection.h"     // For FCriticalSection
+#include "Templates/Function.h"      // For TFunctionRef
+#include "Templates/UniquePtr.h"     // For TUniquePtr
+#include "HexademicSixLattice.h"     // For FDUIDSIndex, ECognitiveLatticeOrder
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::NumOrders
+
+// =============================================================================
+// FREQUENCY SKETCH
+// =============================================================================
+
+// Count-min sketch over DUIDS keys. Estimates never undercount; with Width counters per row
+// they overcount by at most 2N/Width with probability 1 - 2^-Depth, N being the total count.
+// Updates are conservative (only the minimal counters grow), which tightens estimates for
+// skewed access streams.
+class HEXADEMIC6LATTICE_API FHexademic6CountMinSketch
+{
+public:
+    static constexpr int32 Depth = 4;
+
+    // Width is rounded up to a power of two.
+    explicit FHexademic6CountMinSketch(int32 InWidth = 16384);
+
+    void Add(const FDUIDSIndex& Key, uint32 Count = 1);
+    uint32 Estimate(const FDUIDSIndex& Key) const;
+    void Reset();
+
+    // Ages every count by half, so estimates favor recent additions.
+    void Halve();
+
+    int32 GetWidth() const { return Width; }
+
+    static uint64 HashKey(const FDUIDSIndex& Key);
+
+private:
+    // Row Row's counter for a key hash (Kirsch-Mitzenmacher double hashing).
+    FORCEINLINE uint32& Counter(uint64 Hash, int32 Row)
+    {
+        return Counters[Row * Width + (int32)(((uint32)Hash + (uint32)Row * (uint32)(Hash >> 32)) & (uint32)(Width - 1))];
+    }
+    FORCEINLINE uint32 Counter(uint64 Hash, int32 Row) const
+    {
+        return Counters[Row * Width + (int32)(((uint32)Hash + (uint32)Row * (uint32)(Hash >> 32)) & (uint32)(Width - 1))];
+    }
+
+    int32 Width;
+    TArray<uint32> Counters;
+};
+
+// =============================================================================
+// HEAVY HITTERS
+// =============================================================================
+
+// Space-saving summary of the most frequent keys in a stream, in bounded memory. Every key
+// whose true count exceeds N/Capacity is guaranteed to be present. A tracked count may
+// overestimate by at most its Error. Entries are kept sorted by descending count, so the
+// top K are read in O(K).
+class HEXADEMIC6LATTICE_API FHexademic6SpaceSaving
+{
+public:
+    struct FEntry
+    {
+        FDUIDSIndex Key;
+        uint32 Count = 0;
+        uint32 Error = 0; // Count inherited from the evicted key this entry replaced
+    };
+
+    explicit FHexademic6SpaceSaving(int32 InCapacity = 256);
+
+    void Add(const FDUIDSIndex& Key, uint32 Count = 1);
+    void Reset();
+
+    // Changing the capacity clears the summary.
+    void SetCapacity(int32 InCapacity);
+    int32 GetCapacity() const { return Capacity; }
+
+    TConstArrayView<FEntry> GetEntries() const { return Entries; }
+
+private:
+    // Restores descending order after the entry at Position grew.
+    void MoveUp(int32 Position);
+
+    int32 Capacity;
+    TArray<FEntry> Entries;
+    TMap<FDUIDSIndex, int32> Positions;
+};
+
+// =============================================================================
+// ACCESS WINDOWS
+// =============================================================================
+
+// Time-bucketed ring of access counters for windowed queries. Tiers go from fine to coarse
+// (by default per-second buckets for a minute, per-minute for an hour, per-hour for a day).
+// Accesses land in the finest tier; a bucket that falls off its ring is merged into the
+// coarser bucket covering it. Each bucket counts its accesses exactly and its keys in a
+// space-saving summary, so memory is bounded by the bucket count whatever the number of
+// distinct keys.
+// A bucket only receives accesses older than the finer tier's ring reaches, so its accesses
+// span from its start to that horizon at most. Buckets whose span ends before a window edge are
+// skipped, and the one bucket span a window edge falls in is counted pro rata, as if its
+// accesses were spread evenly. The error is therefore confined to that one span's accesses, and
+// is zero when they are spread evenly.
+class HEXADEMIC6LATTICE_API FHexademic6AccessWindow
+{
+public:
+    struct FTier
+    {
+        double BucketSeconds = 1.0; // Must be a multiple of the previous tier's width
+        int32 NumBuckets = 60;
+    };
+
+    // Parses "<seconds>x<buckets>" entries separated by commas, e.g. "1x60,60x60,3600x24".
+    static bool ParseTiers(const FString& Spec, TArray<FTier>& OutTiers);
+
+    FHexademic6AccessWindow(TConstArrayView<FTier> InTiers, int32 InKeysPerBucket);
+
+    // Time is in FPlatformTime::Seconds(). Accesses older than every tier's ring are dropped.
+    void Add(const FDUIDSIndex& Key, uint32 Count, double Time);
+
+    // Per-key access counts since MinTime, added into OutCounts. Costs O(buckets + results) for
+    // a bounded number of keys per bucket.
+    void Query(double MinTime, TMap<FDUIDSIndex, int32>& OutCounts) const;
+
+    // Number of accesses since MinTime; exact unless MinTime falls inside a bucket's span.
+    uint64 CountSince(double MinTime) const;
+
+    // Time covered by the coarsest tier's ring.
+    double GetSpanSeconds() const;
+
+    void Reset();
+
+private:
+    struct FBucket
+    {
+        int64 Number = INDEX_NONE; // Start time divided by the tier's width
+        uint64 Total = 0;
+        FHexademic6SpaceSaving Keys;
+    };
+
+    struct FTierState
+    {
+        double Width = 1.0;
+        int64 NewestNumber = INDEX_NONE; // Newest bucket ever claimed; bounds what coarser tiers hold
+        TArray<FBucket> Buckets;
+    };
+
+    // The bucket of the first tier, from FirstTier on, that can hold Time: its slot is free,
+    // already holds Time's bucket, or holds an older bucket, which is evicted to the next tier
+    // first. Null if Time is older than every candidate slot.
+    FBucket* FindBucket(int32 FirstTier, double Time);
+    void Evict(int32 TierIndex, FBucket& Bucket);
+
+    // Estimated share of Bucket's accesses at or after MinTime, in [0, 1].
+    double GetShareSince(int32 TierIndex, const FBucket& Bucket, double MinTime) const;
+
+    TArray<FTierState> Tiers;
+    int32 KeysPerBucket;
+};
+
+// =============================================================================
+// ACCESS TRACKER
+// =============================================================================
+
+// Records accesses into per-thread buffers and folds them into the shared statistics lazily:
+// when a thread's buffer fills up, or when statistics are queried. Recording an access is a
+// thread-local append under an uncontended lock; hashing, the sketch and the heavy-hitter
+// summaries are only touched during merges, in batches.
+class HEXADEMIC6LATTICE_API FHexademic6AccessTracker
+{
+public:
+    FHexademic6AccessTracker();
+    ~FHexademic6AccessTracker();
+
+    FHexademic6AccessTracker(const FHexademic6AccessTracker&) = delete;
+    FHexademic6AccessTracker& operator=(const FHexademic6AccessTracker&) = delete;
+
+    // Hot path. Time is in FPlatformTime::Seconds(). Thread-safe.
+    void RecordAccess(const FDUIDSIndex& Key, ECognitiveLatticeOrder Order, double Time);
+
+    // Bulk form: Keys[i] was accessed in Orders[i]. One buffer append for the whole batch.
+    void RecordAccesses(TConstArrayView<FDUIDSIndex> Keys, TConstArrayView<ECognitiveLatticeOrder> Orders, double Time);
+
+    // Merges every thread's pending accesses. Queries call it themselves.
+    void Flush();
+
+    // Adds already-aggregated lifetime counts, e.g. restored from a snapshot. They do not
+    // enter the access windows. Thread-safe.
+    void Restore(const FDUIDSIndex& Key, ECognitiveLatticeOrder Order, uint32 Count);
+
+    // Estimated lifetime access count of Key (never an undercount).
+    uint32 EstimateCount(const FDUIDSIndex& Key);
+
+    // Up to Count of the most accessed keys of Order, most accessed first.
+    void GetMostAccessed(ECognitiveLatticeOrder Order, int32 Count, TArray<FDUIDSIndex>& OutKeys);
+
+    // Keys accessed at or after MinTime, with their access counts since then (see
+    // FHexademic6AccessWindow for the error at the window edge).
+    void GetAccessedSince(double MinTime, TMap<FDUIDSIndex, int32>& OutCounts);
+
+    // Visits every heavy hitter with its estimated lifetime count, for snapshots.
+    void ForEachTracked(TFunctionRef<void(const FDUIDSIndex& Key, uint32 Count)> Visitor);
+
+    void Reset();
+
+private:
+    struct FAccessEvent
+    {
+        FDUIDSIndex Key;
+        double Time;
+        ECognitiveLatticeOrder Order;
+    };
+
+    struct FThreadBuffer
+    {
+        FCriticalSection Lock; // Only contended while another thread merges this buffer
+        TArray<FAccessEvent> Events;
+    };
+
+    FThreadBuffer& GetThreadBuffer();
+    void MergeBuffer(FThreadBuffer& Buffer);
+    void ApplyLifetimeLocked(const FDUIDSIndex& Key, ECognitiveLatticeOrder Order, uint32 Count);
+
+    uint32 TlsSlot;
+    FCriticalSection RegistryLock;
+    TArray<TUniquePtr<FThreadBuffer>> ThreadBuffers;
+
+    // MergeLock guards everything below. A buffer's lock may be taken while holding it; a thread
+    // holding its buffer's lock never waits for MergeLock.
+    FCriticalSection MergeLock;
+    FHexademic6CountMinSketch Sketch;
+    TStaticArray<FHexademic6SpaceSaving, FHexademic6OrderIndexing::NumOrders> HeavyHitters;
+    FHexademic6AccessWindow Window;
+    TArray<FAccessEvent> MergeScratch;
+};
@@ -0,0 +1,80 @@
+// Hexademic6CoherenceAggregates.h
+// Running per-order sums of memory influence, kept up to date by deltas and corrected by recomputes.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"  // For TStaticArray
+#include "HexademicSixLattice.h"     // For FHexademicMemoryNode, ECognitiveLatticeOrder
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::NumOrders
+
+class FHexademic6LatticeStore;
+
+// Sums over the memories of one order, or of the whole lattice.
+struct FHexademic6InfluenceAggregate
+{
+    double Sum = 0.0;
+    double SumSquares = 0.0;
+    int32 Count = 0;
+
+    // Mean influence, clamped to [0, 1]: the coherence the resonance service reports.
+    float GetCoherence() const { return Count > 0 ? FMath::Clamp((float)(Sum / Count), 0.0f, 1.0f) : 0.0f; }
+
+    float GetVariance() const
+    {
+        if (Count == 0)
+        {
+            return 0.0f;
+        }
+        const double Mean = Sum / Count;
+        return (float)FMath::Max(SumSquares / Count - Mean * Mean, 0.0);
+    }
+
+    void Add(const FHexademic6InfluenceAggregate& Other)
+    {
+        Sum += Other.Sum;
+        SumSquares += Other.SumSquares;
+        Count += Other.Count;
+    }
+};
+
+// =============================================================================
+// COHERENCE AGGREGATES
+// =============================================================================
+
+// Influence is ResonanceStrength * CognitiveWeight. The lattice store applies a delta for every
+// row it inserts, rewrites or removes (a migration is a removal plus an insertion), so coherence
+// reads are O(1) however many memories there are.
+//
+// Adding and subtracting floats drifts over time. Recompute rebuilds the sums exactly from the
+// data in one parallel pass. Memories are split into fixed chunks whose partial sums are added
+// in chunk order, so the result is bit-identical for any worker count. The store recomputes once
+// the deltas since the last recompute outnumber its memories, which keeps the amortized cost of
+// a delta O(1).
+class HEXADEMIC6LATTICE_API FHexademic6CoherenceAggregates
+{
+public:
+    static float GetInfluence(float ResonanceStrength, float CognitiveWeight) { return ResonanceStrength * CognitiveWeight; }
+
+    void Add(ECognitiveLatticeOrder Order, float Influence);
+    void Remove(ECognitiveLatticeOrder Order, float Influence);
+    void Update(ECognitiveLatticeOrder Order, float OldInfluence, float NewInfluence);
+    void Reset();
+
+    const FHexademic6InfluenceAggregate& GetOrder(ECognitiveLatticeOrder Order) const { return Orders[(uint8)Order]; }
+    FHexademic6InfluenceAggregate GetGlobal() const;
+
+    float GetOrderCoherence(ECognitiveLatticeOrder Order) const { return GetOrder(Order).GetCoherence(); }
+    float GetGlobalCoherence() const { return GetGlobal().GetCoherence(); }
+
+    // Deltas applied since the last Recompute or Reset.
+    int64 GetNumDeltas() const { return NumDeltas; }
+
+    // Replace the running sums with exact ones over the store's columns, or over Memories.
+    void Recompute(const FHexademic6LatticeStore& Store);
+    void Recompute(TConstArrayView<FHexademicMemoryNode> Memories);
+
+private:
+    TStaticArray<FHexademic6InfluenceAggregate, FHexademic6OrderIndexing::NumOrders> Orders;
+    int64 NumDeltas = 0;
+};
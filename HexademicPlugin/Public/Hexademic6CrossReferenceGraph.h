@@ -0,0 +1,97 @@
+// Hexademic6CrossReferenceGraph.h
+// Compressed sparse row graph of memory cross references, with multi-hop traversal queries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"     // For TBitArray
+#include "Templates/Function.h"      // For TFunctionRef
+#include "HexademicSixLattice.h"     // For FDUIDSIndex
+
+// =============================================================================
+// CROSS REFERENCE GRAPH
+// =============================================================================
+
+// Directed graph of FHexademicMemoryNode::CrossReferences over dense node ids. Every DUIDS key
+// that references or is referenced gets an id; ids index flat per-node arrays. Compact reclaims
+// the ids of nodes left with no edges in either direction and renumbers the rest, so ids are
+// only stable between compactions.
+//
+// Adjacency is a compressed sparse row layout (one offset per node into a single target array),
+// so a neighbor scan is one contiguous read. Updates do not rewrite it: a node whose references
+// change gets an override list that shadows its CSR row, and the overrides are folded back into
+// a fresh CSR once they hold a quarter as many edges as the CSR itself.
+//
+// Each node also carries a weight, set with its references; path queries may use it in their
+// edge costs. Not thread-safe; FDUIDSOrchestrator guards its graph with GraphLock. Traversals
+// only read, so any number of them may run together.
+class HEXADEMIC6LATTICE_API FHexademic6CrossReferenceGraph
+{
+public:
+    // Replaces Key's references and weight, unless they were last set with a higher Priority
+    // (1 is the lowest). Referenced keys without an id get one.
+    void SetReferences(const FDUIDSIndex& Key, TConstArrayView<FDUIDSIndex> References, float Weight, uint8 Priority);
+
+    // Clears Key's references. Edges from other nodes to it remain, and keep its id alive.
+    void RemoveReferences(const FDUIDSIndex& Key, uint8 Priority);
+
+    void Empty();
+
+    // Folds the overrides into the CSR arrays and reclaims unconnected nodes, which also drops
+    // their priorities. Called by SetReferences and RemoveReferences as overrides build up.
+    void Compact();
+
+    int32 Num() const { return Keys.Num(); }
+    int32 NumEdges() const { return NumLiveEdges; }
+    int32 FindNode(const FDUIDSIndex& Key) const;
+    const FDUIDSIndex& GetKey(int32 Node) const { return Keys[Node]; }
+    float GetWeight(int32 Node) const { return Weights[Node]; }
+
+    TConstArrayView<int32> GetNeighbors(int32 Node) const
+    {
+        if (Overridden[Node])
+        {
+            return Overrides.FindChecked(Node);
+        }
+        return Node + 1 < Offsets.Num() ? TConstArrayView<int32>(Targets.GetData() + Offsets[Node], Offsets[Node + 1] - Offsets[Node]) : TConstArrayView<int32>();
+    }
+
+    // Breadth-first search from Start: every node at most MaxHops references away, Start
+    // excluded, ordered by hop count and then by id. OutHops, if given, receives each node's
+    // hop count. Levels with large frontiers are expanded in parallel. A retired key keeps its id
+    // while anything still references it, so callers drop the ones whose key has been retired.
+    void GatherWithinHops(int32 Start, int32 MaxHops, TArray<int32>& OutNodes, TArray<int32>* OutHops = nullptr) const;
+
+    // True if To can be reached from From in at most MaxHops references.
+    bool IsReachable(int32 From, int32 To, int32 MaxHops = MAX_int32) const;
+
+    // Dijkstra from From to To. EdgeCost(Source, Target) must not be negative. Returns the path
+    // cost and fills OutPath with From..To, or returns a negative cost if To is unreachable.
+    float FindCheapestPath(int32 From, int32 To, TFunctionRef<float(int32 Source, int32 Target)> EdgeCost, TArray<int32>& OutPath) const;
+
+private:
+    // Visited set that frontier chunks may claim nodes in concurrently; sparse for short walks.
+    class FVisitedSet;
+
+    int32 FindOrAddNode(const FDUIDSIndex& Key);
+    bool ClaimNode(int32 Node, uint8 Priority);
+    void SetOverride(int32 Node, TArray<int32>&& NewTargets);
+
+    // Appends the unvisited neighbors of Frontier to OutNext, sorted by id.
+    void ExpandFrontier(TConstArrayView<int32> Frontier, FVisitedSet& Visited, TArray<int32>& OutNext) const;
+
+    // Per node
+    TArray<FDUIDSIndex> Keys;
+    TArray<float> Weights;
+    TArray<uint8> Priorities; // 0 while the node's references were never set
+    TMap<FDUIDSIndex, int32> NodeIds;
+
+    // CSR rows for nodes [0, Offsets.Num() - 1); later nodes have none until the next Compact.
+    TArray<int32> Offsets;
+    TArray<int32> Targets;
+
+    TBitArray<> Overridden;
+    TMap<int32, TArray<int32>> Overrides;
+    int32 NumOverrideEdges = 0;
+    int32 NumLiveEdges = 0;
+};
@@ -0,0 +1,129 @@
+// Hexademic6DUIDSCurve.h
+// Locality-preserving 6D Morton (Z-order) encoding of FDUIDSIndex keys.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HexademicSixLattice.h" // For FHexademic6DCoordinate, FDUIDSIndex, ECognitiveLatticeOrder
+
+// =============================================================================
+// DUIDS ENCODING MODES
+// =============================================================================
+
+// How FHexademic6DCoordinate maps onto an FDUIDSIndex.
+enum class EDUIDSEncodingMode : uint8
+{
+    // Legacy mapping: each DUIDS field is a bit slice of a single axis
+    // (MajorClass from X, Division from Y, ...). Spatially close memories scatter.
+    AxisSliced = 0,
+
+    // 12 bits per axis are bit-interleaved into a 72-bit Morton code that is laid out
+    // MSB-first across MajorClass(low 4) | Division(8) | Section(12) | SubSection(32) | Cutter(16).
+    // The high 4 bits of MajorClass hold the lattice order, so every order owns one contiguous
+    // block of keys. Because FDUIDSIndex compares field by field in that order, DUIDS order
+    // within a block equals Morton order and a DUIDS range covers a compact region of one
+    // order's lattice. Edition is left free.
+    Morton = 1,
+};
+
+// Inclusive DUIDS key range produced by box decomposition.
+struct FDUIDSIndexRange
+{
+    FDUIDSIndex Start;
+    FDUIDSIndex End;
+};
+
+// =============================================================================
+// MORTON CODEC
+// =============================================================================
+
+struct HEXADEMIC6LATTICE_API FHexademic6DUIDSCurve
+{
+    static constexpr int32 BitsPerAxis = 12;
+    static constexpr uint32 MaxCell = (1u << BitsPerAxis) - 1;
+
+    // A 72-bit Morton code split into two 36-bit halves (bits 0..35 and 36..71).
+    struct FCode
+    {
+        uint64 Hi = 0;
+        uint64 Lo = 0;
+
+        FORCEINLINE bool operator<(const FCode& Other) const { return Hi != Other.Hi ? Hi < Other.Hi : Lo < Other.Lo; }
+        FORCEINLINE bool operator==(const FCode& Other) const { return Hi == Other.Hi && Lo == Other.Lo; }
+        FORCEINLINE FCode Next() const
+        {
+            FCode Result = *this;
+            if (++Result.Lo == (1ull << 36))
+            {
+                Result.Lo = 0;
+                ++Result.Hi;
+            }
+            return Result;
+        }
+    };
+
+    // Active encoding mode, driven by the Hexademic.DUIDS.Encoding console variable.
+    // Switch modes only before any index is generated: a store must not mix encodings.
+    static EDUIDSEncodingMode GetEncodingMode();
+
+    // Per-order quantization of a signed axis into a 12-bit cell. Bounded orders keep every
+    // coordinate in (-Extent, Extent) exactly; OrderInfinite keeps the top 12 of 24 bits.
+    static FORCEINLINE int32 GetAxisBias(ECognitiveLatticeOrder Order)
+    {
+        switch (Order)
+        {
+            case ECognitiveLatticeOrder::Order6:   return 6;
+            case ECognitiveLatticeOrder::Order12:  return 12;
+            case ECognitiveLatticeOrder::Order24:  return 24;
+            case ECognitiveLatticeOrder::Order48:  return 48;
+            case ECognitiveLatticeOrder::Order96:  return 96;
+            case ECognitiveLatticeOrder::Order192: return 192;
+            default:                               return 1 << 23;
+        }
+    }
+
+    static FORCEINLINE int32 GetAxisShift(ECognitiveLatticeOrder Order)
+    {
+        return Order == ECognitiveLatticeOrder::OrderInfinite ? 12 : 0;
+    }
+
+    static FORCEINLINE uint32 QuantizeAxis(int32 Value, ECognitiveLatticeOrder Order)
+    {
+        const int64 Biased = static_cast<int64>(Value) + GetAxisBias(Order);
+        return static_cast<uint32>(FMath::Clamp<int64>(Biased >> GetAxisShift(Order), 0, MaxCell));
+    }
+
+    static FORCEINLINE int32 DequantizeAxis(uint32 Cell, ECognitiveLatticeOrder Order)
+    {
+        // Lossy cells decode to their center.
+        const int32 Shift = GetAxisShift(Order);
+        const int64 Center = (static_cast<int64>(Cell) << Shift) + (Shift > 0 ? (1ll << (Shift - 1)) : 0);
+        return static_cast<int32>(Center - GetAxisBias(Order));
+    }
+
+    // Cell-level codec. Cells are ordered X, Y, Z, W, U, V.
+    static FCode EncodeCells(const uint32 (&Cells)[6]);
+    static void DecodeCells(const FCode& Code, uint32 (&OutCells)[6]);
+
+    // Packs a code into DUIDS fields under Order's key prefix, and back. Edition is set by the caller.
+    static FDUIDSIndex ToDUIDSIndex(const FCode& Code, ECognitiveLatticeOrder Order, uint8 Edition = 0);
+    static FCode FromDUIDSIndex(const FDUIDSIndex& Index);
+
+    // The lattice order a Morton key was encoded for.
+    static FORCEINLINE ECognitiveLatticeOrder GetKeyOrder(const FDUIDSIndex& Index)
+    {
+        return static_cast<ECognitiveLatticeOrder>(Index.MajorClass >> 4);
+    }
+
+    // Coordinate-level codec for the coordinate's own LatticeOrder. Edition is carried over
+    // from Coord.DUIDSLocation so access-based editions survive re-encoding.
+    static FDUIDSIndex Encode(const FHexademic6DCoordinate& Coord);
+    static FHexademic6DCoordinate Decode(const FDUIDSIndex& Index, ECognitiveLatticeOrder Order);
+
+    // Covers the axis-aligned box [Min, Max] (inclusive, per axis) of Order's lattice with at
+    // most MaxRanges contiguous DUIDS ranges, all inside Order's key prefix. Aligned Morton
+    // blocks fully inside the box are exact; once the budget is reached, partially covered
+    // blocks are emitted whole, so callers that need an exact answer filter the scanned keys.
+    // Ranges are sorted and adjacent ones merged.
+    static void DecomposeBox(const FHexademic6DCoordinate& Min, const FHexademic6DCoordinate& Max, ECognitiveLatticeOrder Order, TArray<FDUIDSIndexRange>& OutRanges, int32 MaxRanges = 64);
+};
@@ -0,0 +1,332 @@
+// Hexademic6FlatMap.h
+// Open-addressing hash map keyed on packed DUIDS keys, probed sixteen slots at a time.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hexademic6PackedKey.h" // For FHexademic6PackedKey
+#include <type_traits>
+
+// Control bytes are matched sixteen at a time with SSE2 on x86. Other platforms, or 0 here,
+// use the scalar loop, which gives the same results.
+#ifndef HEXADEMIC6_SIMD_PROBING
+#define HEXADEMIC6_SIMD_PROBING (PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY)
+#endif
+
+#if HEXADEMIC6_SIMD_PROBING
+#include <emmintrin.h>
+#endif
+
+// =============================================================================
+// FLAT MAP
+// =============================================================================
+
+// Keys and values live inline in one slot array, with a parallel array of one control byte per
+// slot: empty, deleted, or the top 7 bits of the key's hash. A lookup starts at the slot picked
+// by the low hash bits and matches a group of sixteen control bytes against the 7-bit tag in a
+// single compare; only slots whose tag matches have their key compared, and the first group
+// with an empty byte ends the probe. A hit is typically one control cache line plus one slot.
+// Compared with TMap there are no per-entry hash links, sparse-array indices or free lists.
+//
+// The table grows by doubling at a load of 7/8. Removal leaves a tombstone that later
+// inserts reuse; a table full of tombstones is rehashed at the same size. Adding or removing
+// entries invalidates pointers to values and running iterations.
+template<typename ValueType>
+class THexademic6FlatMap
+{
+public:
+    struct FEntry
+    {
+        FHexademic6PackedKey Key;
+        ValueType Value;
+    };
+
+    THexademic6FlatMap() = default;
+
+    int32 Num() const { return NumEntries; }
+    int32 GetCapacity() const { return Capacity; }
+
+    SIZE_T GetAllocatedSize() const
+    {
+        return Control.GetAllocatedSize() + Slots.GetAllocatedSize();
+    }
+
+    void Empty()
+    {
+        Control.Empty();
+        Slots.Empty();
+        Capacity = 0;
+        NumEntries = 0;
+        GrowthLeft = 0;
+    }
+
+    // Keeps the allocation.
+    void Reset()
+    {
+        if (Capacity > 0)
+        {
+            FMemory::Memset(Control.GetData(), EmptyByte, Control.Num());
+        }
+        NumEntries = 0;
+        GrowthLeft = GetMaxLoad(Capacity);
+    }
+
+    void Reserve(int32 Number)
+    {
+        int32 NewCapacity = FMath::Max(Capacity, GroupSize);
+        while (GetMaxLoad(NewCapacity) < Number)
+        {
+            NewCapacity *= 2;
+        }
+        if (NewCapacity != Capacity)
+        {
+            Rehash(NewCapacity);
+        }
+    }
+
+    ValueType* Find(const FHexademic6PackedKey& Key)
+    {
+        const int32 Slot = FindSlot(Key, Key.GetHash64());
+        return Slot != INDEX_NONE ? &Slots[Slot].Value : nullptr;
+    }
+    const ValueType* Find(const FHexademic6PackedKey& Key) const
+    {
+        return const_cast<THexademic6FlatMap*>(this)->Find(Key);
+    }
+    ValueType* Find(const FDUIDSIndex& Key) { return Find(FHexademic6PackedKey(Key)); }
+    const ValueType* Find(const FDUIDSIndex& Key) const { return Find(FHexademic6PackedKey(Key)); }
+
+    bool Contains(const FHexademic6PackedKey& Key) const { return Find(Key) != nullptr; }
+    bool Contains(const FDUIDSIndex& Key) const { return Find(Key) != nullptr; }
+
+    // Inserts Key, or overwrites its value if present.
+    ValueType& Add(const FHexademic6PackedKey& Key, const ValueType& Value)
+    {
+        ValueType& Stored = FindOrAdd(Key);
+        Stored = Value;
+        return Stored;
+    }
+    ValueType& Add(const FDUIDSIndex& Key, const ValueType& Value) { return Add(FHexademic6PackedKey(Key), Value); }
+
+    // Value of Key, default-constructed if Key was not present.
+    ValueType& FindOrAdd(const FHexademic6PackedKey& Key)
+    {
+        const uint64 Hash = Key.GetHash64();
+        int32 Slot = FindSlot(Key, Hash);
+        if (Slot != INDEX_NONE)
+        {
+            return Slots[Slot].Value;
+        }
+        Slot = FindInsertSlot(Hash);
+        if (Capacity == 0 || (GrowthLeft == 0 && Control[Slot] == EmptyByte))
+        {
+            // Out of room: grow, or just clear tombstones if at most half the slots are live.
+            Rehash(Capacity == 0 ? GroupSize : (NumEntries * 2 <= GetMaxLoad(Capacity) ? Capacity : Capacity * 2));
+            Slot = FindInsertSlot(Hash);
+        }
+        if (Control[Slot] == EmptyByte)
+        {
+            --GrowthLeft;
+        }
+        SetControl(Slot, GetTag(Hash));
+        Slots[Slot].Key = Key;
+        Slots[Slot].Value = ValueType();
+        ++NumEntries;
+        return Slots[Slot].Value;
+    }
+    ValueType& FindOrAdd(const FDUIDSIndex& Key) { return FindOrAdd(FHexademic6PackedKey(Key)); }
+
+    bool Remove(const FHexademic6PackedKey& Key)
+    {
+        const int32 Slot = FindSlot(Key, Key.GetHash64());
+        if (Slot == INDEX_NONE)
+        {
+            return false;
+        }
+        RemoveSlot(Slot);
+        return true;
+    }
+    bool Remove(const FDUIDSIndex& Key) { return Remove(FHexademic6PackedKey(Key)); }
+
+    bool RemoveAndCopyValue(const FHexademic6PackedKey& Key, ValueType& OutValue)
+    {
+        const int32 Slot = FindSlot(Key, Key.GetHash64());
+        if (Slot == INDEX_NONE)
+        {
+            return false;
+        }
+        OutValue = MoveTemp(Slots[Slot].Value);
+        RemoveSlot(Slot);
+        return true;
+    }
+    bool RemoveAndCopyValue(const FDUIDSIndex& Key, ValueType& OutValue) { return RemoveAndCopyValue(FHexademic6PackedKey(Key), OutValue); }
+
+    // Iteration visits live entries in slot order, which is unrelated to key order.
+    template<bool bConst>
+    class TBaseIterator
+    {
+    public:
+        using MapType = std::conditional_t<bConst, const THexademic6FlatMap, THexademic6FlatMap>;
+        using EntryType = std::conditional_t<bConst, const FEntry, FEntry>;
+
+        TBaseIterator(MapType& InMap, int32 InSlot) : Map(InMap), Slot(InSlot) { SkipFree(); }
+
+        EntryType& operator*() const { return Map.Slots[Slot]; }
+        EntryType* operator->() const { return &Map.Slots[Slot]; }
+        TBaseIterator& operator++() { ++Slot; SkipFree(); return *this; }
+        bool operator!=(const TBaseIterator& Other) const { return Slot != Other.Slot; }
+
+    private:
+        void SkipFree()
+        {
+            while (Slot < Map.Capacity && !IsFull(Map.Control[Slot]))
+            {
+                ++Slot;
+            }
+        }
+
+        MapType& Map;
+        int32 Slot;
+    };
+
+    TBaseIterator<false> begin() { return TBaseIterator<false>(*this, 0); }
+    TBaseIterator<false> end() { return TBaseIterator<false>(*this, Capacity); }
+    TBaseIterator<true> begin() const { return TBaseIterator<true>(*this, 0); }
+    TBaseIterator<true> end() const { return TBaseIterator<true>(*this, Capacity); }
+
+private:
+    static constexpr int32 GroupSize = 16;
+    static constexpr uint8 EmptyByte = 0x80;
+    static constexpr uint8 DeletedByte = 0xFE;
+
+    static FORCEINLINE bool IsFull(uint8 ControlByte) { return ControlByte < 0x80; }
+    static FORCEINLINE uint8 GetTag(uint64 Hash) { return (uint8)(Hash >> 57); }
+    static FORCEINLINE int32 GetMaxLoad(int32 InCapacity) { return InCapacity - InCapacity / 8; }
+
+    // Bit i set if the control byte at Group[i] equals Byte.
+    static FORCEINLINE uint32 MatchByte(const uint8* Group, uint8 Byte)
+    {
+#if HEXADEMIC6_SIMD_PROBING
+        const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Group));
+        return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, _mm_set1_epi8((char)Byte)));
+#else
+        uint32 Mask = 0;
+        for (int32 Index = 0; Index < GroupSize; ++Index)
+        {
+            Mask |= (uint32)(Group[Index] == Byte) << Index;
+        }
+        return Mask;
+#endif
+    }
+
+    // Bit i set if Group[i] is empty or deleted, the only bytes with the high bit set.
+    static FORCEINLINE uint32 MatchFree(const uint8* Group)
+    {
+#if HEXADEMIC6_SIMD_PROBING
+        return (uint32)_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Group)));
+#else
+        uint32 Mask = 0;
+        for (int32 Index = 0; Index < GroupSize; ++Index)
+        {
+            Mask |= (uint32)(Group[Index] >> 7) << Index;
+        }
+        return Mask;
+#endif
+    }
+
+    // Groups start anywhere; the control array repeats its first GroupSize bytes past the end,
+    // so a group that wraps around is still one contiguous load. Successive groups are
+    // GroupSize, 2 * GroupSize, ... slots further, which visits every group of a power-of-two table.
+    int32 FindSlot(const FHexademic6PackedKey& Key, uint64 Hash) const
+    {
+        if (NumEntries == 0)
+        {
+            return INDEX_NONE;
+        }
+        const uint32 Mask = (uint32)Capacity - 1;
+        const uint8 Tag = GetTag(Hash);
+        uint32 Position = (uint32)Hash & Mask;
+        for (uint32 Stride = GroupSize; ; Stride += GroupSize)
+        {
+            const uint8* Group = Control.GetData() + Position;
+            for (uint32 Matches = MatchByte(Group, Tag); Matches != 0; Matches &= Matches - 1)
+            {
+                const int32 Slot = (int32)((Position + FMath::CountTrailingZeros(Matches)) & Mask);
+                if (Slots[Slot].Key == Key)
+                {
+                    return Slot;
+                }
+            }
+            if (MatchByte(Group, EmptyByte) != 0)
+            {
+                return INDEX_NONE;
+            }
+            Position = (Position + Stride) & Mask;
+        }
+    }
+
+    // First empty or deleted slot on Hash's probe sequence.
+    int32 FindInsertSlot(uint64 Hash) const
+    {
+        if (Capacity == 0)
+        {
+            return 0; // FindOrAdd allocates and asks again
+        }
+        const uint32 Mask = (uint32)Capacity - 1;
+        uint32 Position = (uint32)Hash & Mask;
+        for (uint32 Stride = GroupSize; ; Stride += GroupSize)
+        {
+            if (const uint32 Free = MatchFree(Control.GetData() + Position))
+            {
+                return (int32)((Position + FMath::CountTrailingZeros(Free)) & Mask);
+            }
+            Position = (Position + Stride) & Mask;
+        }
+    }
+
+    void SetControl(int32 Slot, uint8 Byte)
+    {
+        Control[Slot] = Byte;
+        if (Slot < GroupSize)
+        {
+            Control[Capacity + Slot] = Byte;
+        }
+    }
+
+    void RemoveSlot(int32 Slot)
+    {
+        SetControl(Slot, DeletedByte);
+        Slots[Slot].Value = ValueType();
+        --NumEntries;
+    }
+
+    void Rehash(int32 NewCapacity)
+    {
+        check(FMath::IsPowerOfTwo(NewCapacity) && NewCapacity >= GroupSize);
+        TArray<uint8> OldControl = MoveTemp(Control);
+        TArray<FEntry> OldSlots = MoveTemp(Slots);
+        const int32 OldCapacity = Capacity;
+
+        Capacity = NewCapacity;
+        Control.Init(EmptyByte, Capacity + GroupSize);
+        Slots.SetNum(Capacity);
+        GrowthLeft = GetMaxLoad(Capacity) - NumEntries;
+        for (int32 OldSlot = 0; OldSlot < OldCapacity; ++OldSlot)
+        {
+            if (IsFull(OldControl[OldSlot]))
+            {
+                FEntry& Entry = OldSlots[OldSlot];
+                const uint64 Hash = Entry.Key.GetHash64();
+                const int32 Slot = FindInsertSlot(Hash);
+                SetControl(Slot, GetTag(Hash));
+                Slots[Slot] = MoveTemp(Entry);
+            }
+        }
+    }
+
+    TArray<uint8> Control; // Capacity + GroupSize bytes
+    TArray<FEntry> Slots;
+    int32 Capacity = 0;    // Zero or a power of two of at least GroupSize
+    int32 NumEntries = 0;
+    int32 GrowthLeft = 0;  // Empty slots that may still be filled before a rehash
+};
@@ -0,0 +1,105 @@
+// Hexademic6FrameBudget.h
+// Hard per-tick time budgets for incremental work, driven by running per-unit cost estimates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h" // For FPlatformTime::Seconds()
+
+// =============================================================================
+// COST ESTIMATE
+// =============================================================================
+
+// Running average of the measured cost, in microseconds, of one unit of budgeted work: a
+// migration move, a wave chunk. A single sample moves the average by at most MaxSampleRatio of
+// itself, so one outlier cannot throw it far, while a sustained change goes through over a few
+// samples.
+class FHexademic6CostEstimate
+{
+public:
+    explicit FHexademic6CostEstimate(double InitialMicroseconds)
+        : Average(InitialMicroseconds)
+    {
+    }
+
+    double Get() const { return Average; }
+
+    void AddSample(double Microseconds)
+    {
+        Average += (FMath::Min(Microseconds, Average * MaxSampleRatio) - Average) * SampleWeight;
+    }
+
+    // Halves the estimate, but not below BudgetMicroseconds. See FHexademic6FrameBudget::RelaxIfStalled.
+    void Relax(double BudgetMicroseconds)
+    {
+        Average = FMath::Max(Average * 0.5, BudgetMicroseconds);
+    }
+
+private:
+    static constexpr double MaxSampleRatio = 4.0;
+    static constexpr double SampleWeight = 0.125;
+
+    double Average;
+};
+
+// =============================================================================
+// FRAME BUDGET
+// =============================================================================
+
+// One tick's deadline. A unit of work only starts if its estimate fits in the time left, and
+// EndUnit feeds its measured cost back into the estimate:
+//
+//     FHexademic6FrameBudget Frame(BudgetMicroseconds);
+//     while (HasWork() && Frame.Fits(UnitCost)) { DoUnit(); Frame.EndUnit(UnitCost); }
+//     Frame.RelaxIfStalled(UnitCost, HasWork());
+//
+// An estimate above the whole budget never fits, so it would get no new samples and its work
+// would wait forever. RelaxIfStalled lowers such an estimate on every tick that leaves work
+// waiting, down to the budget, at which point the next tick runs one unit and re-measures it.
+// Units that really cost more than the budget therefore still run, about one every other tick,
+// each overrunning the budget by its excess.
+class FHexademic6FrameBudget
+{
+public:
+    explicit FHexademic6FrameBudget(double InBudgetMicroseconds)
+        : BudgetMicroseconds(InBudgetMicroseconds)
+        , Now(FPlatformTime::Seconds())
+        , Deadline(Now + InBudgetMicroseconds * 1e-6)
+    {
+    }
+
+    double GetBudget() const { return BudgetMicroseconds; }
+
+    // Time at which the tick started or the last unit ended, in FPlatformTime::Seconds().
+    double GetNow() const { return Now; }
+
+    bool Fits(const FHexademic6CostEstimate& Estimate) const
+    {
+        return Now + Estimate.Get() * 1e-6 <= Deadline;
+    }
+
+    // Ends the unit started at GetNow() and adds its cost to Estimate.
+    void EndUnit(FHexademic6CostEstimate& Estimate)
+    {
+        const double After = FPlatformTime::Seconds();
+        Estimate.AddSample((After - Now) * 1e6);
+        Now = After;
+    }
+
+    // Relaxes Estimate if it exceeds the whole budget while work is waiting, and returns true in
+    // that case. A zero budget disables the work rather than stalling it, and is left alone.
+    bool RelaxIfStalled(FHexademic6CostEstimate& Estimate, bool bWorkWaiting) const
+    {
+        if (!bWorkWaiting || BudgetMicroseconds <= 0.0 || Estimate.Get() <= BudgetMicroseconds)
+        {
+            return false;
+        }
+        Estimate.Relax(BudgetMicroseconds);
+        return true;
+    }
+
+private:
+    double BudgetMicroseconds;
+    double Now;
+    double Deadline;
+};
@@ -0,0 +1,76 @@
+// Hexademic6HotspotDetector.h
+// Density clustering of the resonance field into hotspots, re-clustered incrementally as it changes.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"  // For TStaticArray
+#include "HexademicSixLattice.h"     // For FHexademic6DCoordinate, ECognitiveLatticeOrder
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::NumOrders
+
+class FHexademic6ResonanceField;
+
+struct FHexademic6ResonanceHotspot
+{
+    FHexademic6DCoordinate Centroid; // Density-weighted, in the order's lattice units
+    float Intensity = 0.0f;          // Summed field value over the hotspot's voxels
+    float PeakDensity = 0.0f;        // Highest field value in the hotspot
+    int32 NumMembers = 0;            // Memories whose nearest field vertex lies in the hotspot
+    int32 NumVoxels = 0;
+};
+
+// =============================================================================
+// HOTSPOT DETECTOR
+// =============================================================================
+
+// Grid DBSCAN over the resonance field's voxels. The field is already a kernel density estimate
+// of memory influence, so a voxel is dense when its value reaches Hexademic.Hotspots.MinDensity,
+// and a hotspot is a set of dense voxels connected through their 12 axis neighbors. Nothing else
+// decides membership, so a voxel's status only changes when the voxel itself does.
+//
+// A full clustering classifies every voxel of the order and joins neighbors with a lock-free
+// union-find, both in parallel. Components always take their lowest-indexed voxel as root, so
+// the result does not depend on scheduling.
+//
+// Between queries the detector only collects the voxels the field reports changed. The next
+// query dissolves the hotspots those voxels belong to, and re-clusters just the changed voxels
+// and the dissolved hotspots' voxels, merging with any untouched hotspot they now connect to.
+class HEXADEMIC6LATTICE_API FHexademic6HotspotDetector
+{
+public:
+    // Takes the voxels the field changed since the last call, for every order. Call after each
+    // field update.
+    void CollectChanges(FHexademic6ResonanceField& Field);
+
+    // The MaxHotspots most intense hotspots of Order, most intense first. A negative MaxHotspots
+    // uses Hexademic.Hotspots.MaxResults. Field must be the field changes were collected from.
+    void FindHotspots(const FHexademic6ResonanceField& Field, ECognitiveLatticeOrder Order, int32 MaxHotspots, TArray<FHexademic6ResonanceHotspot>& OutHotspots);
+
+    // Forgets every hotspot; the next query clusters from scratch.
+    void Reset();
+
+private:
+    struct FCluster
+    {
+        TArray<uint64> Voxels;
+        uint64 RootKey = 0; // Smallest voxel key; orders equally intense hotspots the same way in full and incremental runs
+        FHexademic6ResonanceHotspot Hotspot;
+    };
+
+    struct FOrderState
+    {
+        TMap<uint64, int32> VoxelClusters; // Dense voxel -> its index in Clusters
+        TSparseArray<FCluster> Clusters;
+        TSet<uint64> PendingVoxels;
+        bool bFullRecluster = true;
+        float MinDensity = 0.0f; // Threshold the current clusters were built with
+    };
+
+    void Recluster(const FHexademic6ResonanceField& Field, ECognitiveLatticeOrder Order, FOrderState& State, float MinDensity);
+
+    // Removes a cluster, appending its voxels to OutVoxels.
+    static void Dissolve(FOrderState& State, int32 ClusterIndex, TArray<uint64>& OutVoxels);
+
+    FCriticalSection Lock;
+    TStaticArray<FOrderState, FHexademic6OrderIndexing::NumOrders> Orders;
+};
@@ -0,0 +1,131 @@
+// Hexademic6LatticeStore.h
+// Structure-of-arrays storage for FHexademicMemoryNode, one column set per lattice order.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"  // For TStaticArray
+#include "HexademicSixLattice.h"     // For FHexademicMemoryNode, ECognitiveLatticeOrder
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::NumOrders
+#include "Hexademic6SpatialIndex.h"  // For FHexademicNodeHandle, FHexademic6SpatialIndex
+#include "Hexademic6CoherenceAggregates.h" // For FHexademic6CoherenceAggregates
+
+// =============================================================================
+// PER-ORDER COLUMNS
+// =============================================================================
+
+// Hot fields live in parallel, densely packed arrays indexed by row, so passes that only read a
+// few floats per node stream nothing else through the cache. Rows are kept dense with
+// swap-removal; stable node handles go through the Slot <-> Row indirection.
+// The cold payload (strings, cross references, ...) holds only the node fields that have no
+// column, serialized per row; materialization deserializes it and fills in the rest from the columns.
+struct HEXADEMIC6LATTICE_API FHexademic6OrderColumns
+{
+    using FArchetypeList = TArray<uint32, TInlineAllocator<4>>;
+
+    // Hot columns
+    TArray<float> ResonanceStrength;
+    TArray<float> CognitiveWeight;
+    TArray<float> TemporalDecay;
+    TArray<int32> AccessCount;
+    TArray<float> EmotionalValence;
+    TArray<float> EmotionalIntensity;
+    TArray<float> MythicDepth;
+    TArray<int32> X;
+    TArray<int32> Y;
+    TArray<int32> Z;
+    TArray<int32> W;
+    TArray<int32> U;
+    TArray<int32> V;
+    TArray<FArchetypeList> Archetypes;
+
+    // Identity and cold payload
+    TArray<FGuid> MemoryIDs;
+    TArray<FDUIDSIndex> DUIDSLocations;
+    TArray<TArray<uint8>> ColdPayloads;
+
+    // Handle indirection and spatial grid
+    TArray<int32> RowToSlot;
+    TArray<int32> GridSlots;
+
+    int32 Num() const { return MemoryIDs.Num(); }
+
+    FHexademic6DCoordinate GetPosition(int32 Row, ECognitiveLatticeOrder Order) const
+    {
+        FHexademic6DCoordinate Position(X[Row], Y[Row], Z[Row], W[Row], U[Row], V[Row], Order);
+        Position.DUIDSLocation = DUIDSLocations[Row];
+        return Position;
+    }
+};
+
+// =============================================================================
+// LATTICE STORE
+// =============================================================================
+
+// Owns every memory node of the cognitive lattice in columnar form, one FHexademic6OrderColumns
+// per ECognitiveLatticeOrder, and keeps the per-order spatial grid and the coherence aggregates
+// in sync with it.
+class HEXADEMIC6LATTICE_API FHexademic6LatticeStore
+{
+public:
+    FHexademic6LatticeStore();
+
+    // Inserts Memory in the order of its LatticePosition, or updates it in place if it is
+    // already stored. A changed LatticeOrder migrates the node between column sets.
+    FHexademicNodeHandle AddOrUpdate(const FHexademicMemoryNode& Memory);
+    bool Remove(const FGuid& MemoryID);
+    void Empty();
+
+    FHexademicNodeHandle FindHandle(const FGuid& MemoryID) const;
+    bool IsValidHandle(const FHexademicNodeHandle& Handle) const;
+    int32 GetRow(const FHexademicNodeHandle& Handle) const { return SlotToRow[static_cast<uint8>(Handle.Order)][Handle.Slot]; }
+    FHexademicNodeHandle GetHandle(ECognitiveLatticeOrder Order, int32 Row) const { return FHexademicNodeHandle(Order, GetColumns(Order).RowToSlot[Row]); }
+
+    // Sets one node's resonance and applies the delta to the coherence aggregates.
+    void SetResonanceStrength(const FHexademicNodeHandle& Handle, float ResonanceStrength);
+
+    // Running influence sums per order, updated by every insert, rewrite, removal and migration.
+    const FHexademic6CoherenceAggregates& GetCoherence() const { return Coherence; }
+
+    // Rebuilds the coherence aggregates from the columns. Done automatically as deltas pile up;
+    // call it after writing ResonanceStrength or CognitiveWeight through GetMutableColumns.
+    void RecomputeCoherence();
+
+    // Column access for hot passes. Mutating column values is allowed; changing row counts is not.
+    // Writes to ResonanceStrength or CognitiveWeight bypass the coherence aggregates.
+    const FHexademic6OrderColumns& GetColumns(ECognitiveLatticeOrder Order) const { return Columns[static_cast<uint8>(Order)]; }
+    FHexademic6OrderColumns& GetMutableColumns(ECognitiveLatticeOrder Order) { return Columns[static_cast<uint8>(Order)]; }
+
+    int32 Num(ECognitiveLatticeOrder Order) const { return GetColumns(Order).Num(); }
+    int32 NumTotal() const;
+
+    // Materializes full nodes on demand from the columns plus the cold payload.
+    void MaterializeRow(ECognitiveLatticeOrder Order, int32 Row, FHexademicMemoryNode& OutMemory) const;
+    bool Materialize(const FHexademicNodeHandle& Handle, FHexademicMemoryNode& OutMemory) const;
+    TOptional<FHexademicMemoryNode> GetMemory(const FGuid& MemoryID) const;
+    TArray<FHexademicMemoryNode> GetMemoriesInOrder(ECognitiveLatticeOrder Order) const;
+
+    // Neighbor queries over the per-order grid, returned as store handles.
+    void QueryRadius(const FHexademic6DCoordinate& Center, float Radius, TArray<FHexademicNodeHandle>& OutHandles) const;
+    void QueryKNearest(const FHexademic6DCoordinate& Center, int32 K, TArray<FHexademicNodeHandle>& OutHandles, const FGuid& ExcludeID = FGuid()) const;
+
+    // Runs FHexademicMemoryNode::DetermineOptimalOrder for rows [FirstRow, FirstRow + NumRows) of
+    // Order and appends every node that wants to move. Only hot columns are read: a single
+    // scratch node carries them into the promotion and decay predicates.
+    void EvaluateOptimalOrders(ECognitiveLatticeOrder Order, int32 FirstRow, int32 NumRows, TArray<TPair<FHexademicNodeHandle, ECognitiveLatticeOrder>>& OutMoves) const;
+
+private:
+    void WriteRow(ECognitiveLatticeOrder Order, int32 Row, const FHexademicMemoryNode& Memory);
+    void RemoveRow(ECognitiveLatticeOrder Order, int32 Row);
+    void CopyScratch(ECognitiveLatticeOrder Order, int32 Row, FHexademicMemoryNode& Scratch) const;
+    float GetInfluence(ECognitiveLatticeOrder Order, int32 Row) const;
+    void RecomputeCoherenceIfDrifting();
+
+    TStaticArray<FHexademic6OrderColumns, FHexademic6OrderIndexing::NumOrders> Columns;
+    TStaticArray<FHexademic6SpatialIndex, FHexademic6OrderIndexing::NumOrders> Grids;
+    TStaticArray<TArray<int32>, FHexademic6OrderIndexing::NumOrders> SlotToRow;
+    TStaticArray<TArray<int32>, FHexademic6OrderIndexing::NumOrders> FreeSlots;
+    TStaticArray<TArray<int32>, FHexademic6OrderIndexing::NumOrders> GridSlotToSlot;
+    TMap<FGuid, FHexademicNodeHandle> HandlesByMemory;
+    FHexademic6CoherenceAggregates Coherence;
+};
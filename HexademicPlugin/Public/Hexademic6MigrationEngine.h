@@ -0,0 +1,89 @@
+// Hexademic6MigrationEngine.h
+// Background promotion and decay of memory nodes between lattice orders, in time-budgeted slices.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HexademicSixLattice.h"     // For FHexademicMemoryNode, ECognitiveLatticeOrder, FDUIDSOrchestrator
+#include "Hexademic6SpatialIndex.h"  // For FHexademicNodeHandle
+#include "Hexademic6FrameBudget.h"   // For FHexademic6CostEstimate
+
+class FHexademic6LatticeStore;
+
+struct FHexademic6MigrationStats
+{
+    int64 Evaluated = 0; // Rows run through DetermineOptimalOrder
+    int64 Queued = 0;
+    int64 Promoted = 0;
+    int64 Demoted = 0;
+    int64 Dropped = 0;   // Queued moves whose node was gone or no longer wanted to move
+    int32 Pending = 0;
+    int32 Sweeps = 0;    // Completed passes over every order
+};
+
+// =============================================================================
+// MIGRATION ENGINE
+// =============================================================================
+
+// Applies FHexademicMemoryNode::DetermineOptimalOrder to the whole lattice store. A cursor sweeps
+// every order's columns in row batches through FHexademic6LatticeStore::EvaluateOptimalOrders and
+// queues the nodes that want another order. Queued moves are applied first in, first out; each one
+// projects the node's position to its new order, re-indexes it in the orchestrator, moves its
+// stored record and migrates its row to the new order's columns.
+//
+// Tick does both under a hard time budget: a move or batch only starts if its running average
+// cost fits in what is left of the budget, so a wave of demotions is spread over as many frames
+// as it needs. A move is one node's re-index, record re-encode and row migration; orchestrator
+// snapshots its mutations would trigger are deferred to the end of the tick. A tick may still
+// overrun by the difference between one move's actual and estimated cost, and moves that cost
+// more than the whole budget run every few ticks rather than never (see FHexademic6FrameBudget).
+// Evaluation pauses
+// while the queue is full. Rows are swap-removed as nodes move, so a sweep may miss a node,
+// which the next sweep picks up; the queue holds each node at most once.
+// Not thread-safe: ticked by the owner of the store, on the thread that mutates it.
+class HEXADEMIC6LATTICE_API FHexademic6MigrationEngine
+{
+public:
+    // Orchestrator may be null, in which case moves only touch the store.
+    FHexademic6MigrationEngine(FHexademic6LatticeStore& InStore, FDUIDSOrchestrator* InOrchestrator);
+
+    // Runs for at most BudgetMicroseconds, or Hexademic.Migration.FrameBudgetMicroseconds if negative.
+    void Tick(double BudgetMicroseconds = -1.0);
+
+    // Restarts the sweep and drops every queued move.
+    void Reset();
+
+    FHexademic6MigrationStats GetStats() const;
+
+private:
+    struct FPendingMove
+    {
+        FGuid MemoryID;
+        ECognitiveLatticeOrder SourceOrder;
+    };
+
+    // Evaluates the next batch of rows at the cursor. False once the current sweep is complete.
+    bool EvaluateNextBatch();
+    void ApplyMove(const FPendingMove& Move);
+
+    int32 NumPending() const { return Queue.Num() - QueueHead; }
+
+    FHexademic6LatticeStore& Store;
+    FDUIDSOrchestrator* Orchestrator;
+
+    TArray<FPendingMove> Queue;
+    int32 QueueHead = 0;
+    TSet<FGuid> QueuedIDs;
+
+    uint8 CursorOrder = 0;
+    int32 CursorRow = 0;
+    double NextSweepTime = 0.0;
+
+    FHexademic6CostEstimate MoveCost;
+    FHexademic6CostEstimate BatchCost;
+    bool bWarnedMoveBudget = false;
+
+    TArray<TPair<FHexademicNodeHandle, ECognitiveLatticeOrder>> BatchMoves;
+    FHexademicMemoryNode MoveScratch;
+    FHexademic6MigrationStats Stats;
+};
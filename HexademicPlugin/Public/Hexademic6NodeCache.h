@@ -0,0 +1,137 @@
+// Hexademic6NodeCache.h
+// Byte-budgeted, scan-resistant cache of decoded memory nodes and their sliced attributes.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HexademicSixLattice.h"      // For FDUIDSIndex, FHexademicMemoryNode
+#include "Hexademic6AccessTracker.h"  // For FHexademic6CountMinSketch
+#include "Hexademic6FlatMap.h"        // For THexademic6FlatMap
+
+// Sliced attributes served without touching the record.
+struct FHexademic6CachedSlices
+{
+    float ResonanceStrength = 0.0f;
+    FVector EmotionalSignature = FVector::ZeroVector; // Valence, intensity, mythic depth
+};
+
+struct FHexademic6CacheStats
+{
+    int64 Hits = 0;
+    int64 Misses = 0;
+    int64 Evictions = 0;   // Entries dropped to stay within budget, rejected admissions included
+    int64 Rejections = 0;  // Candidates TinyLFU refused to admit over a more frequent victim
+    int64 Invalidations = 0;
+    int64 Bytes = 0;
+    int32 Entries = 0;
+
+    FHexademic6CacheStats& operator+=(const FHexademic6CacheStats& Other)
+    {
+        Hits += Other.Hits;
+        Misses += Other.Misses;
+        Evictions += Other.Evictions;
+        Rejections += Other.Rejections;
+        Invalidations += Other.Invalidations;
+        Bytes += Other.Bytes;
+        Entries += Other.Entries;
+        return *this;
+    }
+};
+
+// =============================================================================
+// NODE CACHE
+// =============================================================================
+
+// W-TinyLFU: new entries enter a small LRU admission window (1% of the budget). Entries leaving
+// the window compete with the main cache's LRU victim and are only admitted if a frequency
+// sketch has seen them more often, so one-off scans cannot flush the working set. The main
+// cache is a segmented LRU: entries hit while on probation are promoted to the protected
+// segment (80% of the main budget), whose overflow is demoted back to probation. The sketch
+// counts every lookup and is halved periodically so frequencies follow recent use.
+//
+// An entry holds the sliced attributes of a key and, optionally, its decoded node; it is
+// charged its approximate heap footprint. Not thread-safe; FDUIDSOrchestrator guards each
+// shard's cache with the shard's CacheLock.
+class HEXADEMIC6LATTICE_API FHexademic6NodeCache
+{
+public:
+    explicit FHexademic6NodeCache(int64 InBudgetBytes = 4 << 20);
+
+    // Shrinking the budget evicts down to it immediately.
+    void SetBudget(int64 InBudgetBytes);
+    int64 GetBudget() const { return BudgetBytes; }
+
+    // Lookups count towards hits, misses and the key's frequency.
+    bool FindNode(const FDUIDSIndex& Key, FHexademicMemoryNode& OutNode);
+    bool FindSlices(const FDUIDSIndex& Key, FHexademic6CachedSlices& OutSlices);
+
+    // Caches a decoded node, and the slices derived from it. PayloadBytes is the node's heap
+    // footprint beyond sizeof(FHexademicMemoryNode), e.g. its serialized size.
+    void AddNode(const FDUIDSIndex& Key, const FHexademicMemoryNode& Node, int64 PayloadBytes);
+    void AddSlices(const FDUIDSIndex& Key, const FHexademic6CachedSlices& Slices);
+
+    void Invalidate(const FDUIDSIndex& Key);
+    void Empty();
+
+    FHexademic6CacheStats GetStats() const;
+
+private:
+    enum class ESegment : uint8
+    {
+        Window,
+        Probation,
+        Protected,
+        Num
+    };
+
+    struct FEntry
+    {
+        FDUIDSIndex Key;
+        TOptional<FHexademicMemoryNode> Node;
+        FHexademic6CachedSlices Slices;
+        int64 Charge = 0;
+        int32 Prev = INDEX_NONE; // Towards the most recently used end
+        int32 Next = INDEX_NONE;
+        ESegment Segment = ESegment::Window;
+    };
+
+    struct FList
+    {
+        int32 Head = INDEX_NONE; // Most recently used
+        int32 Tail = INDEX_NONE; // Least recently used
+        int64 Bytes = 0;
+    };
+
+    int32 FindEntry(const FDUIDSIndex& Key);
+    int32 AddEntry(const FDUIDSIndex& Key);
+    void RecordFrequency(const FDUIDSIndex& Key);
+    void OnHit(int32 EntryIndex);
+    void Recharge(int32 EntryIndex, int64 Charge);
+
+    void Link(int32 EntryIndex, ESegment Segment);
+    void Unlink(int32 EntryIndex);
+    void Remove(int32 EntryIndex);
+    void Discard(int32 UnlinkedIndex);
+
+    // Moves window overflow into the main cache through the admission filter, then trims the
+    // protected segment, keeping every segment within its share of the budget.
+    void Rebalance();
+    void Admit(int32 CandidateIndex);
+
+    FList& GetList(ESegment Segment) { return Lists[(uint8)Segment]; }
+    int64 GetWindowBudget() const { return FMath::Max<int64>(BudgetBytes / 100, 1); }
+    int64 GetMainBudget() const { return FMath::Max<int64>(BudgetBytes - GetWindowBudget(), 0); }
+    int64 GetProtectedBudget() const { return GetMainBudget() * 4 / 5; }
+
+    int64 BudgetBytes;
+    TArray<FEntry> Entries;
+    TArray<int32> FreeEntries;
+    THexademic6FlatMap<int32> Lookup;
+    FList Lists[(uint8)ESegment::Num];
+
+    FHexademic6CountMinSketch Frequency;
+    int32 SampleCount = 0;
+    int32 SamplePeriod;
+
+    FHexademic6CacheStats Stats;
+};
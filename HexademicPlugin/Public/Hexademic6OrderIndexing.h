@@ -0,0 +1,197 @@
+// Hexademic6OrderIndexing.h
+// Compile-time specialized linear index conversion for every ECognitiveLatticeOrder.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h" // For TArrayView, TConstArrayView
+#include "HexademicSixLattice.h"  // For FHexademic6DCoordinate, ECognitiveLatticeOrder
+
+// =============================================================================
+// PER-ORDER TRAITS
+// =============================================================================
+
+// Constant geometry of a single lattice order. Every stride is a compile-time constant,
+// so the divisions in FromLinearIndex lower to multiply/shift sequences and no floating
+// point math is involved anywhere in the conversion.
+// Bounded orders have Extent = 6 * 2^Order (6, 12, 24, 48, 96, 192). A valid axis lies in
+// (-Extent, Extent), so the linear index stores each axis as its offset from -(Extent - 1),
+// in base AxisSpan = 2 * Extent - 1. Every valid coordinate round-trips; 383^6 < 2^64.
+template<ECognitiveLatticeOrder Order>
+struct THexademic6OrderTraits
+{
+    static constexpr int32 Extent = 6 << static_cast<uint8>(Order);
+    static constexpr bool bBounded = true;
+    static constexpr int32 AxisSpan = 2 * Extent - 1;
+
+    // Offset of a coordinate component within [0, AxisSpan). Valid components map one to one;
+    // out-of-range ones wrap around the valid range.
+    static FORCEINLINE uint64 Wrap(int32 Value)
+    {
+        const int64 Remainder = (static_cast<int64>(Value) + (Extent - 1)) % AxisSpan;
+        return static_cast<uint64>(Remainder < 0 ? Remainder + AxisSpan : Remainder);
+    }
+
+    static FORCEINLINE int32 Unwrap(uint64 Offset)
+    {
+        return static_cast<int32>(Offset) - (Extent - 1);
+    }
+
+    static FORCEINLINE bool IsValid(const FHexademic6DCoordinate& Coord)
+    {
+        return FMath::Abs(Coord.X) < Extent && FMath::Abs(Coord.Y) < Extent && FMath::Abs(Coord.Z) < Extent &&
+               FMath::Abs(Coord.W) < Extent && FMath::Abs(Coord.U) < Extent && FMath::Abs(Coord.V) < Extent;
+    }
+
+    static FORCEINLINE uint64 ToLinearIndex(const FHexademic6DCoordinate& Coord)
+    {
+        constexpr uint64 E = AxisSpan;
+        return Wrap(Coord.X) + E * (Wrap(Coord.Y) + E * (Wrap(Coord.Z) + E * (Wrap(Coord.W) + E * (Wrap(Coord.U) + E * Wrap(Coord.V)))));
+    }
+
+    static FORCEINLINE void FromLinearIndex(uint64 Index, FHexademic6DCoordinate& OutCoord)
+    {
+        constexpr uint64 E = AxisSpan;
+        uint64 Quotient = Index / E;
+        OutCoord.X = Unwrap(Index - Quotient * E);
+        Index = Quotient; Quotient = Index / E;
+        OutCoord.Y = Unwrap(Index - Quotient * E);
+        Index = Quotient; Quotient = Index / E;
+        OutCoord.Z = Unwrap(Index - Quotient * E);
+        Index = Quotient; Quotient = Index / E;
+        OutCoord.W = Unwrap(Index - Quotient * E);
+        Index = Quotient; Quotient = Index / E;
+        OutCoord.U = Unwrap(Index - Quotient * E);
+        OutCoord.V = Unwrap(Quotient);
+        OutCoord.LatticeOrder = Order;
+    }
+};
+
+// OrderInfinite is unbounded for validity checks, and its six wrapped axes do not fit a 64-bit
+// index. Every bit is used: the low 11 bits of X, Y, Z and W and the low 10 bits of U and V,
+// sign-extended on decode. Coordinates with X..W in [-1024, 1023] and U, V in [-512, 511]
+// round-trip exactly; beyond that, two coordinates share an index exactly when their axes agree
+// modulo 2048 (X..W) and 1024 (U, V). Callers that need distinct keys for arbitrary infinite
+// order coordinates use DUIDS keys instead (see FHexademic6OrderIndexing::ToLinearIndex).
+template<>
+struct THexademic6OrderTraits<ECognitiveLatticeOrder::OrderInfinite>
+{
+    static constexpr int32 Extent = 65536;
+    static constexpr bool bBounded = false;
+    static constexpr int32 SpatialAxisBits = 11; // X, Y, Z, W
+    static constexpr int32 OuterAxisBits = 10;   // U, V
+    static_assert(4 * SpatialAxisBits + 2 * OuterAxisBits == 64, "Every index bit is used.");
+
+    template<int32 Bits>
+    static FORCEINLINE uint64 Wrap(int32 Value)
+    {
+        return static_cast<uint64>(static_cast<uint32>(Value)) & ((1ull << Bits) - 1);
+    }
+
+    // Sign-extends the low Bits bits.
+    template<int32 Bits>
+    static FORCEINLINE int32 Unwrap(uint64 Value)
+    {
+        constexpr int32 SignBit = 1 << (Bits - 1);
+        return (static_cast<int32>(Value & ((1ull << Bits) - 1)) ^ SignBit) - SignBit;
+    }
+
+    static FORCEINLINE bool IsValid(const FHexademic6DCoordinate& Coord)
+    {
+        return true;
+    }
+
+    static FORCEINLINE uint64 ToLinearIndex(const FHexademic6DCoordinate& Coord)
+    {
+        constexpr int32 S = SpatialAxisBits;
+        return Wrap<S>(Coord.X) | (Wrap<S>(Coord.Y) << S) | (Wrap<S>(Coord.Z) << (2 * S)) | (Wrap<S>(Coord.W) << (3 * S)) |
+               (Wrap<OuterAxisBits>(Coord.U) << (4 * S)) | (Wrap<OuterAxisBits>(Coord.V) << (4 * S + OuterAxisBits));
+    }
+
+    static FORCEINLINE void FromLinearIndex(uint64 Index, FHexademic6DCoordinate& OutCoord)
+    {
+        constexpr int32 S = SpatialAxisBits;
+        OutCoord.X = Unwrap<S>(Index);
+        OutCoord.Y = Unwrap<S>(Index >> S);
+        OutCoord.Z = Unwrap<S>(Index >> (2 * S));
+        OutCoord.W = Unwrap<S>(Index >> (3 * S));
+        OutCoord.U = Unwrap<OuterAxisBits>(Index >> (4 * S));
+        OutCoord.V = Unwrap<OuterAxisBits>(Index >> (4 * S + OuterAxisBits));
+        OutCoord.LatticeOrder = ECognitiveLatticeOrder::OrderInfinite;
+    }
+};
+
+// =============================================================================
+// RUNTIME DISPATCH AND BATCH API
+// =============================================================================
+
+// Single entry point for order-dependent coordinate math. The runtime order is switched on
+// once per call (or once per batch), after which the specialized traits do the work.
+struct HEXADEMIC6LATTICE_API FHexademic6OrderIndexing
+{
+    // Number of lattice orders, including OrderInfinite.
+    static constexpr int32 NumOrders = static_cast<int32>(ECognitiveLatticeOrder::OrderInfinite) + 1;
+
+    // Axis extent used by validity checks, linear indexing and projection.
+    static constexpr int32 GetExtent(ECognitiveLatticeOrder Order)
+    {
+        return Order == ECognitiveLatticeOrder::OrderInfinite ? 65536 : (6 << static_cast<uint8>(Order));
+    }
+
+    // Neighboring orders in the canonical 6, 12, 24, 48, 96, 192, Infinite sequence, saturating
+    // at both ends. Promotion and decay move a node one step along it.
+    static constexpr ECognitiveLatticeOrder GetNextOrder(ECognitiveLatticeOrder Order)
+    {
+        return Order == ECognitiveLatticeOrder::OrderInfinite ? Order : static_cast<ECognitiveLatticeOrder>(static_cast<uint8>(Order) + 1);
+    }
+
+    static constexpr ECognitiveLatticeOrder GetPreviousOrder(ECognitiveLatticeOrder Order)
+    {
+        return Order == ECognitiveLatticeOrder::Order6 ? Order : static_cast<ECognitiveLatticeOrder>(static_cast<uint8>(Order) - 1);
+    }
+
+    // Invokes Func with a default-constructed THexademic6OrderTraits<Order> for the runtime order.
+    template<typename FuncType>
+    static FORCEINLINE decltype(auto) Dispatch(ECognitiveLatticeOrder Order, FuncType&& Func)
+    {
+        switch (Order)
+        {
+            case ECognitiveLatticeOrder::Order6:   return Func(THexademic6OrderTraits<ECognitiveLatticeOrder::Order6>());
+            case ECognitiveLatticeOrder::Order12:  return Func(THexademic6OrderTraits<ECognitiveLatticeOrder::Order12>());
+            case ECognitiveLatticeOrder::Order24:  return Func(THexademic6OrderTraits<ECognitiveLatticeOrder::Order24>());
+            case ECognitiveLatticeOrder::Order48:  return Func(THexademic6OrderTraits<ECognitiveLatticeOrder::Order48>());
+            case ECognitiveLatticeOrder::Order96:  return Func(THexademic6OrderTraits<ECognitiveLatticeOrder::Order96>());
+            case ECognitiveLatticeOrder::Order192: return Func(THexademic6OrderTraits<ECognitiveLatticeOrder::Order192>());
+            default:                               return Func(THexademic6OrderTraits<ECognitiveLatticeOrder::OrderInfinite>());
+        }
+    }
+
+    static FORCEINLINE bool IsValidForOrder(const FHexademic6DCoordinate& Coord, ECognitiveLatticeOrder Order)
+    {
+        return Dispatch(Order, [&Coord](auto Traits) { return decltype(Traits)::IsValid(Coord); });
+    }
+
+    // Bijective on the valid coordinates of every bounded order. OrderInfinite indices are lossy:
+    // they identify a coordinate only within a 2048^4 * 1024^2 window, and coordinates that agree
+    // on every axis modulo that window collide (see THexademic6OrderTraits<OrderInfinite>).
+    static FORCEINLINE uint64 ToLinearIndex(const FHexademic6DCoordinate& Coord, ECognitiveLatticeOrder Order)
+    {
+        return Dispatch(Order, [&Coord](auto Traits) { return decltype(Traits)::ToLinearIndex(Coord); });
+    }
+
+    static FORCEINLINE void FromLinearIndex(uint64 Index, ECognitiveLatticeOrder Order, FHexademic6DCoordinate& OutCoord)
+    {
+        Dispatch(Order, [Index, &OutCoord](auto Traits) { decltype(Traits)::FromLinearIndex(Index, OutCoord); });
+    }
+
+    // Rescales the axes of Coord from SourceOrder to TargetOrder with integer round-half-up,
+    // matching FMath::RoundToInt on the old float path for every in-range coordinate.
+    static void ProjectToOrder(const FHexademic6DCoordinate& Coord, ECognitiveLatticeOrder SourceOrder, ECognitiveLatticeOrder TargetOrder, FHexademic6DCoordinate& OutCoord);
+
+    // Batch variants. Output views must be at least as long as the input views.
+    // DUIDS locations of the produced coordinates are refreshed only when bUpdateDUIDS is set.
+    static void ToLinearIndices(TConstArrayView<FHexademic6DCoordinate> Coords, ECognitiveLatticeOrder Order, TArrayView<uint64> OutIndices);
+    static void FromLinearIndices(TConstArrayView<uint64> Indices, ECognitiveLatticeOrder Order, TArrayView<FHexademic6DCoordinate> OutCoords, bool bUpdateDUIDS = true);
+    static int32 ValidateForOrder(TConstArrayView<FHexademic6DCoordinate> Coords, ECognitiveLatticeOrder Order, TArrayView<bool> OutValid);
+    static void ProjectToOrder(TConstArrayView<FHexademic6DCoordinate> Coords, ECognitiveLatticeOrder SourceOrder, ECognitiveLatticeOrder TargetOrder, TArrayView<FHexademic6DCoordinate> OutCoords, bool bUpdateDUIDS = true);
+};
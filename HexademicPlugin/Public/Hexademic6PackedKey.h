@@ -0,0 +1,65 @@
+// Hexademic6PackedKey.h
+// Canonical 128-bit integer form of FDUIDSIndex.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HexademicSixLattice.h" // For FDUIDSIndex
+
+// =============================================================================
+// PACKED DUIDS KEY
+// =============================================================================
+
+// The six FDUIDSIndex fields packed MSB-first, in the order FDUIDSIndex compares them:
+//   Hi = MajorClass(8) | Division(8) | Section(16) | SubSection(32)
+//   Lo = Cutter(16) | Edition(8), in the low 24 bits; the rest is always zero
+// As the 128-bit integer Hi:Lo, packed keys compare exactly like the keys they pack, so
+// equality is two 64-bit compares and ordering at most two more, with no per-field work.
+struct FHexademic6PackedKey
+{
+    uint64 Hi = 0;
+    uint64 Lo = 0;
+
+    FHexademic6PackedKey() = default;
+    FHexademic6PackedKey(uint64 InHi, uint64 InLo) : Hi(InHi), Lo(InLo) {}
+
+    explicit FHexademic6PackedKey(const FDUIDSIndex& Key)
+        : Hi(((uint64)Key.MajorClass << 56) | ((uint64)Key.Division << 48) | ((uint64)Key.Section << 32) | (uint64)Key.SubSection)
+        , Lo(((uint64)Key.Cutter << 8) | (uint64)Key.Edition)
+    {
+    }
+
+    FDUIDSIndex Unpack() const
+    {
+        FDUIDSIndex Key;
+        Key.MajorClass = (uint8)(Hi >> 56);
+        Key.Division = (uint8)(Hi >> 48);
+        Key.Section = (uint16)(Hi >> 32);
+        Key.SubSection = (uint32)Hi;
+        Key.Cutter = (uint16)(Lo >> 8);
+        Key.Edition = (uint8)Lo;
+        return Key;
+    }
+
+    // 64-bit mix of both halves. The top bits are as well mixed as the bottom ones, which
+    // open-addressing tables rely on when they split the hash.
+    FORCEINLINE uint64 GetHash64() const
+    {
+        uint64 Hash = Hi ^ (Lo * 0x9e3779b97f4a7c15ull);
+        Hash ^= Hash >> 33;
+        Hash *= 0xff51afd7ed558ccdull;
+        Hash ^= Hash >> 33;
+        Hash *= 0xc4ceb9fe1a85ec53ull;
+        Hash ^= Hash >> 33;
+        return Hash;
+    }
+
+    FORCEINLINE bool operator==(const FHexademic6PackedKey& Other) const { return Hi == Other.Hi && Lo == Other.Lo; }
+    FORCEINLINE bool operator!=(const FHexademic6PackedKey& Other) const { return !(*this == Other); }
+    FORCEINLINE bool operator<(const FHexademic6PackedKey& Other) const { return Hi != Other.Hi ? Hi < Other.Hi : Lo < Other.Lo; }
+
+    // 22 hex digits, in key order; much cheaper to format than FDUIDSIndex::ToDecimalString.
+    FString ToHexString() const { return FString::Printf(TEXT("%016llx%06llx"), Hi, Lo); }
+
+    friend FORCEINLINE uint32 GetTypeHash(const FHexademic6PackedKey& Key) { return (uint32)Key.GetHash64(); }
+};
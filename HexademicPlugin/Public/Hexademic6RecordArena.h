@@ -0,0 +1,92 @@
+// Hexademic6RecordArena.h
+// Append-only slab storage for compressed memory records.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h" // For TUniquePtr
+#include "HexademicSixLattice.h"  // For ECognitiveLatticeOrder
+
+// =============================================================================
+// RECORD HANDLES
+// =============================================================================
+
+// Location of one record inside an FHexademic6RecordArena.
+struct FHexademicRecordHandle
+{
+    int32 Slab = INDEX_NONE;
+    uint32 Offset = 0;
+    uint32 Length = 0;
+
+    bool IsValid() const { return Slab != INDEX_NONE; }
+};
+
+// A record handle together with the lattice order whose arena holds it.
+struct FHexademicRecordLocation
+{
+    ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order6;
+    FHexademicRecordHandle Handle;
+};
+
+// =============================================================================
+// RECORD ARENA
+// =============================================================================
+
+// Records are written back to back into large slabs, so storing a record costs no allocator
+// call unless it opens a new slab. Writers reserve the worst-case size, write in place and then
+// commit the size they actually used; the unused tail of the reservation stays available.
+// Freeing only updates accounting; a slab whose records are all freed is recycled, and
+// Compact() repacks live records when the dead share grows.
+class HEXADEMIC6LATTICE_API FHexademic6RecordArena
+{
+public:
+    static constexpr int32 DefaultSlabSize = 1 << 20;
+
+    explicit FHexademic6RecordArena(int32 InSlabSize = DefaultSlabSize);
+
+    // Returns space for up to MaxSize bytes. Only one reservation may be outstanding; it ends
+    // with Commit or CancelReservation. Records larger than a slab get a dedicated slab.
+    uint8* Reserve(int32 MaxSize);
+    FHexademicRecordHandle Commit(int32 Length);
+    void CancelReservation();
+
+    TConstArrayView<uint8> Get(const FHexademicRecordHandle& Handle) const
+    {
+        const FSlab& Slab = Slabs[Handle.Slab];
+        check(Handle.Offset + Handle.Length <= (uint32)Slab.Used);
+        return TConstArrayView<uint8>(Slab.Data.Get() + Handle.Offset, Handle.Length);
+    }
+
+    void Free(const FHexademicRecordHandle& Handle);
+    void Empty();
+
+    // Copies every live record into fresh, densely filled slabs and rewrites the handles in
+    // place. LiveHandles must name every record that is still referenced.
+    void Compact(TArrayView<FHexademicRecordHandle*> LiveHandles);
+
+    int64 GetLiveBytes() const { return LiveBytes; }
+    int64 GetAllocatedBytes() const { return AllocatedBytes; }
+
+    // Share of slab bytes taken by freed records; the current slab's unused tail is not counted.
+    float GetDeadRatio() const;
+
+private:
+    struct FSlab
+    {
+        TUniquePtr<uint8[]> Data;
+        int32 Capacity = 0;
+        int32 Used = 0;
+        int32 LiveBytes = 0;
+    };
+
+    int32 AcquireSlab(int32 MinCapacity);
+
+    TArray<FSlab> Slabs;
+    TArray<int32> FreeSlabs;
+    int32 SlabSize;
+    int32 CurrentSlab = INDEX_NONE;
+    int32 PendingSlab = INDEX_NONE;
+    int32 PendingSize = 0;
+    int64 LiveBytes = 0;
+    int64 AllocatedBytes = 0;
+};
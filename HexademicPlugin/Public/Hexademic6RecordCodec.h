@@ -0,0 +1,145 @@
+// Hexademic6RecordCodec.h
+// Lossless, leveled record codec for compressed FHexademicMemoryNode storage.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"        // For TFuture
+#include "Templates/Function.h"  // For TFunctionRef
+#include "HexademicSixLattice.h" // For FHexademicMemoryNode, ECognitiveLatticeOrder
+
+// =============================================================================
+// RECORD FRAMING
+// =============================================================================
+
+// Payload codec actually used for a record. A level may fall back to Stored when its codec
+// does not shrink the payload.
+enum class EHexademic6RecordCodec : uint8
+{
+    Stored = 0,        // Raw serialized node
+    LZ = 1,            // In-house byte LZ, optionally primed with a per-EventType dictionary
+    OodleKraken = 2,   // Balanced LZ + entropy coding
+    OodleLeviathan = 3 // Strongest ratio, slowest encode
+};
+
+// Fixed little-endian prefix of every compressed record.
+//
+// Record layout (version 2):
+//   [frame header, 12 bytes][slice header, 32 bytes][cross references, 11 bytes each][body]
+// The frame and slice headers and the cross references are never compressed, so the sliced
+// accessors read them in place. The body holds the rest of the node and goes through the codec.
+struct FHexademic6RecordFrameHeader
+{
+    static constexpr uint8 CurrentVersion = 2;
+    static constexpr int32 SerializedSize = 12;
+
+    uint8 Version = CurrentVersion;
+    uint8 Level = 0;
+    EHexademic6RecordCodec Codec = EHexademic6RecordCodec::Stored;
+    ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order6;
+    uint32 DictionaryId = 0; // 0 when no dictionary was used
+    uint32 RawSize = 0;      // Size of the serialized body before compression
+};
+
+// Uncompressed hot fields of a record, stored right after the frame header.
+struct FHexademic6RecordSliceHeader
+{
+    static constexpr int32 SerializedSize = 32;
+    static constexpr int32 CrossReferenceSize = 11; // Packed FDUIDSIndex
+
+    float ResonanceStrength = 0.0f;
+    float EmotionalValence = 0.0f;
+    float EmotionalIntensity = 0.0f;
+    float MythicDepth = 0.0f;
+    int32 AccessCount = 0;
+    uint32 CrossReferenceOffset = 0; // From the start of the record
+    uint32 NumCrossReferences = 0;
+    uint32 BodyOffset = 0;           // From the start of the record
+
+    FVector GetEmotionalSignature() const { return FVector(EmotionalValence, EmotionalIntensity, MythicDepth); }
+};
+
+// =============================================================================
+// RECORD CODEC
+// =============================================================================
+
+// Compression levels:
+//   0    stored
+//   1    fast LZ, no dictionary (hot orders)
+//   2    fast LZ primed with the EventType dictionary when one is trained
+//   3    Oodle Kraken
+//   4+   Oodle Leviathan (deep orders)
+// Records are self-describing, so a reader does not need to know the level used to write them.
+// Dictionaries are referenced by id and must stay registered for as long as records use them.
+class HEXADEMIC6LATTICE_API FHexademic6RecordCodec
+{
+public:
+    // Level used by default for memories stored in Order.
+    static uint8 GetLevelForOrder(ECognitiveLatticeOrder Order);
+    static EHexademic6RecordCodec GetCodecForLevel(uint8 Level);
+
+    // Full node round trip. Compress also feeds the background dictionary trainer for the node's
+    // EventType, and picks up the dictionaries it has finished.
+    bool Compress(const FHexademicMemoryNode& Memory, uint8 Level, TArray<uint8>& OutRecord);
+
+    // Writes the record straight into caller memory: Allocate is called once with the worst-case
+    // record size and returns where to write (or null to abort). Returns the actual record size,
+    // or INDEX_NONE on failure. Reuses internal scratch buffers, so it is not reentrant.
+    int32 CompressTo(const FHexademicMemoryNode& Memory, uint8 Level, TFunctionRef<uint8*(int32 MaxRecordSize)> Allocate);
+    bool Decompress(TConstArrayView<uint8> Record, FHexademicMemoryNode& OutMemory) const;
+
+    static bool ReadFrameHeader(TConstArrayView<uint8> Record, FHexademic6RecordFrameHeader& OutHeader);
+    static void WriteFrameHeader(const FHexademic6RecordFrameHeader& Header, uint8* Out);
+
+    // Header-only reads: no allocation beyond the output and no decompression.
+    static bool ReadSliceHeader(TConstArrayView<uint8> Record, FHexademic6RecordSliceHeader& OutSlices);
+    static bool ReadCrossReferences(TConstArrayView<uint8> Record, TArray<FDUIDSIndex>& OutCrossReferences);
+
+    // Serialized node layout is the tagged-property-free binary form of the USTRUCT.
+    static void SerializeNode(const FHexademicMemoryNode& Memory, TArray<uint8>& OutBytes);
+    static bool DeserializeNode(TConstArrayView<uint8> Bytes, FHexademicMemoryNode& OutMemory);
+
+    // Byte-level payload codec. OutPayload must hold GetPayloadBound(Raw.Num()) bytes. Returns the
+    // payload size or INDEX_NONE; OutCodec reports what was actually written (Stored on fallback).
+    static int32 GetPayloadBound(int32 RawSize);
+    int32 CompressPayload(TConstArrayView<uint8> Raw, uint8 Level, uint32 DictionaryId, uint8* OutPayload, int32 Capacity, EHexademic6RecordCodec& OutCodec);
+    bool DecompressPayload(TConstArrayView<uint8> Payload, EHexademic6RecordCodec Codec, uint32 DictionaryId, int32 RawSize, TArray<uint8>& OutRaw) const;
+
+    static constexpr int32 DefaultMaxDictionarySize = 4096;
+
+    // Builds a dictionary from sample records of one EventType, registers it and makes it the
+    // EventType's current dictionary. Returns the dictionary id, or 0 if the samples share too
+    // little content to be worth it. Runs synchronously; the dictionaries Compress trains from
+    // its own samples are built on the thread pool instead.
+    uint32 TrainDictionary(const FString& EventType, TConstArrayView<TArray<uint8>> Samples, int32 MaxDictionarySize = DefaultMaxDictionarySize);
+
+    // The training itself: touches no codec state, so it may run on any thread. Returns false
+    // if the samples share too little content to be worth a dictionary.
+    static bool BuildDictionary(TConstArrayView<TArray<uint8>> Samples, int32 MaxDictionarySize, TArray<uint8>& OutDictionary);
+
+    // Registers a dictionary loaded from elsewhere (e.g. persisted alongside the records).
+    void AddDictionary(uint32 DictionaryId, TArray<uint8> Dictionary);
+    const TArray<uint8>* FindDictionary(uint32 DictionaryId) const { return Dictionaries.Find(DictionaryId); }
+    const TMap<uint32, TArray<uint8>>& GetDictionaries() const { return Dictionaries; }
+    uint32 GetDictionaryForEventType(const FString& EventType) const;
+
+private:
+    // Collects serialized nodes per EventType until enough exist to train a dictionary, then
+    // starts the training in the background.
+    void AddTrainingSample(const FString& EventType, TConstArrayView<uint8> Raw);
+
+    // Registers the dictionaries whose background training has finished.
+    void CollectTrainedDictionaries();
+    uint32 RegisterEventTypeDictionary(const FString& EventType, TArray<uint8> Dictionary);
+
+    TMap<uint32, TArray<uint8>> Dictionaries;
+    TMap<FString, uint32> DictionaryByEventType;
+    TMap<FString, TArray<TArray<uint8>>> PendingSamples;
+    TMap<FString, TFuture<TArray<uint8>>> PendingTraining; // Empty result: samples too dissimilar
+
+    // Compression scratch, kept across calls so steady-state compression does not allocate.
+    FHexademicMemoryNode ScratchBody;
+    TArray<uint8> ScratchRaw;
+    TArray<uint8> ScratchWindow;
+    TArray<int32> ScratchTable;
+};
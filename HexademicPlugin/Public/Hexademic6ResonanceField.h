@@ -0,0 +1,120 @@
+// Hexademic6ResonanceField.h
+// Sparse 6D resonance field: memory influence splatted into hashed per-order voxel grids.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"  // For TStaticArray
+#include "HexademicSixLattice.h"     // For FHexademic6DCoordinate, ECognitiveLatticeOrder
+#include "Hexademic6Types.h"         // For FVector6
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::NumOrders
+
+// =============================================================================
+// RESONANCE FIELD
+// =============================================================================
+
+// Each lattice order has its own field, stored as the values at the vertices of a uniform grid
+// of side VoxelSize. Only vertices that some memory touches are stored, in a hash keyed like the
+// spatial index's cells (10 bits per axis, so the field repeats every 1024 voxels).
+//
+// A memory adds its influence to the 2^6 vertices around its position, weighted multilinearly
+// (the transpose of the sampling weights). Sampling interpolates the same 2^6 vertices, so the
+// field is continuous. At a memory's exact position, with no other memory nearby, it returns
+// that memory's influence. Overlapping influences add up.
+//
+// Contributions are remembered per memory id. An update only re-splats memories whose
+// position or influence changed, and it removes the ones the update no longer mentions.
+//
+// Every voxel a write touches is recorded per order until TakeChangedVoxels, so consumers such
+// as the hotspot detector can revisit only what changed.
+//
+// Not thread-safe for writes. Any number of samples may run together.
+class HEXADEMIC6LATTICE_API FHexademic6ResonanceField
+{
+public:
+    struct FVoxel
+    {
+        float Value = 0.0f;
+        int32 NumSplats = 0;  // Removed at zero, so values cannot linger as rounding residue
+        int32 NumMembers = 0; // Contributions for which this is the nearest vertex
+    };
+
+    FHexademic6ResonanceField();
+
+    static uint64 PackVoxelKey(const int32 (&Cell)[6]);
+    // Inverse of PackVoxelKey, with each axis in [-512, 511].
+    static void UnpackVoxelKey(uint64 Key, int32 (&OutCell)[6]);
+
+    // One voxel per 2^Order lattice units, so a bounded order's range spans 12 voxels per axis.
+    // OrderInfinite uses 64, so 1024 voxels cover its 16-bit wrapped axes exactly.
+    static int32 GetDefaultVoxelSize(ECognitiveLatticeOrder Order);
+
+    // Changes an order's resolution and re-splats its contributions. Powers of two keep integer
+    // positions on exact grid fractions.
+    void SetVoxelSize(ECognitiveLatticeOrder Order, int32 VoxelSize);
+    int32 GetVoxelSize(ECognitiveLatticeOrder Order) const { return Grids[(uint8)Order].VoxelSize; }
+
+    // Incremental update: call Contribute for every memory that should be in the field, between
+    // BeginUpdate and EndUpdate. EndUpdate drops the memories that were not contributed.
+    void BeginUpdate();
+    void Contribute(const FGuid& MemoryID, const FHexademic6DCoordinate& Position, float Influence);
+    void EndUpdate();
+
+    void Remove(const FGuid& MemoryID);
+    void Empty();
+
+    // Re-splats every contribution from scratch, discarding float drift from incremental updates.
+    void Rebuild();
+
+    // Interpolated field value. The float overload takes a continuous position in Order's
+    // lattice units.
+    float Sample(const FHexademic6DCoordinate& Position) const;
+    float Sample(ECognitiveLatticeOrder Order, const FVector6& Position) const;
+
+    // OutValues must hold at least Positions.Num() values. Large batches run in parallel.
+    void Sample(TConstArrayView<FHexademic6DCoordinate> Positions, TArrayView<float> OutValues) const;
+
+    // Interpolated value, with its gradient per lattice unit in OutGradient. Inside a voxel the
+    // gradient is the exact derivative of the interpolant. Where a position lies on a grid
+    // plane the interpolant has a kink, and that component is the central difference across it.
+    float SampleGradient(const FHexademic6DCoordinate& Position, FVector6& OutGradient) const;
+    float SampleGradient(ECognitiveLatticeOrder Order, const FVector6& Position, FVector6& OutGradient) const;
+
+    // OutGradients must hold at least Positions.Num() gradients; OutValues, if not empty, as many
+    // values. Each position reads every voxel it needs once. Large batches run in parallel.
+    void SampleGradients(TConstArrayView<FHexademic6DCoordinate> Positions, TArrayView<FVector6> OutGradients, TArrayView<float> OutValues = TArrayView<float>()) const;
+
+    int32 NumContributions() const { return Contributions.Num(); }
+    int32 NumVoxels(ECognitiveLatticeOrder Order) const { return Grids[(uint8)Order].Voxels.Num(); }
+    const TMap<uint64, FVoxel>& GetVoxels(ECognitiveLatticeOrder Order) const { return Grids[(uint8)Order].Voxels; }
+
+    // Moves the keys of the order's voxels written since the last call into OutChanged. Returns
+    // true instead when the whole order should be treated as changed: after SetVoxelSize, Rebuild
+    // or Empty, or once more voxels changed than the order holds.
+    bool TakeChangedVoxels(ECognitiveLatticeOrder Order, TSet<uint64>& OutChanged);
+
+private:
+    struct FContribution
+    {
+        FHexademic6DCoordinate Position;
+        float Influence = 0.0f;
+        uint32 Generation = 0;
+    };
+
+    struct FGrid
+    {
+        TMap<uint64, FVoxel> Voxels;
+        int32 VoxelSize = 1;
+        TSet<uint64> ChangedVoxels;
+        bool bAllChanged = false;
+    };
+
+    static void MarkAllChanged(FGrid& Grid);
+
+    // Adds (Sign 1) or subtracts (Sign -1) a contribution's splat.
+    void Splat(const FContribution& Contribution, int32 Sign);
+
+    TStaticArray<FGrid, FHexademic6OrderIndexing::NumOrders> Grids;
+    TMap<FGuid, FContribution> Contributions;
+    uint32 Generation = 0;
+};
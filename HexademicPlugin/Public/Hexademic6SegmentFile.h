@@ -0,0 +1,162 @@
+// Hexademic6SegmentFile.h
+// Immutable, page-aligned segment files of compressed records, served from a read-only mapping.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"  // For TFunctionRef
+#include "Templates/UniquePtr.h" // For TUniquePtr
+#include "HexademicSixLattice.h" // For FDUIDSIndex, ECognitiveLatticeOrder
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// =============================================================================
+// ON-DISK LAYOUT
+// =============================================================================
+
+// File layout, every section starting on a PageSize boundary:
+//   [header page][index: NumEntries x FHexademic6SegmentEntry][dictionaries][record data]
+// The index is sorted by DUIDS key and is binary-searched in place. Records are the codec's
+// self-describing byte records, unchanged. All integers are little-endian.
+
+struct FHexademic6SegmentHeader
+{
+    static constexpr uint32 ExpectedMagic = 0x53365848; // "HX6S"
+    static constexpr uint32 CurrentVersion = 1;
+    static constexpr uint32 DefaultPageSize = 4096;
+
+    uint32 Magic = ExpectedMagic;
+    uint32 Version = CurrentVersion;
+    uint32 PageSize = DefaultPageSize;
+    uint32 RecordVersion = 0;     // FHexademic6RecordFrameHeader::CurrentVersion at write time
+    uint64 NumEntries = 0;
+    uint64 IndexOffset = 0;
+    uint64 DictionaryOffset = 0;  // Sequence of { uint32 Id, uint32 Size, Size bytes }
+    uint64 DictionarySize = 0;
+    uint64 DataOffset = 0;
+    uint64 DataSize = 0;
+    uint32 IndexCrc = 0;
+    uint32 HeaderCrc = 0;         // Over every preceding field
+};
+
+// One index entry. Field order keeps every member naturally aligned with no padding.
+struct FHexademic6SegmentEntry
+{
+    uint8 MajorClass = 0;
+    uint8 Division = 0;
+    uint16 Section = 0;
+    uint32 SubSection = 0;
+    uint16 Cutter = 0;
+    uint8 Edition = 0;
+    uint8 Order = 0;
+    uint32 Length = 0;
+    uint64 Offset = 0; // From DataOffset
+    FGuid MemoryID;
+
+    FDUIDSIndex GetKey() const
+    {
+        FDUIDSIndex Key;
+        Key.MajorClass = MajorClass;
+        Key.Division = Division;
+        Key.Section = Section;
+        Key.SubSection = SubSection;
+        Key.Cutter = Cutter;
+        Key.Edition = Edition;
+        return Key;
+    }
+
+    void SetKey(const FDUIDSIndex& Key)
+    {
+        MajorClass = Key.MajorClass;
+        Division = Key.Division;
+        Section = Key.Section;
+        SubSection = Key.SubSection;
+        Cutter = Key.Cutter;
+        Edition = Key.Edition;
+    }
+};
+static_assert(sizeof(FHexademic6SegmentEntry) == 40, "Segment entries are part of the file format.");
+
+// One record handed to FHexademic6Segment::Write.
+struct FHexademic6SegmentRecordSource
+{
+    FDUIDSIndex Key;
+    FGuid MemoryID;
+    ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order6;
+    TConstArrayView<uint8> Record;
+};
+
+// =============================================================================
+// MAPPED SEGMENT
+// =============================================================================
+
+// A mounted segment. Opening validates the header and maps the whole file read-only; nothing is
+// deserialized, so mount time does not depend on the number of records, and processes mapping
+// the same file share its pages through the OS page cache.
+class HEXADEMIC6LATTICE_API FHexademic6Segment
+{
+public:
+    ~FHexademic6Segment();
+
+    // Writes Records (sorted here by key; keys must be unique) plus the codec dictionaries they
+    // reference. The file is written under a temporary name and renamed into place.
+    static bool Write(const FString& Path, TArrayView<FHexademic6SegmentRecordSource> Records, const TMap<uint32, TArray<uint8>>& Dictionaries);
+
+    // Renames the finished TempPath over Path without a window in which neither exists. Where
+    // rename will not replace (Windows), the original is moved to Path + BackupSuffix and deleted
+    // once the new file is in place; a crash in between leaves it there for the caller's recovery
+    // scan. On failure Path is untouched and TempPath is deleted.
+    static constexpr const TCHAR* BackupSuffix = TEXT(".bak");
+    static bool ReplaceFile(const FString& Path, const FString& TempPath);
+
+    // Maps Path. bVerifyIndex additionally checks the index CRC, which touches every index page.
+    static TUniquePtr<FHexademic6Segment> Open(const FString& Path, bool bVerifyIndex = false);
+
+    const FString& GetPath() const { return Path; }
+    int32 Num() const { return Entries.Num(); }
+    TConstArrayView<FHexademic6SegmentEntry> GetEntries() const { return Entries; }
+
+    const FHexademic6SegmentEntry* FindEntry(const FDUIDSIndex& Key) const;
+    // Empty for entries whose range falls outside the data section; the index CRC is only
+    // checked on request, so a damaged entry must not be able to address past the mapping.
+    TConstArrayView<uint8> GetRecord(const FHexademic6SegmentEntry& Entry) const
+    {
+        if (Entry.Offset > DataSize || Entry.Length > DataSize - Entry.Offset)
+        {
+            return TConstArrayView<uint8>();
+        }
+        return TConstArrayView<uint8>(Data + Entry.Offset, (int32)Entry.Length);
+    }
+
+    // Index of the first entry whose key is not less than Key.
+    int32 LowerBound(const FDUIDSIndex& Key) const;
+
+    // Visits the entries with keys in [Start, End] in ascending order until Visitor returns false.
+    template<typename VisitorType>
+    void ForEachInRange(const FDUIDSIndex& Start, const FDUIDSIndex& End, VisitorType&& Visitor) const
+    {
+        for (int32 EntryIndex = LowerBound(Start); EntryIndex < Entries.Num(); ++EntryIndex)
+        {
+            const FHexademic6SegmentEntry& Entry = Entries[EntryIndex];
+            if (End < Entry.GetKey() || !Visitor(Entry))
+            {
+                return;
+            }
+        }
+    }
+
+    // Reads the dictionary section; called once at mount to register them with the codec.
+    void ForEachDictionary(TFunctionRef<void(uint32 DictionaryId, TConstArrayView<uint8> Dictionary)> Visitor) const;
+
+private:
+    FHexademic6Segment() = default;
+
+    FString Path;
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    TConstArrayView<FHexademic6SegmentEntry> Entries;
+    TConstArrayView<uint8> Dictionaries;
+    const uint8* Data = nullptr;
+    uint64 DataSize = 0;
+};
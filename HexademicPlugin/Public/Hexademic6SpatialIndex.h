@@ -0,0 +1,93 @@
+// Hexademic6SpatialIndex.h
+// Hashed 6D grid over FHexademic6DCoordinate for radius and k-nearest neighbor queries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HexademicSixLattice.h"     // For FHexademic6DCoordinate, ECognitiveLatticeOrder
+
+// =============================================================================
+// NODE HANDLES
+// =============================================================================
+
+// Lightweight reference to a memory node stored in a per-order lattice structure.
+// Slot is stable for the lifetime of the node in that order.
+struct FHexademicNodeHandle
+{
+    ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order6;
+    int32 Slot = INDEX_NONE;
+
+    FHexademicNodeHandle() = default;
+    FHexademicNodeHandle(ECognitiveLatticeOrder InOrder, int32 InSlot) : Order(InOrder), Slot(InSlot) {}
+
+    bool IsValid() const { return Slot != INDEX_NONE; }
+    bool operator==(const FHexademicNodeHandle& Other) const { return Order == Other.Order && Slot == Other.Slot; }
+};
+
+// =============================================================================
+// SINGLE-ORDER GRID
+// =============================================================================
+
+// Uniform grid hash over one lattice order. Every entry lives in exactly one cell of side
+// CellSize; queries only visit the cells overlapping the query region. When a query would
+// visit more cells than there are entries, it falls back to a scan of the dense entry array.
+class HEXADEMIC6LATTICE_API FHexademic6SpatialIndex
+{
+public:
+    explicit FHexademic6SpatialIndex(int32 InCellSize = 1);
+
+    // Cell size that spreads ExpectedMemories evenly over Order's lattice at about one per cell,
+    // so a small-radius query visits a handful of memories rather than a sizeable part of the
+    // order. The one-argument form uses Hexademic.Spatial.ExpectedMemoriesPerOrder.
+    static int32 GetDefaultCellSize(ECognitiveLatticeOrder Order);
+    static int32 GetDefaultCellSize(ECognitiveLatticeOrder Order, int32 ExpectedMemories);
+
+    // Inserts a node and returns its slot.
+    int32 Add(const FHexademic6DCoordinate& Position, const FGuid& MemoryID);
+
+    // Moves a node; only touches the grid when the node changes cell.
+    void Update(int32 Slot, const FHexademic6DCoordinate& NewPosition);
+
+    void Remove(int32 Slot);
+    void Empty();
+
+    int32 Num() const { return NumAlive; }
+    int32 GetCellSize() const { return CellSize; }
+    bool IsValidSlot(int32 Slot) const { return Entries.IsValidIndex(Slot) && Entries[Slot].bAlive; }
+    const FHexademic6DCoordinate& GetPosition(int32 Slot) const { return Entries[Slot].Position; }
+    const FGuid& GetMemoryID(int32 Slot) const { return Entries[Slot].MemoryID; }
+
+    // Appends every slot within Euclidean distance Radius of Center.
+    void QueryRadius(const FHexademic6DCoordinate& Center, float Radius, TArray<int32>& OutSlots) const;
+
+    // Writes the K nearest slots to OutSlots, closest first. ExcludeID (if valid) is skipped,
+    // which lets a node query its own neighborhood.
+    void QueryKNearest(const FHexademic6DCoordinate& Center, int32 K, TArray<int32>& OutSlots, const FGuid& ExcludeID = FGuid()) const;
+
+private:
+    struct FEntry
+    {
+        FHexademic6DCoordinate Position;
+        FGuid MemoryID;
+        uint64 CellKey = 0;
+        int32 SlotInCell = INDEX_NONE;
+        bool bAlive = false;
+    };
+
+    static int64 DistanceSquared(const FHexademic6DCoordinate& A, const FHexademic6DCoordinate& B);
+    void ComputeCell(const FHexademic6DCoordinate& Position, int32 (&OutCell)[6]) const;
+    static uint64 PackCellKey(const int32 (&Cell)[6]);
+    void LinkToCell(int32 Slot);
+    void UnlinkFromCell(int32 Slot);
+
+    // Visits every cell in [MinCell, MaxCell]; when ShellRadius >= 0, only cells at exactly that
+    // Chebyshev distance from Center are visited.
+    template<typename VisitorType>
+    void ForEachCell(const int32 (&MinCell)[6], const int32 (&MaxCell)[6], const int32 (&CenterCell)[6], int32 ShellRadius, VisitorType&& Visitor) const;
+
+    TArray<FEntry> Entries;
+    TArray<int32> FreeSlots;
+    TMap<uint64, TArray<int32>> Cells;
+    int32 CellSize;
+    int32 NumAlive = 0;
+};
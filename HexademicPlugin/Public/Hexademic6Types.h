@@ -58,9 +58,54 @@ struct HEXADEMIC6LATTICE_API FVector6
         return FVector6(X * Scalar, Y * Scalar, Z * Scalar, W * Scalar, U * Scalar, V * Scalar);
     }
 
+    FVector6 operator/(float Scalar) const
+    {
+        return *this * (1.0f / Scalar);
+    }
+
+    FVector6& operator+=(const FVector6& Other)
+    {
+        X += Other.X; Y += Other.Y; Z += Other.Z; W += Other.W; U += Other.U; V += Other.V;
+        return *this;
+    }
+
+    FVector6& operator*=(float Scalar)
+    {
+        X *= Scalar; Y *= Scalar; Z *= Scalar; W *= Scalar; U *= Scalar; V *= Scalar;
+        return *this;
+    }
+
+    // Component access in X, Y, Z, W, U, V order; the six floats are contiguous.
+    float operator[](int32 Axis) const
+    {
+        check(Axis >= 0 && Axis < 6);
+        return (&X)[Axis];
+    }
+
+    float& operator[](int32 Axis)
+    {
+        check(Axis >= 0 && Axis < 6);
+        return (&X)[Axis];
+    }
+
+    static float Dot(const FVector6& A, const FVector6& B)
+    {
+        return A.X*B.X + A.Y*B.Y + A.Z*B.Z + A.W*B.W + A.U*B.U + A.V*B.V;
+    }
+
+    static float DistSquared(const FVector6& A, const FVector6& B)
+    {
+        return (A - B).SizeSquared();
+    }
+
+    static float Dist(const FVector6& A, const FVector6& B)
+    {
+        return FMath::Sqrt(DistSquared(A, B));
+    }
+
     float SizeSquared() const
     {
-        return X*X + Y*Y + Z*Z + W*W + U*U + V*V;
+        return Dot(*this, *this);
     }
 
     float Size() const
@@ -70,7 +115,7 @@ struct HEXADEMIC6LATTICE_API FVector6
 
     FVector6 GetSafeNormal(float Tolerance = KINDA_SMALL_NUMBER) const
     {
-        float S = Size();
+        const float S = Size();
         if (S > Tolerance)
         {
             return *this / S;
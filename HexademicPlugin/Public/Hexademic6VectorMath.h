@@ -0,0 +1,95 @@
+// Hexademic6VectorMath.h
+// Structure-of-arrays FVector6 batches and vectorized span kernels over them.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hexademic6Types.h"     // For FVector6
+#include "HexademicSixLattice.h" // For FHexademic6DCoordinate
+
+// Kernels process four lanes per iteration through the engine's VectorRegister4Float
+// (SSE on x64, NEON on ARM) and finish the remainder with scalar code. Set to 0 to force the
+// scalar path everywhere, e.g. when comparing results across platforms.
+#ifndef HEXADEMIC6_VECTOR_KERNELS
+#define HEXADEMIC6_VECTOR_KERNELS PLATFORM_ENABLE_VECTORINTRINSICS
+#endif
+
+// =============================================================================
+// FVector6 BATCH
+// =============================================================================
+
+// N six-dimensional vectors stored axis by axis: all X values, then all Y values, and so on.
+// Each axis is contiguous, so a kernel loads four vectors' worth of one axis per register.
+struct HEXADEMIC6LATTICE_API FVector6Batch
+{
+    TArray<float> Axes[6];
+
+    int32 Num() const { return Axes[0].Num(); }
+
+    void Reset(int32 NewCapacity = 0)
+    {
+        for (TArray<float>& Axis : Axes)
+        {
+            Axis.Reset(NewCapacity);
+        }
+    }
+
+    void SetNumUninitialized(int32 NewNum)
+    {
+        for (TArray<float>& Axis : Axes)
+        {
+            Axis.SetNumUninitialized(NewNum);
+        }
+    }
+
+    int32 Add(const FVector6& Vector)
+    {
+        for (int32 AxisIndex = 0; AxisIndex < 6; ++AxisIndex)
+        {
+            Axes[AxisIndex].Add(Vector[AxisIndex]);
+        }
+        return Num() - 1;
+    }
+
+    int32 Add(const FHexademic6DCoordinate& Coord)
+    {
+        return Add(FVector6((float)Coord.X, (float)Coord.Y, (float)Coord.Z, (float)Coord.W, (float)Coord.U, (float)Coord.V));
+    }
+
+    FVector6 Get(int32 Index) const
+    {
+        return FVector6(Axes[0][Index], Axes[1][Index], Axes[2][Index], Axes[3][Index], Axes[4][Index], Axes[5][Index]);
+    }
+
+    void Set(int32 Index, const FVector6& Vector)
+    {
+        for (int32 AxisIndex = 0; AxisIndex < 6; ++AxisIndex)
+        {
+            Axes[AxisIndex][Index] = Vector[AxisIndex];
+        }
+    }
+};
+
+// =============================================================================
+// SPAN KERNELS
+// =============================================================================
+
+// Element-wise kernels over batches. Vector outputs must already hold A.Num() entries and may
+// alias an input; scalar outputs must hold at least A.Num() floats.
+struct HEXADEMIC6LATTICE_API FHexademic6VectorMath
+{
+    static void Add(const FVector6Batch& A, const FVector6Batch& B, FVector6Batch& Out);
+    static void Subtract(const FVector6Batch& A, const FVector6Batch& B, FVector6Batch& Out);
+    static void Scale(const FVector6Batch& A, float Scalar, FVector6Batch& Out);
+
+    static void Dot(const FVector6Batch& A, const FVector6Batch& B, TArrayView<float> OutDots);
+    static void SizeSquared(const FVector6Batch& A, TArrayView<float> OutSizes);
+    static void Size(const FVector6Batch& A, TArrayView<float> OutSizes);
+
+    // Vectors not longer than Tolerance normalize to zero, matching FVector6::GetSafeNormal.
+    static void Normalize(const FVector6Batch& A, FVector6Batch& Out, float Tolerance = KINDA_SMALL_NUMBER);
+
+    // Distance from every vector of A to a single Point.
+    static void DistanceSquared(const FVector6Batch& A, const FVector6& Point, TArrayView<float> OutDistances);
+    static void Distance(const FVector6Batch& A, const FVector6& Point, TArrayView<float> OutDistances);
+};
@@ -0,0 +1,106 @@
+// Hexademic6WaveEngine.h
+// Resonance waves spreading through lattice neighbors, advanced in time-budgeted parallel steps.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HexademicSixLattice.h"     // For FHexademic6DCoordinate
+#include "Hexademic6SpatialIndex.h"  // For FHexademicNodeHandle
+#include "Hexademic6FrameBudget.h"   // For FHexademic6CostEstimate
+
+class FHexademic6LatticeStore;
+
+struct FHexademic6WaveStats
+{
+    int64 Waves = 0;        // Waves enqueued
+    int64 Passes = 0;       // Propagation passes started; each carries one or more waves
+    int64 NodesReached = 0; // Resonance updates applied
+    int32 ActivePasses = 0;
+    int32 FrontierNodes = 0; // Nodes waiting to be expanded across every active pass
+};
+
+// =============================================================================
+// WAVE ENGINE
+// =============================================================================
+
+// A wave starts at the memories nearest its origin and spreads hop by hop to each reached node's
+// nearest lattice neighbors. Every node it reaches has its ResonanceStrength raised (or, for a
+// negative amplitude, lowered) by the wave's energy there, clamped to [0, 1]. Energy falls by
+// Hexademic.Waves.HopDecay per hop and with the length of each hop relative to the order's
+// extent; fronts below Hexademic.Waves.MinEnergy stop.
+//
+// Waves enqueued between two ticks are coalesced into one pass: a single frontier seeded from
+// every origin. A node reached by several fronts in the same hop receives their summed energy
+// once, and is expanded once; within a pass each node is reached at most once.
+//
+// Tick expands frontier chunks in parallel (neighbor queries only read the store), then applies
+// the updates on the calling thread. As in FHexademic6MigrationEngine, the budget is a hard cap:
+// a chunk only starts if its running average cost fits in what is left of it, so large waves
+// spread over as many frames as they need, and a tick overruns by at most one chunk's deviation
+// from that average; chunks that cost more than the whole budget run every few ticks rather than
+// never. Fronts carry their memory's id, since node handles do not survive the
+// node's removal and are reused; a front whose slot now holds another memory is dropped.
+// Enqueue may be called from any thread. Tick must run on the thread that mutates the store.
+class HEXADEMIC6LATTICE_API FHexademic6WaveEngine
+{
+public:
+    FHexademic6WaveEngine();
+
+    void Enqueue(const FHexademic6DCoordinate& Origin, float Amplitude);
+
+    // Runs for at most BudgetMicroseconds, or Hexademic.Waves.FrameBudgetMicroseconds if negative.
+    void Tick(FHexademic6LatticeStore& Store, double BudgetMicroseconds = -1.0);
+
+    // Drops every queued wave and active pass.
+    void Reset();
+
+    FHexademic6WaveStats GetStats() const;
+
+private:
+    struct FFront
+    {
+        FHexademicNodeHandle Handle;
+        FGuid MemoryID;
+        float Energy;
+    };
+
+    struct FPass
+    {
+        TArray<FFront> Frontier;
+        int32 Cursor = 0;            // Next frontier entry to expand
+        TArray<FFront> Next;         // Frontier of the following hop, being built
+        TMap<uint64, int32> NextIndex; // Node -> its entry in Next, to sum fronts that meet
+        TSet<uint64> Reached;
+    };
+
+    struct FWave
+    {
+        FHexademic6DCoordinate Origin;
+        float Amplitude;
+    };
+
+    // Starts one pass for every wave enqueued since the last tick.
+    void StartPass(FHexademic6LatticeStore& Store);
+
+    // Expands up to MaxNodes frontier entries of Pass and applies their updates. False once the
+    // pass has run out of frontier.
+    bool ExpandChunk(FHexademic6LatticeStore& Store, FPass& Pass, int32 MaxNodes);
+
+    // Adds Energy to Handle's entry in the pass' next frontier, unless the node was reached in an
+    // earlier hop.
+    static void AddFront(FPass& Pass, const FHexademicNodeHandle& Handle, const FGuid& MemoryID, float Energy);
+
+    mutable FCriticalSection PendingLock;
+    TArray<FWave> PendingWaves;
+
+    TArray<TUniquePtr<FPass>> Passes;
+    int32 NextPass = 0; // Round-robin cursor over Passes
+
+    FHexademic6CostEstimate ChunkCost;
+    bool bWarnedChunkBudget = false;
+
+    // Per-entry neighbor scratch, reused across chunks.
+    TArray<TArray<FFront>> ChunkNeighbors;
+
+    FHexademic6WaveStats Stats;
+};
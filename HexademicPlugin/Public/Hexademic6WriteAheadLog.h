@@ -0,0 +1,169 @@
+// Hexademic6WriteAheadLog.h
+// Group-committed write-ahead log and snapshots for crash recovery of FDUIDSOrchestrator state.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h" // For FCriticalSection
+#include "HAL/Runnable.h"        // For FRunnable
+#include "Templates/Function.h"  // For TFunctionRef
+#include "Templates/UniquePtr.h" // For TUniquePtr
+#include "HexademicSixLattice.h" // For FDUIDSIndex
+#include "Hexademic6SegmentFile.h" // For FHexademic6SegmentRecordSource
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+class IFileHandle;
+
+// =============================================================================
+// LOG RECORDS
+// =============================================================================
+
+// Mutation kinds. Payloads are little-endian and start with the packed 11-byte DUIDS key,
+// except DictionaryPut which starts with the dictionary id.
+enum class EHexademic6WalRecordType : uint8
+{
+    IndexPut = 1,      // Key, MemoryID
+    RecordPut = 2,     // Key, Order, compressed record
+    Access = 3,        // Key, wall-clock access time in seconds. Replayed, no longer written
+    DictionaryPut = 4, // Dictionary id, dictionary bytes
+    RecordRemove = 5   // Key
+};
+
+// When committed groups reach stable storage. Writers never wait for any of these.
+enum class EHexademic6WalSyncPolicy : uint8
+{
+    None = 0,        // Handed to the OS at each group commit; survives process crashes, not power loss
+    Interval = 1,    // fsync at most once per Hexademic.WAL.SyncIntervalMs
+    EveryCommit = 2  // fsync every group commit
+};
+
+// =============================================================================
+// WRITE-AHEAD LOG
+// =============================================================================
+
+// The log is a series of generation files, wal-<generation>.log, each a 16-byte file header
+// followed by records:
+//   [uint32 PayloadSize][uint32 Crc][uint64 Sequence][uint8 Type][payload]
+// The CRC covers the payload, then Sequence and Type. Append only copies into a pending buffer; a
+// background thread writes the buffer out every Hexademic.WAL.GroupCommitMs (or sooner once it
+// grows large) and syncs according to the sync policy, so many mutations share one write and
+// one fsync. Rotate starts a new generation, which is what lets snapshots retire old files.
+class HEXADEMIC6LATTICE_API FHexademic6WriteAheadLog : public FRunnable
+{
+public:
+    static constexpr uint32 ExpectedMagic = 0x57365848; // "HX6W"
+    static constexpr uint32 CurrentVersion = 1;
+    static constexpr int32 FileHeaderSize = 16;
+    static constexpr int32 RecordHeaderSize = 17;
+
+    // Creates generation Generation in Directory and starts the commit thread. Sequences of new
+    // records start at NextSequence.
+    static TUniquePtr<FHexademic6WriteAheadLog> Open(const FString& Directory, uint64 Generation, uint64 NextSequence);
+
+    // Replays every record with a sequence above AfterSequence from generations >= FirstGeneration,
+    // in order. A torn or corrupt record ends the replay: its file is cut back to the last valid
+    // record and later generations are discarded, since they would follow a gap. Returns the last
+    // replayed sequence (AfterSequence if none); OutLastGeneration is the newest generation kept.
+    static uint64 Replay(const FString& Directory, uint64 FirstGeneration, uint64 AfterSequence,
+        TFunctionRef<void(EHexademic6WalRecordType Type, TConstArrayView<uint8> Payload)> Apply, uint64& OutLastGeneration);
+
+    static EHexademic6WalSyncPolicy GetSyncPolicy();
+
+    // Packed DUIDS key used at the start of record payloads.
+    static constexpr int32 KeySize = 11;
+    static void WriteKey(uint8* Out, const FDUIDSIndex& Key);
+    static FDUIDSIndex ReadKey(const uint8* In);
+
+    virtual ~FHexademic6WriteAheadLog();
+
+    // Queues one record whose payload is Prefix followed by Body and returns its sequence.
+    // Never blocks on I/O. Thread-safe.
+    uint64 Append(EHexademic6WalRecordType Type, TConstArrayView<uint8> Prefix, TConstArrayView<uint8> Body = TConstArrayView<uint8>());
+
+    // Writes everything appended so far on the calling thread; bSync forces an fsync regardless
+    // of the policy.
+    void Flush(bool bSync);
+
+    // Commits and closes the current generation and opens the next one. Records up to
+    // OutLastSequence live in older generations. Returns the new generation.
+    uint64 Rotate(uint64& OutLastSequence);
+
+    // Deletes generation files older than FirstKeptGeneration. Thread-safe.
+    void DeleteGenerationsBefore(uint64 FirstKeptGeneration) const;
+
+    uint64 GetLastSequence() const;
+    uint64 GetDurableSequence() const { return DurableSequence.load(std::memory_order_acquire); }
+    int64 GetBytesSinceRotation() const { return BytesSinceRotation.load(std::memory_order_relaxed); }
+    bool IsHealthy() const { return bHealthy.load(std::memory_order_relaxed); }
+
+    static FString GetGenerationPath(const FString& Directory, uint64 Generation);
+
+    // FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    FHexademic6WriteAheadLog(const FString& InDirectory, uint64 InGeneration, uint64 NextSequence);
+
+    bool OpenGeneration();
+
+    // Writes the pending buffer and syncs per policy. Returns the last sequence it covered.
+    uint64 CommitLocked(bool bForceSync);
+
+    FString Directory;
+    uint64 Generation;
+
+    // BufferLock guards the pending buffer and sequence; FileLock serializes everything that
+    // touches the file. FileLock is always taken first.
+    mutable FCriticalSection BufferLock;
+    FCriticalSection FileLock;
+    TArray<uint8> PendingBuffer;
+    TArray<uint8> WriteBuffer;
+    uint64 LastSequence;
+    uint64 WrittenSequence;
+    double LastSyncTime = 0.0;
+    TUniquePtr<IFileHandle> File;
+
+    std::atomic<uint64> DurableSequence;
+    std::atomic<int64> BytesSinceRotation { 0 };
+    std::atomic<bool> bHealthy { true };
+    std::atomic<bool> bStopping { false };
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+};
+
+// =============================================================================
+// SNAPSHOTS
+// =============================================================================
+
+// A point-in-time copy of the orchestrator's durable state. Records go into a segment file
+// (see FHexademic6Segment) so recovery mounts them instead of reading them; the maps go into a
+// small checksummed state file written after it. A snapshot exists once its state file does.
+struct HEXADEMIC6LATTICE_API FHexademic6Snapshot
+{
+    uint64 Sequence = 0;      // Last WAL sequence covered
+    uint64 WalGeneration = 0; // First WAL generation not covered
+    TMap<FDUIDSIndex, FGuid> IndexToMemory;
+    TMap<FDUIDSIndex, int32> AccessCounts;     // Heavy hitters' estimated lifetime counts
+    TMap<FDUIDSIndex, double> LastAccessTimes; // Wall-clock seconds; only filled by older snapshots
+
+    // Record views point into RecordBytes or into mapped segments that outlive the snapshot.
+    TArray<FHexademic6SegmentRecordSource> Records;
+    TArray64<uint8> RecordBytes;
+    TMap<uint32, TArray<uint8>> Dictionaries;
+
+    // Writes the segment, then the state file. Safe to call off the game thread.
+    bool Write(const FString& Directory);
+
+    // Loads the newest snapshot whose state file is intact (records are left in the segment).
+    static bool LoadLatest(const FString& Directory, FHexademic6Snapshot& OutSnapshot, FString& OutSegmentPath);
+
+    // Deletes snapshots older than Sequence. A segment that is still mapped may refuse deletion
+    // on some platforms; it is retried by the next call.
+    static void DeleteBefore(const FString& Directory, uint64 Sequence);
+
+    static FString GetSegmentPath(const FString& Directory, uint64 Sequence);
+    static FString GetStatePath(const FString& Directory, uint64 Sequence);
+};
@@ -2,6 +2,7 @@
 // This file implements utility methods for FHexademic6DCoordinate and FHexademicMemoryNode.
 
 #include "HexademicSixLattice.h"
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::GetNextOrder, GetPreviousOrder
 #include "Misc/Guid.h"
 #include "Math/UnrealMathUtility.h"
 #include "HAL/PlatformTime.h"
@@ -34,61 +35,8 @@ void FHexademic6DCoordinate::GenerateFromArchetype(uint32 ArchetypeID, float Emo
         ArchetypeID, X, Y, Z, W, U, V);
 }
 
-bool FHexademic6DCoordinate::IsValidForOrder(ECognitiveLatticeOrder Order) const
-{
-    // Checks if the coordinate values are within the conceptual bounds of the given lattice order.
-    // The 'OrderSize' represents the maximum extent of each dimension for that specific order.
-    uint32 OrderSize = 0;
-    switch (Order)
-    {
-        case ECognitiveLatticeOrder::Order12: OrderSize = 12; break;
-        case ECognitiveLatticeOrder::Order18: OrderSize = 18; break;
-        case ECognitiveLatticeOrder::Order36: OrderSize = 36; break;
-        case ECognitiveLatticeOrder::Order72: OrderSize = 72; break;
-        case ECognitiveLatticeOrder::Order144: OrderSize = 144; break;
-        case ECognitiveLatticeOrder::OrderInfinite: OrderSize = 65536; break; // uint16 max for unbounded
-        default: return false;
-    }
-
-    return (X < OrderSize && Y < OrderSize && Z < OrderSize && 
-            W < OrderSize && U < OrderSize && V < OrderSize);
-}
-
-void FHexademic6DCoordinate::FromLinearIndex(uint64 Index, ECognitiveLatticeOrder Order)
-{
-    // Converts a linear (1D) index back into a 6D coordinate for a given lattice order.
-    // This assumes a continuous, compact linear indexing scheme.
-    uint32 OrderSize = 0;
-    switch (Order)
-    {
-        case ECognitiveLatticeOrder::Order12: OrderSize = 12; break;
-        case ECognitiveLatticeOrder::Order18: OrderSize = 18; break;
-        case ECognitiveLatticeOrder::Order36: OrderSize = 36; break;
-        case ECognitiveLatticeOrder::Order72: OrderSize = 72; break;
-        case ECognitiveLatticeOrder::Order144: OrderSize = 144; break;
-        case ECognitiveLatticeOrder::OrderInfinite: OrderSize = 65536; break;
-        default: return;
-    }
-
-    LatticeOrder = Order;
-    if (OrderSize == 0) return; // Prevent division by zero
-
-    // Calculate each dimension from the linear index
-    uint64 CurrentIndex = Index;
-    V = (uint16)(CurrentIndex / FMath::Pow(OrderSize, 5));
-    CurrentIndex %= (uint64)FMath::Pow(OrderSize, 5);
-    U = (uint16)(CurrentIndex / FMath::Pow(OrderSize, 4));
-    CurrentIndex %= (uint64)FMath::Pow(OrderSize, 4);
-    W = (uint16)(CurrentIndex / FMath::Pow(OrderSize, 3));
-    CurrentIndex %= (uint64)FMath::Pow(OrderSize, 3);
-    Z = (uint16)(CurrentIndex / FMath::Pow(OrderSize, 2));
-    CurrentIndex %= (uint64)FMath::Pow(OrderSize, 2);
-    Y = (uint16)(CurrentIndex / OrderSize);
-    X = (uint16)(CurrentIndex % OrderSize);
-
-    UE_LOG(LogHexademicLattice, Verbose, TEXT("Converted linear index %llu to 6D coordinate for order %d: X=%d, Y=%d, Z=%d, W=%d, U=%d, V=%d"), 
-        Index, (uint8)Order, X, Y, Z, W, U, V);
-}
+// NOTE: IsValidForOrder and FromLinearIndex are implemented once, in Hexademic6CognitiveLattice.cpp,
+// on top of the order tables in Hexademic6OrderIndexing.h.
 
 // =============================================================================
 // FHexademicMemoryNode Implementations
@@ -121,30 +69,15 @@ void FHexademicMemoryNode::UpdateResonanceFromNeighbors(const TArray<FHexademicM
 ECognitiveLatticeOrder FHexademicMemoryNode::DetermineOptimalOrder() const
 {
     // Determines the most suitable cognitive lattice order for this memory based on its current
-    // state (access, resonance, decay, mythic depth).
+    // state (access, resonance, decay, mythic depth). A node moves at most one order per call,
+    // along the canonical sequence of FHexademic6OrderIndexing.
     if (ShouldPromoteToHigherOrder())
     {
-        switch (LatticePosition.LatticeOrder)
-        {
-            case ECognitiveLatticeOrder::Order12: return ECognitiveLatticeOrder::Order18;
-            case ECognitiveLatticeOrder::Order18: return ECognitiveLatticeOrder::Order36;
-            case ECognitiveLatticeOrder::Order36: return ECognitiveLatticeOrder::Order72;
-            case ECognitiveLatticeOrder::Order72: return ECognitiveLatticeOrder::Order144;
-            case ECognitiveLatticeOrder::Order144: return ECognitiveLatticeOrder::OrderInfinite;
-            default: return ECognitiveLatticeOrder::OrderInfinite; // Cannot promote further
-        }
+        return FHexademic6OrderIndexing::GetNextOrder(LatticePosition.LatticeOrder);
     }
     else if (ShouldDecayToLowerOrder())
     {
-        switch (LatticePosition.LatticeOrder)
-        {
-            case ECognitiveLatticeOrder::OrderInfinite: return ECognitiveLatticeOrder::Order144;
-            case ECognitiveLatticeOrder::Order144: return ECognitiveLatticeOrder::Order72;
-            case ECognitiveLatticeOrder::Order72: return ECognitiveLatticeOrder::Order36;
-            case ECognitiveLatticeOrder::Order36: return ECognitiveLatticeOrder::Order18;
-            case ECognitiveLatticeOrder::Order18: return ECognitiveLatticeOrder::Order12;
-            default: return ECognitiveLatticeOrder::Order12; // Cannot demote further
-        }
+        return FHexademic6OrderIndexing::GetPreviousOrder(LatticePosition.LatticeOrder);
     }
     return LatticePosition.LatticeOrder; // No change needed
 }
@@ -2,6 +2,8 @@
 // Implements the UMythkeeperCodex6Component for mythic processing and narrative generation.
 
 #include "HexademicSixLattice.h"
+#include "Hexademic6LatticeStore.h" // For FHexademic6LatticeStore
+#include "Hexademic6HotspotDetector.h" // For FHexademic6ResonanceHotspot
 #include "Engine/DataAsset.h" // For UDataAsset
 #include "Logging/LogMacros.h" // For UE_LOG
 #include "TimerManager.h" // For FTimerHandle
@@ -79,15 +81,16 @@ void UMythkeeperCodex6Component::ProcessCollectiveMemoryEmergence()
     if (FHexademic6ServiceLocator::AreAllServicesRegistered())
     {
         IHexademic6CognitiveLatticeService& CognitiveLattice = FHexademic6ServiceLocator::GetCognitiveLatticeService();
-        TArray<FHexademicMemoryNode> DeepMemories = CognitiveLattice.GetMemoriesInOrder(ECognitiveLatticeOrder::Order144);
-        
+        // The deepest bounded order is handed over as store columns; no nodes are materialized.
+        const FHexademic6OrderColumns& DeepMemories = CognitiveLattice.GetLatticeStore().GetColumns(ECognitiveLatticeOrder::Order192);
+
         if (DeepMemories.Num() >= MinimumMemoriesForMyth)
         {
             IHexademic6MythicService& MythicService = FHexademic6ServiceLocator::GetMythicService();
             MythicService.ProcessMythicEmergence(DeepMemories);
             
             // Example of extracting and logging a narrative
-            TArray<FString> EmergentNarratives = MythicService.ExtractNarrativeThreads(ECognitiveLatticeOrder::Order72);
+            TArray<FString> EmergentNarratives = MythicService.ExtractNarrativeThreads(ECognitiveLatticeOrder::Order96);
             for (const FString& Narrative : EmergentNarratives)
             {
                 if (!ActiveNarrativeThreads.Contains(Narrative))
@@ -107,13 +110,9 @@ void UMythkeeperCodex6Component::ProcessArchetypalActivation()
     if (FHexademic6ServiceLocator::AreAllServicesRegistered())
     {
         IHexademic6CognitiveLatticeService& CognitiveLattice = FHexademic6ServiceLocator::GetCognitiveLatticeService();
-        // Get memories from various orders to determine active archetypes
-        TArray<FHexademicMemoryNode> AllMemories;
-        AllMemories.Append(CognitiveLattice.GetMemoriesInOrder(ECognitiveLatticeOrder::Order36));
-        AllMemories.Append(CognitiveLattice.GetMemoriesInOrder(ECognitiveLatticeOrder::Order72));
-        AllMemories.Append(CognitiveLattice.GetMemoriesInOrder(ECognitiveLatticeOrder::Order144));
-        
-        UpdateArchetypeActivations(AllMemories);
+        // Accumulate straight from the store columns of the deeper orders; no nodes are materialized.
+        static const ECognitiveLatticeOrder ArchetypalOrders[] = { ECognitiveLatticeOrder::Order48, ECognitiveLatticeOrder::Order96, ECognitiveLatticeOrder::Order192 };
+        UpdateArchetypeActivations(CognitiveLattice.GetLatticeStore(), ArchetypalOrders);
 
         IHexademic6MythicService& MythicService = FHexademic6ServiceLocator::GetMythicService();
         MythicService.UpdateArchetypeActivations(CurrentArchetypeActivations);
@@ -205,7 +204,7 @@ void UMythkeeperCodex6Component::ProcessLatticeOrder(ECognitiveLatticeOrder Orde
     if (FHexademic6ServiceLocator::AreAllServicesRegistered())
     {
         IHexademic6CognitiveLatticeService& CognitiveLattice = FHexademic6ServiceLocator::GetCognitiveLatticeService();
-        TArray<FHexademicMemoryNode> Memories = CognitiveLattice.GetMemoriesInOrder(Order);
+        const FHexademic6OrderColumns& Memories = CognitiveLattice.GetLatticeStore().GetColumns(Order);
         // Perform order-specific processing here, e.g., update resonance, check for patterns
     }
 }
@@ -225,20 +224,38 @@ void UMythkeeperCodex6Component::UpdateArchetypeActivations(const TArray<FHexade
     UE_LOG(LogHexademicLattice, Verbose, TEXT("Updated %d archetype activations."), CurrentArchetypeActivations.Num());
 }
 
+void UMythkeeperCodex6Component::UpdateArchetypeActivations(const FHexademic6LatticeStore& Store, TConstArrayView<ECognitiveLatticeOrder> Orders)
+{
+    // Column-wise variant of the above: reads only the weight, resonance and archetype columns.
+    CurrentArchetypeActivations.Empty();
+    for (ECognitiveLatticeOrder Order : Orders)
+    {
+        const FHexademic6OrderColumns& Columns = Store.GetColumns(Order);
+        const int32 NumRows = Columns.Num();
+        for (int32 Row = 0; Row < NumRows; ++Row)
+        {
+            const float Contribution = Columns.CognitiveWeight[Row] * Columns.ResonanceStrength[Row];
+            for (uint32 ArchetypeID : Columns.Archetypes[Row])
+            {
+                CurrentArchetypeActivations.FindOrAdd(ArchetypeID) += Contribution;
+            }
+        }
+    }
+    UE_LOG(LogHexademicLattice, Verbose, TEXT("Updated %d archetype activations."), CurrentArchetypeActivations.Num());
+}
+
 void UMythkeeperCodex6Component::DetectEmergentMythicPatterns()
 {
-    // Placeholder: Detects high-level mythic patterns from deeply resonant memories.
-    // This could involve analyzing clusters in the 6D space or specific archetypal convergences.
-    UE_LOG(LogHexademicLattice, Log, TEXT("Detecting emergent mythic patterns. (Placeholder)"));
+    // Detects high-level mythic patterns from deeply resonant memories: the strongest resonance
+    // hotspot of the mythic order is recorded as a point of collective resonance.
+    UE_LOG(LogHexademicLattice, Log, TEXT("Detecting emergent mythic patterns."));
     if (FHexademic6ServiceLocator::AreAllServicesRegistered())
     {
-        IHexademic6CognitiveLatticeService& CognitiveLattice = FHexademic6ServiceLocator::GetCognitiveLatticeService();
-        TArray<FHexademic6DCoordinate> DetectedPatterns = CognitiveLattice.DetectEmergentPatterns(ECognitiveLatticeOrder::Order144);
-        
-        // Example: If a strong pattern is detected, record a collective resonance.
-        if (DetectedPatterns.Num() > 0)
+        TArray<FHexademic6ResonanceHotspot> Hotspots;
+        FHexademic6ServiceLocator::GetResonanceService().GetResonanceHotspots(ECognitiveLatticeOrder::Order192, 1, Hotspots);
+        if (Hotspots.Num() > 0)
         {
-            FHexademic6ServiceLocator::GetMythicService().RecordCollectiveResonance(DetectedPatterns[0], 0.8f);
+            FHexademic6ServiceLocator::GetMythicService().RecordCollectiveResonance(Hotspots[0].Centroid, FMath::Clamp(Hotspots[0].PeakDensity, 0.0f, 1.0f));
         }
     }
 }
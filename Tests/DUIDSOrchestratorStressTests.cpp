@@ -0,0 +1,92 @@
+// DUIDSOrchestratorStressTests.cpp
+// Multi-threaded mixed workload over the sharded orchestrator, reporting throughput per thread count.
+
+#include "HexademicSixLattice.h"     // For FDUIDSOrchestrator, FHexademicMemoryNode
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::GetExtent
+#include "Hexademic6RecordCodec.h"   // For FHexademic6RecordCodec::GetLevelForOrder
+#include "Misc/AutomationTest.h"     // For IMPLEMENT_SIMPLE_AUTOMATION_TEST
+#include "Async/ParallelFor.h"       // For ParallelFor
+#include "HAL/PlatformTime.h"        // For FPlatformTime::Seconds()
+#include "Math/RandomStream.h"       // For FRandomStream
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace DUIDSOrchestratorStressTestsPrivate
+{
+    constexpr int32 OperationsPerWorker = 20000;
+    constexpr int32 ThreadCounts[] = { 1, 2, 4, 8, 16 };
+
+    FHexademicMemoryNode MakeMemory(FRandomStream& Random)
+    {
+        const ECognitiveLatticeOrder Order = static_cast<ECognitiveLatticeOrder>(Random.RandRange(0, (int32)ECognitiveLatticeOrder::Order192));
+        const int32 Limit = FHexademic6OrderIndexing::GetExtent(Order);
+        const auto Axis = [&Random, Limit]() { return Random.RandRange(-(Limit - 1), Limit - 1); };
+        FHexademicMemoryNode Memory;
+        Memory.MemoryID = FGuid::NewGuid();
+        Memory.LatticePosition = FHexademic6DCoordinate(Axis(), Axis(), Axis(), Axis(), Axis(), Axis(), Order);
+        Memory.EventType = TEXT("Stress");
+        Memory.ResonanceStrength = Random.GetFraction();
+        Memory.EmotionalValence = Random.FRandRange(-1.0f, 1.0f);
+        Memory.EmotionalIntensity = Random.GetFraction();
+        return Memory;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDUIDSOrchestratorStressTest, "Hexademic.DUIDSOrchestrator.Stress",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FDUIDSOrchestratorStressTest::RunTest(const FString& Parameters)
+{
+    // Each worker runs a fixed mix against one shared orchestrator: 40% index and store a new
+    // memory, 40% retrieve one of its own earlier memories, 20% a range query on one. Every
+    // retrieval of a stored memory must succeed. Throughput is reported per worker count; run in
+    // a development or shipping build, debug timings say nothing.
+    using namespace DUIDSOrchestratorStressTestsPrivate;
+    for (const int32 NumWorkers : ThreadCounts)
+    {
+        FDUIDSOrchestrator Orchestrator;
+        std::atomic<int32> Misses{ 0 };
+        std::atomic<int64> RangeKeys{ 0 };
+        const double Start = FPlatformTime::Seconds();
+        ParallelFor(NumWorkers, [&Orchestrator, &Misses, &RangeKeys](int32 Worker)
+        {
+            FRandomStream Random(0x5EED + Worker);
+            TArray<FDUIDSIndex> Stored;
+            Stored.Reserve(OperationsPerWorker);
+            for (int32 Operation = 0; Operation < OperationsPerWorker; ++Operation)
+            {
+                const int32 Roll = Random.RandRange(0, 9);
+                if (Roll < 4 || Stored.Num() == 0)
+                {
+                    FHexademicMemoryNode Memory = MakeMemory(Random);
+                    Memory.QuickAccessIndex = Orchestrator.GenerateIndex(Memory);
+                    Orchestrator.CompressMemoryNode(Memory, FHexademic6RecordCodec::GetLevelForOrder(Memory.LatticePosition.LatticeOrder));
+                    Stored.Add(Memory.QuickAccessIndex);
+                }
+                else if (Roll < 8)
+                {
+                    if (!Orchestrator.RetrieveByIndex(Stored[Random.RandHelper(Stored.Num())], false).IsSet())
+                    {
+                        ++Misses;
+                    }
+                }
+                else
+                {
+                    const FDUIDSIndex& Key = Stored[Random.RandHelper(Stored.Num())];
+                    RangeKeys += Orchestrator.QueryRange(Key, Key).Num();
+                }
+            }
+        }, NumWorkers == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+        const double Seconds = FPlatformTime::Seconds() - Start;
+
+        // Keys may collide across workers, in which case the later memory owns the key; every
+        // stored key is still mapped to some memory, so nothing is ever missing.
+        TestEqual(FString::Printf(TEXT("%d workers: missing retrievals"), NumWorkers), Misses.load(), 0);
+        AddInfo(FString::Printf(TEXT("%d workers: %.0f operations/s (%d operations in %.1f ms, %lld keys from range queries)."),
+            NumWorkers, NumWorkers * OperationsPerWorker / Seconds, NumWorkers * OperationsPerWorker, Seconds * 1000.0, RangeKeys.load()));
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
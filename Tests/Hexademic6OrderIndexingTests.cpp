@@ -0,0 +1,157 @@
+// Hexademic6OrderIndexingTests.cpp
+// Round-trip tests and a micro-benchmark for the order-specialized linear index conversion.
+
+#include "Hexademic6OrderIndexing.h"
+#include "Misc/AutomationTest.h"     // For IMPLEMENT_SIMPLE_AUTOMATION_TEST
+#include "HAL/PlatformTime.h"        // For FPlatformTime::Seconds()
+#include "Math/RandomStream.h"       // For FRandomStream
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace Hexademic6OrderIndexingTestsPrivate
+{
+    constexpr int32 NumSamples = 1 << 16;
+
+    FHexademic6DCoordinate MakeRandomCoordinate(FRandomStream& Random, ECognitiveLatticeOrder Order, int32 AxisLimit)
+    {
+        const auto Axis = [&Random, AxisLimit]() { return Random.RandRange(-AxisLimit, AxisLimit); };
+        return FHexademic6DCoordinate(Axis(), Axis(), Axis(), Axis(), Axis(), Axis(), Order);
+    }
+
+    // The pre-specialization conversion: per-call order switch, FMath::Pow strides in floating
+    // point and 64-bit divides, kept here only as the benchmark baseline.
+    void FromLinearIndexFloat(uint64 Index, ECognitiveLatticeOrder Order, FHexademic6DCoordinate& OutCoord)
+    {
+        const int32 Extent = FHexademic6OrderIndexing::GetExtent(Order);
+        const uint32 Span = 2 * Extent - 1;
+        uint64 CurrentIndex = Index;
+        int32* Axes[6] = { &OutCoord.V, &OutCoord.U, &OutCoord.W, &OutCoord.Z, &OutCoord.Y, &OutCoord.X };
+        for (int32 Power = 5; Power >= 0; --Power)
+        {
+            const uint64 Stride = (uint64)FMath::Pow((double)Span, (double)Power);
+            *Axes[5 - Power] = (int32)(CurrentIndex / Stride) - (Extent - 1);
+            CurrentIndex %= Stride;
+        }
+        OutCoord.LatticeOrder = Order;
+    }
+
+    bool SameAxes(const FHexademic6DCoordinate& A, const FHexademic6DCoordinate& B)
+    {
+        return A.X == B.X && A.Y == B.Y && A.Z == B.Z && A.W == B.W && A.U == B.U && A.V == B.V;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHexademic6OrderIndexingRoundTripTest, "Hexademic.OrderIndexing.RoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHexademic6OrderIndexingRoundTripTest::RunTest(const FString& Parameters)
+{
+    using namespace Hexademic6OrderIndexingTestsPrivate;
+    FRandomStream Random(0x6E6A);
+    for (int32 OrderIndex = 0; OrderIndex < FHexademic6OrderIndexing::NumOrders; ++OrderIndex)
+    {
+        const ECognitiveLatticeOrder Order = static_cast<ECognitiveLatticeOrder>(OrderIndex);
+        const bool bInfinite = Order == ECognitiveLatticeOrder::OrderInfinite;
+        // OrderInfinite round-trips inside its documented window only.
+        const int32 AxisLimit = bInfinite ? 511 : FHexademic6OrderIndexing::GetExtent(Order) - 1;
+        int32 Mismatches = 0;
+        for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+        {
+            const FHexademic6DCoordinate Coord = MakeRandomCoordinate(Random, Order, AxisLimit);
+            FHexademic6DCoordinate Decoded;
+            FHexademic6OrderIndexing::FromLinearIndex(FHexademic6OrderIndexing::ToLinearIndex(Coord, Order), Order, Decoded);
+            Mismatches += SameAxes(Coord, Decoded) && Decoded.LatticeOrder == Order ? 0 : 1;
+        }
+        TestEqual(FString::Printf(TEXT("Order %d round-trip mismatches"), OrderIndex), Mismatches, 0);
+    }
+
+    // Extremes of the bounded orders and of the infinite order's window.
+    const FHexademic6DCoordinate Low(-191, -191, -191, -191, -191, -191, ECognitiveLatticeOrder::Order192);
+    const FHexademic6DCoordinate High(191, 191, 191, 191, 191, 191, ECognitiveLatticeOrder::Order192);
+    TestNotEqual(TEXT("Order192 extremes are distinct"),
+        FHexademic6OrderIndexing::ToLinearIndex(Low, ECognitiveLatticeOrder::Order192), FHexademic6OrderIndexing::ToLinearIndex(High, ECognitiveLatticeOrder::Order192));
+    const FHexademic6DCoordinate Corner(-1024, 1023, -1024, 1023, -512, 511, ECognitiveLatticeOrder::OrderInfinite);
+    FHexademic6DCoordinate DecodedCorner;
+    FHexademic6OrderIndexing::FromLinearIndex(FHexademic6OrderIndexing::ToLinearIndex(Corner, ECognitiveLatticeOrder::OrderInfinite), ECognitiveLatticeOrder::OrderInfinite, DecodedCorner);
+    TestTrue(TEXT("OrderInfinite window corner round-trips"), SameAxes(Corner, DecodedCorner));
+
+    // The batch API agrees with the scalar one.
+    TArray<FHexademic6DCoordinate> Coords;
+    for (int32 Sample = 0; Sample < 1024; ++Sample)
+    {
+        Coords.Add(MakeRandomCoordinate(Random, ECognitiveLatticeOrder::Order96, 95));
+    }
+    TArray<uint64> Indices;
+    Indices.SetNumUninitialized(Coords.Num());
+    FHexademic6OrderIndexing::ToLinearIndices(Coords, ECognitiveLatticeOrder::Order96, Indices);
+    int32 BatchMismatches = 0;
+    for (int32 Sample = 0; Sample < Coords.Num(); ++Sample)
+    {
+        BatchMismatches += Indices[Sample] == FHexademic6OrderIndexing::ToLinearIndex(Coords[Sample], ECognitiveLatticeOrder::Order96) ? 0 : 1;
+    }
+    TestEqual(TEXT("Batch and scalar indices agree"), BatchMismatches, 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHexademic6OrderIndexingBenchmark, "Hexademic.OrderIndexing.Benchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FHexademic6OrderIndexingBenchmark::RunTest(const FString& Parameters)
+{
+    // Decodes the same indices with the float baseline, the scalar dispatch and the batch API,
+    // and reports nanoseconds per coordinate. Run in a development or shipping build; debug
+    // timings say nothing.
+    using namespace Hexademic6OrderIndexingTestsPrivate;
+    constexpr int32 NumCoords = 1 << 20;
+    const ECognitiveLatticeOrder Order = ECognitiveLatticeOrder::Order96;
+    FRandomStream Random(0xBE7C);
+    TArray<uint64> Indices;
+    Indices.Reserve(NumCoords);
+    for (int32 Sample = 0; Sample < NumCoords; ++Sample)
+    {
+        Indices.Add(FHexademic6OrderIndexing::ToLinearIndex(MakeRandomCoordinate(Random, Order, 95), Order));
+    }
+    TArray<FHexademic6DCoordinate> Baseline;
+    TArray<FHexademic6DCoordinate> Scalar;
+    TArray<FHexademic6DCoordinate> Batch;
+    Baseline.SetNum(NumCoords);
+    Scalar.SetNum(NumCoords);
+    Batch.SetNum(NumCoords);
+
+    const auto Measure = [](TFunctionRef<void()> Body)
+    {
+        const double Start = FPlatformTime::Seconds();
+        Body();
+        return (FPlatformTime::Seconds() - Start) * 1e9 / NumCoords;
+    };
+    const double BaselineNs = Measure([&]()
+    {
+        for (int32 Sample = 0; Sample < NumCoords; ++Sample)
+        {
+            FromLinearIndexFloat(Indices[Sample], Order, Baseline[Sample]);
+        }
+    });
+    const double ScalarNs = Measure([&]()
+    {
+        for (int32 Sample = 0; Sample < NumCoords; ++Sample)
+        {
+            FHexademic6OrderIndexing::FromLinearIndex(Indices[Sample], Order, Scalar[Sample]);
+        }
+    });
+    const double BatchNs = Measure([&]()
+    {
+        FHexademic6OrderIndexing::FromLinearIndices(Indices, Order, Batch, false);
+    });
+
+    int32 Mismatches = 0;
+    for (int32 Sample = 0; Sample < NumCoords; ++Sample)
+    {
+        Mismatches += SameAxes(Baseline[Sample], Scalar[Sample]) && SameAxes(Scalar[Sample], Batch[Sample]) ? 0 : 1;
+    }
+    TestEqual(TEXT("All paths decode the same coordinates"), Mismatches, 0);
+    AddInfo(FString::Printf(TEXT("FromLinearIndex, %d coordinates of Order96: float baseline %.2f ns, specialized %.2f ns, batch %.2f ns per coordinate."),
+        NumCoords, BaselineNs, ScalarNs, BatchNs));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,292 @@
+// Hexademic6RecordCodecTests.cpp
+// Round-trip, dictionary, corruption and restore tests for the record codec, plus a per-level throughput benchmark.
+
+#include "Hexademic6RecordCodec.h"
+#include "Hexademic6OrderIndexing.h" // For FHexademic6OrderIndexing::GetExtent
+#include "HexademicSixLattice.h"     // For FDUIDSOrchestrator
+#include "Misc/AutomationTest.h"     // For IMPLEMENT_SIMPLE_AUTOMATION_TEST
+#include "HAL/PlatformTime.h"        // For FPlatformTime::Seconds()
+#include "Math/RandomStream.h"       // For FRandomStream
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace Hexademic6RecordCodecTestsPrivate
+{
+    constexpr uint8 MaxTestedLevel = 4;
+
+    FDUIDSIndex MakeRandomKey(FRandomStream& Random)
+    {
+        FDUIDSIndex Key;
+        Key.MajorClass = (uint8)Random.RandRange(0, 255);
+        Key.Division = (uint8)Random.RandRange(0, 255);
+        Key.Section = (uint16)Random.RandRange(0, 65535);
+        Key.SubSection = (uint32)Random.GetUnsignedInt();
+        Key.Cutter = (uint16)Random.RandRange(0, 65535);
+        Key.Edition = (uint8)Random.RandRange(0, 255);
+        return Key;
+    }
+
+    // Nodes of one EventType share most of their serialized bytes, which is what the LZ
+    // dictionaries are trained on.
+    FHexademicMemoryNode MakeRandomNode(FRandomStream& Random, const TCHAR* EventType)
+    {
+        const ECognitiveLatticeOrder Order = static_cast<ECognitiveLatticeOrder>(Random.RandRange(0, FHexademic6OrderIndexing::NumOrders - 2));
+        const int32 Limit = FHexademic6OrderIndexing::GetExtent(Order) - 1;
+        const auto Axis = [&Random, Limit]() { return Random.RandRange(-Limit, Limit); };
+        FHexademicMemoryNode Memory;
+        Memory.MemoryID = FGuid(Random.GetUnsignedInt(), Random.GetUnsignedInt(), Random.GetUnsignedInt(), Random.GetUnsignedInt());
+        Memory.LatticePosition = FHexademic6DCoordinate(Axis(), Axis(), Axis(), Axis(), Axis(), Axis(), Order);
+        Memory.EventType = EventType;
+        Memory.ResonanceStrength = Random.GetFraction();
+        Memory.CognitiveWeight = Random.GetFraction();
+        Memory.TemporalDecay = Random.GetFraction();
+        Memory.AccessCount = Random.RandRange(0, 1000);
+        Memory.EmotionalValence = Random.FRandRange(-1.0f, 1.0f);
+        Memory.EmotionalIntensity = Random.GetFraction();
+        Memory.MythicDepth = Random.GetFraction();
+        for (int32 Reference = Random.RandRange(0, 6); Reference > 0; --Reference)
+        {
+            Memory.CrossReferences.Add(MakeRandomKey(Random));
+        }
+        for (int32 Archetype = Random.RandRange(0, 4); Archetype > 0; --Archetype)
+        {
+            Memory.AssociatedArchetypes.Add((uint32)Random.RandRange(0, 63));
+        }
+        return Memory;
+    }
+
+    bool SameNode(const FHexademicMemoryNode& A, const FHexademicMemoryNode& B)
+    {
+        return FHexademicMemoryNode::StaticStruct()->CompareScriptStruct(&A, &B, 0);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHexademic6RecordCodecRoundTripTest, "Hexademic.RecordCodec.RoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHexademic6RecordCodecRoundTripTest::RunTest(const FString& Parameters)
+{
+    using namespace Hexademic6RecordCodecTestsPrivate;
+    FRandomStream Random(0xC0DE);
+    FHexademic6RecordCodec Codec;
+    for (uint8 Level = 0; Level <= MaxTestedLevel; ++Level)
+    {
+        int32 Mismatches = 0;
+        int32 WrongCodecs = 0;
+        for (int32 Sample = 0; Sample < 256; ++Sample)
+        {
+            const FHexademicMemoryNode Memory = MakeRandomNode(Random, TEXT("RoundTrip"));
+            TArray<uint8> Record;
+            FHexademic6RecordFrameHeader Header;
+            FHexademicMemoryNode Decoded;
+            if (!Codec.Compress(Memory, Level, Record) || !FHexademic6RecordCodec::ReadFrameHeader(Record, Header) || !Codec.Decompress(Record, Decoded))
+            {
+                ++Mismatches;
+                continue;
+            }
+            Mismatches += SameNode(Memory, Decoded) ? 0 : 1;
+            // Incompressible bodies fall back to Stored; any other codec must be the level's.
+            WrongCodecs += Header.Level == Level && (Header.Codec == FHexademic6RecordCodec::GetCodecForLevel(Level) || Header.Codec == EHexademic6RecordCodec::Stored) ? 0 : 1;
+        }
+        TestEqual(FString::Printf(TEXT("Level %d round-trip mismatches"), Level), Mismatches, 0);
+        TestEqual(FString::Printf(TEXT("Level %d records with an unexpected codec"), Level), WrongCodecs, 0);
+    }
+
+    // Sliced reads agree with the full decode.
+    const FHexademicMemoryNode Memory = MakeRandomNode(Random, TEXT("Slices"));
+    TArray<uint8> Record;
+    FHexademic6RecordSliceHeader Slices;
+    TArray<FDUIDSIndex> References;
+    TestTrue(TEXT("Sliced node compresses"), Codec.Compress(Memory, 1, Record));
+    TestTrue(TEXT("Slice header reads"), FHexademic6RecordCodec::ReadSliceHeader(Record, Slices) && FHexademic6RecordCodec::ReadCrossReferences(Record, References));
+    TestEqual(TEXT("Sliced resonance"), Slices.ResonanceStrength, Memory.ResonanceStrength);
+    TestEqual(TEXT("Sliced access count"), Slices.AccessCount, Memory.AccessCount);
+    TestTrue(TEXT("Sliced cross references"), References == Memory.CrossReferences);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHexademic6RecordCodecDictionaryTest, "Hexademic.RecordCodec.Dictionary",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHexademic6RecordCodecDictionaryTest::RunTest(const FString& Parameters)
+{
+    using namespace Hexademic6RecordCodecTestsPrivate;
+    FRandomStream Random(0xD1C7);
+    FHexademic6RecordCodec Codec;
+
+    // Level 2 without a trained dictionary is plain LZ.
+    const FHexademicMemoryNode Untrained = MakeRandomNode(Random, TEXT("Untrained"));
+    TArray<uint8> Record;
+    FHexademic6RecordFrameHeader Header;
+    FHexademicMemoryNode Decoded;
+    TestTrue(TEXT("Untrained node compresses"), Codec.Compress(Untrained, 2, Record) && FHexademic6RecordCodec::ReadFrameHeader(Record, Header));
+    TestEqual(TEXT("No dictionary without training"), Header.DictionaryId, 0u);
+    TestTrue(TEXT("Untrained node round-trips"), Codec.Decompress(Record, Decoded) && SameNode(Untrained, Decoded));
+
+    TArray<TArray<uint8>> Samples;
+    for (int32 Sample = 0; Sample < 64; ++Sample)
+    {
+        FHexademic6RecordCodec::SerializeNode(MakeRandomNode(Random, TEXT("Trained")), Samples.AddDefaulted_GetRef());
+    }
+    const uint32 DictionaryId = Codec.TrainDictionary(TEXT("Trained"), Samples);
+    TestNotEqual(TEXT("Dictionary trained"), DictionaryId, 0u);
+
+    int32 Mismatches = 0;
+    int32 Undictionaried = 0;
+    TArray<TArray<uint8>> Records;
+    TArray<FHexademicMemoryNode> Memories;
+    for (int32 Sample = 0; Sample < 64; ++Sample)
+    {
+        const FHexademicMemoryNode& Memory = Memories.Add_GetRef(MakeRandomNode(Random, TEXT("Trained")));
+        TArray<uint8>& Compressed = Records.AddDefaulted_GetRef();
+        if (!Codec.Compress(Memory, 2, Compressed) || !FHexademic6RecordCodec::ReadFrameHeader(Compressed, Header) || !Codec.Decompress(Compressed, Decoded))
+        {
+            ++Mismatches;
+            continue;
+        }
+        Mismatches += SameNode(Memory, Decoded) ? 0 : 1;
+        Undictionaried += Header.Codec == EHexademic6RecordCodec::LZ && Header.DictionaryId == DictionaryId ? 0 : 1;
+    }
+    TestEqual(TEXT("Dictionary round-trip mismatches"), Mismatches, 0);
+    TestEqual(TEXT("Level 2 records not using the dictionary"), Undictionaried, 0);
+
+    // A reader without the dictionary must refuse the records rather than misdecode them, and
+    // reads them once the dictionary is registered.
+    FHexademic6RecordCodec Reader;
+    AddExpectedError(TEXT("is not registered"), EAutomationExpectedErrorFlags::Contains, 0);
+    AddExpectedError(TEXT("corrupt record"), EAutomationExpectedErrorFlags::Contains, 0);
+    TestFalse(TEXT("Record needing a missing dictionary is refused"), Reader.Decompress(Records[0], Decoded));
+    Reader.AddDictionary(DictionaryId, *Codec.FindDictionary(DictionaryId));
+    TestTrue(TEXT("Record decodes once the dictionary is registered"), Reader.Decompress(Records[0], Decoded) && SameNode(Memories[0], Decoded));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHexademic6RecordCodecCorruptionTest, "Hexademic.RecordCodec.Corruption",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHexademic6RecordCodecCorruptionTest::RunTest(const FString& Parameters)
+{
+    // Damaged records are reported as failures and never decode into a node.
+    using namespace Hexademic6RecordCodecTestsPrivate;
+    FRandomStream Random(0xBAD0);
+    FHexademic6RecordCodec Codec;
+    AddExpectedError(TEXT("RecordCodec:"), EAutomationExpectedErrorFlags::Contains, 0);
+    for (uint8 Level = 0; Level <= MaxTestedLevel; ++Level)
+    {
+        const FHexademicMemoryNode Memory = MakeRandomNode(Random, TEXT("Corruption"));
+        TArray<uint8> Record;
+        if (!TestTrue(FString::Printf(TEXT("Level %d compresses"), Level), Codec.Compress(Memory, Level, Record)))
+        {
+            continue;
+        }
+        FHexademicMemoryNode Decoded;
+
+        int32 AcceptedTruncations = 0;
+        for (int32 Length = 0; Length < Record.Num(); ++Length)
+        {
+            AcceptedTruncations += Codec.Decompress(TConstArrayView<uint8>(Record.GetData(), Length), Decoded) ? 1 : 0;
+        }
+        TestEqual(FString::Printf(TEXT("Level %d truncated records accepted"), Level), AcceptedTruncations, 0);
+
+        TArray<uint8> WrongVersion = Record;
+        WrongVersion[0] = FHexademic6RecordFrameHeader::CurrentVersion + 1;
+        TestFalse(FString::Printf(TEXT("Level %d record of an unknown version"), Level), Codec.Decompress(WrongVersion, Decoded));
+
+        TArray<uint8> WrongCodec = Record;
+        WrongCodec[2] = (uint8)EHexademic6RecordCodec::OodleLeviathan + 1;
+        TestFalse(FString::Printf(TEXT("Level %d record of an unknown codec"), Level), Codec.Decompress(WrongCodec, Decoded));
+
+        // RawSize is the last frame header field, little-endian from byte 8.
+        TArray<uint8> WrongSize = Record;
+        ++WrongSize[8];
+        TestFalse(FString::Printf(TEXT("Level %d record with a wrong raw size"), Level), Codec.Decompress(WrongSize, Decoded));
+
+        TArray<uint8> UnknownDictionary = Record;
+        UnknownDictionary[2] = (uint8)EHexademic6RecordCodec::LZ;
+        UnknownDictionary[4] = 0xFF;
+        TestFalse(FString::Printf(TEXT("Level %d record naming an unregistered dictionary"), Level), Codec.Decompress(UnknownDictionary, Decoded));
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHexademic6RecordCodecOrchestratorRestoreTest, "Hexademic.RecordCodec.OrchestratorRestore",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHexademic6RecordCodecOrchestratorRestoreTest::RunTest(const FString& Parameters)
+{
+    // DecompressMemoryNode restores every field of a stored node from its key alone.
+    using namespace Hexademic6RecordCodecTestsPrivate;
+    FRandomStream Random(0x0DEC);
+    FDUIDSOrchestrator Orchestrator;
+    for (uint8 Level = 0; Level <= MaxTestedLevel; ++Level)
+    {
+        FHexademicMemoryNode Memory = MakeRandomNode(Random, TEXT("Restore"));
+        Memory.QuickAccessIndex = Orchestrator.GenerateIndex(Memory);
+        Orchestrator.CompressMemoryNode(Memory, Level);
+        FHexademicMemoryNode Expected = Memory;
+        Expected.DecompressForAccess();
+
+        FHexademicMemoryNode Restored;
+        Restored.QuickAccessIndex = Memory.QuickAccessIndex;
+        Orchestrator.DecompressMemoryNode(Restored);
+        TestTrue(FString::Printf(TEXT("Level %d node restored whole"), Level), SameNode(Expected, Restored));
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHexademic6RecordCodecBenchmark, "Hexademic.RecordCodec.Benchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FHexademic6RecordCodecBenchmark::RunTest(const FString& Parameters)
+{
+    // Compresses and decompresses the same nodes at every level, and reports throughput over
+    // serialized node bytes plus the stored/raw ratio. Run in a development or shipping build;
+    // debug timings say nothing.
+    using namespace Hexademic6RecordCodecTestsPrivate;
+    constexpr int32 NumNodes = 1 << 14;
+    FRandomStream Random(0xBE7C);
+    TArray<FHexademicMemoryNode> Memories;
+    int64 RawBytes = 0;
+    TArray<uint8> Scratch;
+    for (int32 Sample = 0; Sample < NumNodes; ++Sample)
+    {
+        Memories.Add(MakeRandomNode(Random, Sample % 2 ? TEXT("BenchmarkA") : TEXT("BenchmarkB")));
+        Scratch.Reset();
+        FHexademic6RecordCodec::SerializeNode(Memories.Last(), Scratch);
+        RawBytes += Scratch.Num();
+    }
+
+    for (uint8 Level = 0; Level <= MaxTestedLevel; ++Level)
+    {
+        FHexademic6RecordCodec Codec;
+        TArray<TArray<uint8>> Records;
+        Records.SetNum(NumNodes);
+        int64 StoredBytes = 0;
+        const double CompressStart = FPlatformTime::Seconds();
+        for (int32 Sample = 0; Sample < NumNodes; ++Sample)
+        {
+            Codec.Compress(Memories[Sample], Level, Records[Sample]);
+        }
+        const double CompressSeconds = FPlatformTime::Seconds() - CompressStart;
+        for (const TArray<uint8>& Record : Records)
+        {
+            StoredBytes += Record.Num();
+        }
+
+        int32 Mismatches = 0;
+        FHexademicMemoryNode Decoded;
+        const double DecompressStart = FPlatformTime::Seconds();
+        for (int32 Sample = 0; Sample < NumNodes; ++Sample)
+        {
+            Mismatches += Codec.Decompress(Records[Sample], Decoded) ? 0 : 1;
+        }
+        const double DecompressSeconds = FPlatformTime::Seconds() - DecompressStart;
+
+        TestEqual(FString::Printf(TEXT("Level %d failed decodes"), Level), Mismatches, 0);
+        AddInfo(FString::Printf(TEXT("Level %d, %d nodes: compress %.1f MB/s, decompress %.1f MB/s, ratio %.3f."),
+            Level, NumNodes, RawBytes / CompressSeconds / 1e6, RawBytes / DecompressSeconds / 1e6, (double)StoredBytes / RawBytes));
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS